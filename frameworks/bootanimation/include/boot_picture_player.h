@@ -16,6 +16,7 @@
 #ifndef FRAMEWORKS_BOOTANIMATION_INCLUDE_BOOT_PICTURE_PLAYER_H
 #define FRAMEWORKS_BOOTANIMATION_INCLUDE_BOOT_PICTURE_PLAYER_H
 
+#include "boot_picture_stream.h"
 #include "boot_player.h"
 #include "util.h"
 #include <ui/rs_surface_extractor.h>
@@ -33,22 +34,21 @@ public:
 private:
     void OnVsync();
     bool Draw();
-    bool OnDraw(Rosen::Drawing::CoreCanvas* canvas, int32_t curNo);
+    bool OnDraw(Rosen::Drawing::CoreCanvas* canvas, const std::shared_ptr<ImageStruct>& frame);
     void InitPicCoordinates(Rosen::ScreenId screenId);
-    bool ReadPicZipFile(ImageStructVec& imgVec, int32_t& freq);
+    bool OpenPicZipFile(int32_t& freq);
     bool CheckFrameRateValid(int32_t frameRate);
     std::string GetPicZipPath();
 
     int32_t windowWidth_;
     int32_t windowHeight_;
-    int32_t picCurNo_ = 0;
+    int32_t picCurNo_ = -1;
     int32_t realHeight_ = 0;
     int32_t realWidth_ = 0;
     int32_t pointX_ = 0;
     int32_t pointY_ = 0;
-    int32_t imgVecSize_ = 0;
     int32_t freq_ = 30;
-    ImageStructVec imageVector_;
+    std::unique_ptr<BootPictureStream> pictureStream_;
 
 #ifdef NEW_RENDER_CONTEXT
     std::shared_ptr<OHOS::Rosen::RSRenderSurface> rsSurface_;
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FRAMEWORKS_BOOTANIMATION_INCLUDE_BOOT_PICTURE_STREAM_H
+#define FRAMEWORKS_BOOTANIMATION_INCLUDE_BOOT_PICTURE_STREAM_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "util.h"
+
+namespace OHOS {
+class BootPixelPool;
+
+/*
+ * Frames of a boot picture zip, inflated and decoded in name order on a worker thread. At most lookahead frames are
+ * kept inflated but still encoded, and only the next frame is decoded ahead of the one being drawn, so a decoded frame
+ * of a full screen animation is not held lookahead times. The pixels of a frame go back to a pool once its image is
+ * released, so playing the animation only needs a few frame buffers.
+ */
+class BootPictureStream {
+public:
+    static constexpr size_t DEFAULT_LOOKAHEAD = 3;
+
+    explicit BootPictureStream(size_t lookahead = DEFAULT_LOOKAHEAD);
+    ~BootPictureStream();
+
+    // reads the list of frames and the frame rate config, the frames are not read
+    bool Open(const std::string& zipPath, FrameRateConfig& frameConfig);
+    void Start();
+    void Stop();
+
+    // returns false when all the frames were taken, frame is nullptr if the next frame is not decoded yet
+    bool TryPopFrame(std::shared_ptr<ImageStruct>& frame);
+
+    int32_t GetFrameCount() const
+    {
+        return static_cast<int32_t>(frameEntries_.size());
+    }
+
+private:
+    struct FrameEntry {
+        std::string fileName;
+        unz_file_pos position;
+        unsigned long size;
+    };
+    struct EncodedFrame {
+        std::string fileName;
+        std::vector<char> encoded;
+    };
+
+    bool ReadEntries(FrameRateConfig& frameConfig);
+    void DecodeLoop();
+    std::shared_ptr<ImageStruct> DecodeFrame(const EncodedFrame& encodedFrame);
+    bool InflateEntry(const FrameEntry& entry, std::vector<char>& buffer);
+
+    size_t lookahead_;
+    unzFile zipFile_ = nullptr;
+    std::vector<FrameEntry> frameEntries_;
+    std::shared_ptr<BootPixelPool> pixelPool_;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<EncodedFrame> encodedFrames_;
+    // the decoded frame to be taken next, nullptr while it is being decoded
+    std::shared_ptr<ImageStruct> decodedFrame_;
+    bool isDecodeFinished_ = false;
+    bool isStopped_ = false;
+    std::thread decodeThread_;
+};
+} // namespace OHOS
+
+#endif // FRAMEWORKS_BOOTANIMATION_INCLUDE_BOOT_PICTURE_STREAM_H
@@ -47,9 +47,7 @@ void BootPicturePlayer::Play()
     }
 
     ROSEN_TRACE_BEGIN(HITRACE_TAG_GRAPHIC_AGP, "BootAnimation::preload");
-    if (ReadPicZipFile(imageVector_, freq_)) {
-        imgVecSize_ = static_cast<int32_t> (imageVector_.size());
-    } else {
+    if (!OpenPicZipFile(freq_)) {
         LOGE("read pic zip failed");
         AppExecFwk::EventRunner::Current()->Stop();
         return;
@@ -88,24 +86,23 @@ void BootPicturePlayer::InitPicCoordinates(Rosen::ScreenId screenId)
     }
 }
 
-bool BootPicturePlayer::ReadPicZipFile(ImageStructVec& imgVec, int32_t& freq)
+bool BootPicturePlayer::OpenPicZipFile(int32_t& freq)
 {
     FrameRateConfig frameConfig;
-    ReadZipFile(GetPicZipPath(), imgVec, frameConfig);
-    int32_t imageNum = static_cast<int32_t>(imgVec.size());
-    if (imageNum < 0) {
-        LOGE("zip pic num is invalid.");
+    pictureStream_ = std::make_unique<BootPictureStream>();
+    if (!pictureStream_->Open(GetPicZipPath(), frameConfig)) {
+        LOGE("open pic zip failed");
         return false;
     }
 
-    SortZipFile(imgVec);
-
     if (CheckFrameRateValid(frameConfig.frameRate)) {
         freq = frameConfig.frameRate;
     } else {
         LOGW("Only Support 30, 60 frame rate: %{public}d", frameConfig.frameRate);
     }
-    LOGI("read freq: %{public}d, pic num: %{public}d", freq, imageNum);
+    LOGI("read freq: %{public}d, pic num: %{public}d", freq, pictureStream_->GetFrameCount());
+    // frames are decoded while the animation plays, the first one is shown as soon as it is ready
+    pictureStream_->Start();
     return true;
 }
 
@@ -132,11 +129,16 @@ void BootPicturePlayer::OnVsync()
 
 bool BootPicturePlayer::Draw()
 {
-    if (picCurNo_ >= (imgVecSize_ - 1)) {
+    std::shared_ptr<ImageStruct> imgstruct = nullptr;
+    if (pictureStream_ == nullptr || !pictureStream_->TryPopFrame(imgstruct)) {
         LOGI("play sequence frames end");
         AppExecFwk::EventRunner::Current()->Stop();
         return false;
     }
+    if (imgstruct == nullptr) {
+        LOGD("frame %{public}d is still decoding, skip this vsync", picCurNo_ + 1);
+        return true;
+    }
     picCurNo_ = picCurNo_ + 1;
     ROSEN_TRACE_BEGIN(HITRACE_TAG_GRAPHIC_AGP, "BootAnimation::Draw RequestFrame");
     auto frame = rsSurface_->RequestFrame(windowWidth_, windowHeight_);
@@ -153,14 +155,14 @@ bool BootPicturePlayer::Draw()
         return false;
     }
     auto canvas = rsSurface_->GetCanvas();
-    OnDraw(canvas, picCurNo_);
+    OnDraw(canvas, imgstruct);
     ROSEN_TRACE_BEGIN(HITRACE_TAG_GRAPHIC_AGP, "BootAnimation::Draw FlushFrame");
     rsSurface_->FlushFrame();
     ROSEN_TRACE_END(HITRACE_TAG_GRAPHIC_AGP);
 #else
     rsSurfaceFrame_ = std::move(frame);
     auto canvas = rsSurfaceFrame_->GetCanvas();
-    OnDraw(canvas, picCurNo_);
+    OnDraw(canvas, imgstruct);
     ROSEN_TRACE_BEGIN(HITRACE_TAG_GRAPHIC_AGP, "BootAnimation::Draw FlushFrame");
     rsSurface_->FlushFrame(rsSurfaceFrame_);
     ROSEN_TRACE_END(HITRACE_TAG_GRAPHIC_AGP);
@@ -168,19 +170,18 @@ bool BootPicturePlayer::Draw()
     return true;
 }
 
-bool BootPicturePlayer::OnDraw(Rosen::Drawing::CoreCanvas* canvas, int32_t curNo)
+bool BootPicturePlayer::OnDraw(Rosen::Drawing::CoreCanvas* canvas, const std::shared_ptr<ImageStruct>& frame)
 {
     if (canvas == nullptr) {
         LOGE("OnDraw canvas is nullptr");
         AppExecFwk::EventRunner::Current()->Stop();
         return false;
     }
-    if (curNo > (imgVecSize_ - 1) || curNo < 0) {
+    if (frame == nullptr || frame->imageData == nullptr) {
         AppExecFwk::EventRunner::Current()->Stop();
         return false;
     }
-    std::shared_ptr<ImageStruct> imgstruct = imageVector_[curNo];
-    std::shared_ptr<Rosen::Drawing::Image> image = imgstruct->imageData;
+    std::shared_ptr<Rosen::Drawing::Image> image = frame->imageData;
 
     ROSEN_TRACE_BEGIN(HITRACE_TAG_GRAPHIC_AGP, "BootAnimation::OnDraw in drawRect");
     Rosen::Drawing::Brush brush;
@@ -194,7 +195,6 @@ bool BootPicturePlayer::OnDraw(Rosen::Drawing::CoreCanvas* canvas, int32_t curNo
     Rosen::Drawing::Rect rect(pointX_, pointY_, pointX_ + realWidth_, pointY_ + realHeight_);
     Rosen::Drawing::SamplingOptions samplingOptions;
     canvas->DrawImageRect(*image, rect, samplingOptions);
-    imageVector_[curNo].reset();
     ROSEN_TRACE_END(HITRACE_TAG_GRAPHIC_AGP);
     return true;
 }
@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "boot_picture_stream.h"
+
+#include <algorithm>
+
+#include "image/pixmap.h"
+#include "log.h"
+#include "rs_trace.h"
+
+namespace OHOS {
+namespace {
+    constexpr size_t BYTES_PER_PIXEL = 4;
+}
+
+class BootPixelPool : public std::enable_shared_from_this<BootPixelPool> {
+public:
+    // decodes the pixels of encodedImage into a pooled buffer
+    std::shared_ptr<Rosen::Drawing::Image> MakeImage(const Rosen::Drawing::Image& encodedImage);
+
+private:
+    struct PixelRelease {
+        std::shared_ptr<BootPixelPool> pool;
+        std::vector<uint8_t> pixels;
+    };
+
+    static void ReleasePixels(const void* pixels, void* context);
+    std::vector<uint8_t> Acquire(size_t size);
+    void Recycle(std::vector<uint8_t> pixels);
+
+    std::mutex mutex_;
+    std::vector<std::vector<uint8_t>> freeBuffers_;
+};
+
+std::shared_ptr<Rosen::Drawing::Image> BootPixelPool::MakeImage(const Rosen::Drawing::Image& encodedImage)
+{
+    int32_t width = encodedImage.GetWidth();
+    int32_t height = encodedImage.GetHeight();
+    if (width <= 0 || height <= 0) {
+        LOGE("invalid frame size: %{public}d x %{public}d", width, height);
+        return nullptr;
+    }
+    Rosen::Drawing::ImageInfo info(width, height, Rosen::Drawing::ColorType::COLORTYPE_RGBA_8888,
+        Rosen::Drawing::AlphaType::ALPHATYPE_PREMUL);
+    size_t rowBytes = static_cast<size_t>(width) * BYTES_PER_PIXEL;
+    auto release = new PixelRelease { shared_from_this(), Acquire(rowBytes * static_cast<size_t>(height)) };
+    std::shared_ptr<Rosen::Drawing::Image> image = nullptr;
+    if (encodedImage.ReadPixels(info, release->pixels.data(), rowBytes, 0, 0)) {
+        Rosen::Drawing::Pixmap pixmap(info, release->pixels.data(), rowBytes);
+        image = Rosen::Drawing::Image::MakeFromRaster(pixmap, ReleasePixels, release);
+    }
+    // the release proc is only bound to the pixels when the image is made
+    if (image == nullptr) {
+        Recycle(std::move(release->pixels));
+        delete release;
+    }
+    return image;
+}
+
+void BootPixelPool::ReleasePixels(const void* pixels, void* context)
+{
+    auto release = static_cast<PixelRelease*>(context);
+    release->pool->Recycle(std::move(release->pixels));
+    delete release;
+}
+
+std::vector<uint8_t> BootPixelPool::Acquire(size_t size)
+{
+    std::vector<uint8_t> pixels;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = std::find_if(freeBuffers_.begin(), freeBuffers_.end(),
+            [size](const std::vector<uint8_t>& buffer) { return buffer.capacity() >= size; });
+        if (iter != freeBuffers_.end()) {
+            pixels = std::move(*iter);
+            freeBuffers_.erase(iter);
+        }
+    }
+    pixels.resize(size);
+    return pixels;
+}
+
+void BootPixelPool::Recycle(std::vector<uint8_t> pixels)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    freeBuffers_.push_back(std::move(pixels));
+}
+
+BootPictureStream::BootPictureStream(size_t lookahead)
+    : lookahead_(std::max<size_t>(lookahead, 1)), pixelPool_(std::make_shared<BootPixelPool>())
+{
+}
+
+BootPictureStream::~BootPictureStream()
+{
+    Stop();
+    if (zipFile_ != nullptr) {
+        unzClose(zipFile_);
+        zipFile_ = nullptr;
+    }
+}
+
+bool BootPictureStream::Open(const std::string& zipPath, FrameRateConfig& frameConfig)
+{
+    if (zipFile_ != nullptr) {
+        LOGE("boot picture stream is already opened");
+        return false;
+    }
+    zipFile_ = unzOpen2(zipPath.c_str(), nullptr);
+    if (zipFile_ == nullptr) {
+        LOGE("Open zipFile fail: %{public}s", zipPath.c_str());
+        return false;
+    }
+    if (!ReadEntries(frameConfig)) {
+        unzClose(zipFile_);
+        zipFile_ = nullptr;
+        frameEntries_.clear();
+        return false;
+    }
+    std::sort(frameEntries_.begin(), frameEntries_.end(),
+        [](const FrameEntry& entry1, const FrameEntry& entry2) { return entry1.fileName < entry2.fileName; });
+    LOGD("boot picture stream frame num: %{public}zu", frameEntries_.size());
+    return true;
+}
+
+bool BootPictureStream::ReadEntries(FrameRateConfig& frameConfig)
+{
+    unz_global_info globalInfo;
+    if (unzGetGlobalInfo(zipFile_, &globalInfo) != UNZ_OK) {
+        LOGE("Get ZipGlobalInfo fail");
+        return false;
+    }
+    for (unsigned long i = 0; i < globalInfo.number_entry; ++i) {
+        if (i > 0 && unzGoToNextFile(zipFile_) != UNZ_OK) {
+            return false;
+        }
+        unz_file_info fileInfo;
+        char filename[MAX_FILE_NAME] = {0};
+        if (unzGetCurrentFileInfo(zipFile_, &fileInfo, filename, MAX_FILE_NAME, nullptr, 0, nullptr, 0) != UNZ_OK) {
+            return false;
+        }
+        size_t length = strlen(filename);
+        if (length > MAX_FILE_NAME || length == 0) {
+            return false;
+        }
+        if (filename[length - 1] == '/' || fileInfo.uncompressed_size == 0) {
+            continue;
+        }
+        FrameEntry entry;
+        entry.fileName = std::string(filename);
+        size_t npos = entry.fileName.find_last_of("//");
+        if (npos != std::string::npos) {
+            entry.fileName = entry.fileName.substr(npos + 1, entry.fileName.length());
+        }
+        entry.size = fileInfo.uncompressed_size;
+        if (unzGetFilePos(zipFile_, &entry.position) != UNZ_OK) {
+            return false;
+        }
+        if (strstr(entry.fileName.c_str(), BOOT_PIC_CONFIG_FILE.c_str()) != nullptr) {
+            std::vector<char> buffer;
+            if (InflateEntry(entry, buffer)) {
+                ParseImageConfig(buffer.data(), static_cast<int>(buffer.size()), frameConfig);
+            }
+            continue;
+        }
+        frameEntries_.push_back(entry);
+    }
+    return true;
+}
+
+void BootPictureStream::Start()
+{
+    if (zipFile_ == nullptr || decodeThread_.joinable()) {
+        return;
+    }
+    decodeThread_ = std::thread(&BootPictureStream::DecodeLoop, this);
+}
+
+void BootPictureStream::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        isStopped_ = true;
+        encodedFrames_.clear();
+        decodedFrame_ = nullptr;
+    }
+    condition_.notify_all();
+    if (decodeThread_.joinable()) {
+        decodeThread_.join();
+    }
+}
+
+bool BootPictureStream::TryPopFrame(std::shared_ptr<ImageStruct>& frame)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (decodedFrame_ == nullptr) {
+            frame = nullptr;
+            return !isDecodeFinished_ && !isStopped_;
+        }
+        frame = std::move(decodedFrame_);
+    }
+    condition_.notify_all();
+    return true;
+}
+
+void BootPictureStream::DecodeLoop()
+{
+    // buffers of decoded frames are inflated into again, so they only grow to the biggest frames
+    std::vector<std::vector<char>> spareBuffers;
+    size_t nextEntry = 0;
+    while (true) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (nextEntry == frameEntries_.size() && encodedFrames_.empty()) {
+            isDecodeFinished_ = true;
+            return;
+        }
+        // decoding the next frame goes first, inflating only fills the lookahead
+        condition_.wait(lock, [this, nextEntry] {
+            return isStopped_ || (decodedFrame_ == nullptr && !encodedFrames_.empty()) ||
+                (nextEntry < frameEntries_.size() && encodedFrames_.size() < lookahead_);
+        });
+        if (isStopped_) {
+            return;
+        }
+        if (decodedFrame_ == nullptr && !encodedFrames_.empty()) {
+            EncodedFrame encodedFrame = std::move(encodedFrames_.front());
+            encodedFrames_.pop_front();
+            lock.unlock();
+            ROSEN_TRACE_BEGIN(HITRACE_TAG_GRAPHIC_AGP, "BootAnimation::DecodeFrame");
+            auto frame = DecodeFrame(encodedFrame);
+            ROSEN_TRACE_END(HITRACE_TAG_GRAPHIC_AGP);
+            spareBuffers.push_back(std::move(encodedFrame.encoded));
+            if (frame == nullptr) {
+                LOGE("decode frame %{public}s failed, skip it", encodedFrame.fileName.c_str());
+                continue;
+            }
+            lock.lock();
+            decodedFrame_ = std::move(frame);
+            continue;
+        }
+        const FrameEntry& entry = frameEntries_[nextEntry++];
+        lock.unlock();
+        EncodedFrame encodedFrame { entry.fileName, {} };
+        if (!spareBuffers.empty()) {
+            encodedFrame.encoded = std::move(spareBuffers.back());
+            spareBuffers.pop_back();
+        }
+        if (!InflateEntry(entry, encodedFrame.encoded)) {
+            spareBuffers.push_back(std::move(encodedFrame.encoded));
+            continue;
+        }
+        lock.lock();
+        encodedFrames_.push_back(std::move(encodedFrame));
+    }
+}
+
+std::shared_ptr<ImageStruct> BootPictureStream::DecodeFrame(const EncodedFrame& encodedFrame)
+{
+    // the encoded buffer is reused by a later frame, so the pixels are decoded before returning
+    auto data = std::make_shared<Rosen::Drawing::Data>();
+    if (!data->BuildWithoutCopy(encodedFrame.encoded.data(), encodedFrame.encoded.size())) {
+        return nullptr;
+    }
+    Rosen::Drawing::Image encodedImage;
+    if (!encodedImage.MakeFromEncoded(data)) {
+        return nullptr;
+    }
+    auto image = pixelPool_->MakeImage(encodedImage);
+    if (image == nullptr) {
+        return nullptr;
+    }
+    auto frame = std::make_shared<ImageStruct>();
+    frame->fileName = encodedFrame.fileName;
+    frame->imageData = image;
+    return frame;
+}
+
+bool BootPictureStream::InflateEntry(const FrameEntry& entry, std::vector<char>& buffer)
+{
+    unz_file_pos position = entry.position;
+    if (unzGoToFilePos(zipFile_, &position) != UNZ_OK || unzOpenCurrentFile(zipFile_) != UNZ_OK) {
+        LOGE("open zip entry %{public}s failed", entry.fileName.c_str());
+        return false;
+    }
+    buffer.resize(entry.size);
+    int readLen = unzReadCurrentFile(zipFile_, buffer.data(), static_cast<unsigned>(entry.size));
+    unzCloseCurrentFile(zipFile_);
+    if (readLen < 0 || static_cast<unsigned long>(readLen) != entry.size) {
+        LOGE("inflate zip entry %{public}s failed: %{public}d", entry.fileName.c_str(), readLen);
+        return false;
+    }
+    return true;
+}
+} // namespace OHOS
@@ -40,16 +40,17 @@ void BootPicturePlayerTest::TearDown() {}
 
 /**
  * @tc.name: BootPicturePlayerTest_001
- * @tc.desc: Verify the ReadPicZipFile
+ * @tc.desc: Verify the OpenPicZipFile
  * @tc.type:FUNC
  */
 HWTEST_F(BootPicturePlayerTest, BootPicturePlayerTest_001, TestSize.Level1)
 {
     PlayerParams params;
     std::shared_ptr<BootPicturePlayer> player = std::make_shared<BootPicturePlayer>(params);
-    ImageStructVec imgVec;
     int32_t freq = 30;
-    EXPECT_EQ(player->ReadPicZipFile(imgVec, freq), true);
+    EXPECT_EQ(player->OpenPicZipFile(freq), IsFileExisted(player->GetPicZipPath()));
+    ASSERT_NE(player->pictureStream_, nullptr);
+    player->pictureStream_->Stop();
 }
 
 /**
@@ -104,8 +105,7 @@ HWTEST_F(BootPicturePlayerTest, BootPicturePlayerTest_004, TestSize.Level1)
     });
     runner->Run();
 
-    ImageStructVec imgVec;
-    player->imageVector_ = imgVec;
+    player->pictureStream_ = nullptr;
     handler->PostTask([&] {
         player->Play();
         runner->Stop();
@@ -143,20 +143,25 @@ HWTEST_F(BootPicturePlayerTest, BootPicturePlayerTest_006, TestSize.Level1)
     PlayerParams params;
     std::shared_ptr<BootPicturePlayer> player = std::make_shared<BootPicturePlayer>(params);
     player->rsSurface_ = operation.rsSurface_;
-    player->picCurNo_ = 2;
-    player->imgVecSize_ = 0;
+    player->pictureStream_ = nullptr;
     handler->PostTask([&] {
-        player->Draw();
+        EXPECT_EQ(player->Draw(), false);
         runner->Stop();
     });
     runner->Run();
 
-    ImageStructVec imgVec;
-    player->imageVector_ = imgVec;
-    player->picCurNo_ = -2;
-    player->imgVecSize_ = 0;
+    // a stream that has not started decoding yet skips the vsync
+    player->pictureStream_ = std::make_unique<BootPictureStream>();
     handler->PostTask([&] {
-        player->Draw();
+        EXPECT_EQ(player->Draw(), true);
+        runner->Stop();
+    });
+    runner->Run();
+    EXPECT_EQ(player->picCurNo_, -1);
+
+    player->pictureStream_->Stop();
+    handler->PostTask([&] {
+        EXPECT_EQ(player->Draw(), false);
         runner->Stop();
     });
     runner->Run();
@@ -174,28 +179,28 @@ HWTEST_F(BootPicturePlayerTest, BootPicturePlayerTest_007, TestSize.Level1)
     PlayerParams params;
     std::shared_ptr<BootPicturePlayer> player = std::make_shared<BootPicturePlayer>(params);
     handler->PostTask([&] {
-        player->OnDraw(nullptr, 0);
+        EXPECT_EQ(player->OnDraw(nullptr, nullptr), false);
         runner->Stop();
     });
     runner->Run();
 
     Rosen::Drawing::CoreCanvas canvas;
     handler->PostTask([&] {
-        player->OnDraw(&canvas, 0);
+        EXPECT_EQ(player->OnDraw(&canvas, nullptr), false);
         runner->Stop();
     });
     runner->Run();
 
-    player->imgVecSize_ = 1;
+    auto frame = std::make_shared<ImageStruct>();
     handler->PostTask([&] {
-        player->OnDraw(&canvas, -1);
+        EXPECT_EQ(player->OnDraw(&canvas, frame), false);
         runner->Stop();
     });
     runner->Run();
 
-    player->imgVecSize_ = -1;
+    frame->imageData = std::make_shared<Rosen::Drawing::Image>();
     handler->PostTask([&] {
-        player->OnDraw(&canvas, -1);
+        EXPECT_EQ(player->OnDraw(&canvas, frame), true);
         runner->Stop();
     });
     runner->Run();
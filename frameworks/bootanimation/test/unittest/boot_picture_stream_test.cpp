@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <securec.h>
+
+#include "boot_picture_stream.h"
+#include "boot_picture_zip_util.h"
+#include "util.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Rosen {
+namespace {
+const std::string TEST_ZIP_PATH = "/data/local/tmp/boot_picture_stream_test.zip";
+}
+
+class BootPictureStreamTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+};
+
+void BootPictureStreamTest::SetUpTestCase() {}
+void BootPictureStreamTest::TearDownTestCase()
+{
+    remove(TEST_ZIP_PATH.c_str());
+}
+void BootPictureStreamTest::SetUp() {}
+void BootPictureStreamTest::TearDown() {}
+
+/**
+ * @tc.name: BootPictureStreamTest_001
+ * @tc.desc: Verify the frames of a zip are streamed in name order
+ * @tc.type:FUNC
+ */
+HWTEST_F(BootPictureStreamTest, BootPictureStreamTest_001, TestSize.Level1)
+{
+    constexpr int32_t frameNum = 8;
+    constexpr int32_t frameSize = 64;
+    ASSERT_TRUE(WriteBootPictureZip(TEST_ZIP_PATH, frameNum, frameSize));
+
+    BootPictureStream stream;
+    FrameRateConfig frameConfig;
+    ASSERT_TRUE(stream.Open(TEST_ZIP_PATH, frameConfig));
+    EXPECT_EQ(frameConfig.frameRate, 60);
+    ASSERT_EQ(stream.GetFrameCount(), frameNum);
+    stream.Start();
+
+    std::shared_ptr<ImageStruct> frame = nullptr;
+    for (int32_t i = 0; i < frameNum; i++) {
+        ASSERT_TRUE(PopBootPictureFrame(stream, frame));
+        char name[MAX_FILE_NAME] = {0};
+        ASSERT_GT(snprintf_s(name, sizeof(name), sizeof(name) - 1, "frame_%04d.png", i), 0);
+        EXPECT_EQ(frame->fileName, name);
+        ASSERT_NE(frame->imageData, nullptr);
+        EXPECT_EQ(frame->imageData->GetWidth(), frameSize);
+        EXPECT_EQ(frame->imageData->GetHeight(), frameSize);
+    }
+    EXPECT_FALSE(PopBootPictureFrame(stream, frame));
+    EXPECT_EQ(frame, nullptr);
+}
+
+/**
+ * @tc.name: BootPictureStreamTest_002
+ * @tc.desc: Verify one frame is decoded ahead, lookahead frames are kept encoded and Stop ends the stream
+ * @tc.type:FUNC
+ */
+HWTEST_F(BootPictureStreamTest, BootPictureStreamTest_002, TestSize.Level1)
+{
+    ASSERT_TRUE(WriteBootPictureZip(TEST_ZIP_PATH, 8, 16));
+    constexpr size_t lookahead = 2;
+    BootPictureStream stream(lookahead);
+    FrameRateConfig frameConfig;
+    ASSERT_TRUE(stream.Open(TEST_ZIP_PATH, frameConfig));
+    std::shared_ptr<ImageStruct> frame = nullptr;
+    // nothing is decoded before Start
+    EXPECT_TRUE(stream.TryPopFrame(frame));
+    EXPECT_EQ(frame, nullptr);
+
+    stream.Start();
+    ASSERT_TRUE(PopBootPictureFrame(stream, frame));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    {
+        std::lock_guard<std::mutex> lock(stream.mutex_);
+        // only the next frame is decoded, the lookahead is kept encoded
+        EXPECT_NE(stream.decodedFrame_, nullptr);
+        EXPECT_EQ(stream.encodedFrames_.size(), lookahead);
+        EXPECT_FALSE(stream.isDecodeFinished_);
+    }
+    stream.Stop();
+    std::shared_ptr<ImageStruct> nextFrame = nullptr;
+    EXPECT_FALSE(stream.TryPopFrame(nextFrame));
+    // frames taken before Stop stay valid
+    ASSERT_NE(frame, nullptr);
+    EXPECT_EQ(frame->imageData->GetWidth(), 16);
+}
+
+/**
+ * @tc.name: BootPictureStreamTest_003
+ * @tc.desc: Verify Open fails on a missing zip
+ * @tc.type:FUNC
+ */
+HWTEST_F(BootPictureStreamTest, BootPictureStreamTest_003, TestSize.Level1)
+{
+    BootPictureStream stream;
+    FrameRateConfig frameConfig;
+    EXPECT_FALSE(stream.Open("/data/local/tmp/not_exist_boot_pic.zip", frameConfig));
+    stream.Start();
+    std::shared_ptr<ImageStruct> frame = nullptr;
+    EXPECT_TRUE(stream.TryPopFrame(frame));
+    EXPECT_EQ(frame, nullptr);
+}
+}
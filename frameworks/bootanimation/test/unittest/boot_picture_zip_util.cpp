@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "boot_picture_zip_util.h"
+
+#include <chrono>
+#include <securec.h>
+#include <thread>
+
+#include "image/bitmap.h"
+
+namespace OHOS {
+namespace {
+std::shared_ptr<Rosen::Drawing::Data> EncodeFrame(int32_t size, uint32_t seed)
+{
+    Rosen::Drawing::Bitmap bitmap;
+    Rosen::Drawing::BitmapFormat format { Rosen::Drawing::ColorType::COLORTYPE_RGBA_8888,
+        Rosen::Drawing::AlphaType::ALPHATYPE_PREMUL };
+    if (!bitmap.Build(size, size, format)) {
+        return nullptr;
+    }
+    // noise keeps the encoded frames close to the size of real boot pictures
+    auto pixels = static_cast<uint32_t*>(bitmap.GetPixels());
+    uint32_t state = seed * 2654435761u + 1;
+    for (int32_t i = 0; i < size * size; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        pixels[i] = state | 0xFF000000u;
+    }
+    Rosen::Drawing::Image image;
+    if (!image.BuildFromBitmap(bitmap)) {
+        return nullptr;
+    }
+    return image.EncodeToData(Rosen::Drawing::EncodedImageFormat::PNG, 100);
+}
+
+bool WriteZipEntry(zipFile zip, const std::string& name, const void* buffer, size_t len)
+{
+    zip_fileinfo fileInfo = {};
+    if (zipOpenNewFileInZip(zip, name.c_str(), &fileInfo, nullptr, 0, nullptr, 0, nullptr, Z_DEFLATED,
+        Z_DEFAULT_COMPRESSION) != ZIP_OK) {
+        return false;
+    }
+    bool ret = zipWriteInFileInZip(zip, buffer, static_cast<unsigned>(len)) == ZIP_OK;
+    return (zipCloseFileInZip(zip) == ZIP_OK) && ret;
+}
+} // namespace
+
+bool WriteBootPictureZip(const std::string& path, int32_t frameNum, int32_t frameSize)
+{
+    zipFile zip = zipOpen(path.c_str(), APPEND_STATUS_CREATE);
+    if (zip == nullptr) {
+        return false;
+    }
+    std::string config = "{\"FrameRate\": 60}";
+    bool ret = WriteZipEntry(zip, "pics/config.json", config.data(), config.size());
+    for (int32_t i = frameNum - 1; ret && i >= 0; i--) {
+        auto data = EncodeFrame(frameSize, static_cast<uint32_t>(i));
+        char name[MAX_FILE_NAME] = {0};
+        ret = data != nullptr && snprintf_s(name, sizeof(name), sizeof(name) - 1, "pics/frame_%04d.png", i) > 0 &&
+            WriteZipEntry(zip, name, data->GetData(), data->GetSize());
+    }
+    return (zipClose(zip, nullptr) == ZIP_OK) && ret;
+}
+
+bool PopBootPictureFrame(BootPictureStream& stream, std::shared_ptr<ImageStruct>& frame)
+{
+    while (stream.TryPopFrame(frame)) {
+        if (frame != nullptr) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+} // namespace OHOS
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FRAMEWORKS_BOOTANIMATION_TEST_UNITTEST_BOOT_PICTURE_ZIP_UTIL_H
+#define FRAMEWORKS_BOOTANIMATION_TEST_UNITTEST_BOOT_PICTURE_ZIP_UTIL_H
+
+#include <memory>
+#include <string>
+
+#include "boot_picture_stream.h"
+
+namespace OHOS {
+/*
+ * Writes a boot picture zip of frameNum noise frames of frameSize x frameSize pixels and a 60fps config.json.
+ * The frames are written in reverse order, so readers have to sort them by name.
+ */
+bool WriteBootPictureZip(const std::string& path, int32_t frameNum, int32_t frameSize);
+
+// waits for the next decoded frame, returns false when the stream ends
+bool PopBootPictureFrame(BootPictureStream& stream, std::shared_ptr<ImageStruct>& frame);
+} // namespace OHOS
+
+#endif // FRAMEWORKS_BOOTANIMATION_TEST_UNITTEST_BOOT_PICTURE_ZIP_UTIL_H
@@ -30,6 +30,7 @@
 
 namespace OHOS {
 namespace Rosen {
+class VSyncSharedPage;
 class VSyncCallBackListener : public OHOS::AppExecFwk::FileDescriptorListener {
 public:
     using VSyncCallback = std::function<void(int64_t, void*)>;
@@ -99,8 +100,22 @@ public:
         frameCallbacks_.push_back(cb);
     }
 
+    // the fd is only a wakeup then, the events are read from the page. nullptr goes back to reading the fd
+    void SetSharedPage(const std::shared_ptr<VSyncSharedPage>& sharedPage)
+    {
+        std::lock_guard<std::mutex> locker(mtx_);
+        sharedPage_ = sharedPage;
+    }
+
+    bool HasSharedPage()
+    {
+        std::lock_guard<std::mutex> locker(mtx_);
+        return sharedPage_ != nullptr;
+    }
+
 private:
     void OnReadable(int32_t fileDescriptor) override;
+    void OnSharedPageReadable(int32_t fileDescriptor, const std::shared_ptr<VSyncSharedPage>& sharedPage);
     int64_t CalculateExpectedEndLocked(int64_t now);
     void HandleVsyncCallbacks(int64_t data[], ssize_t dataCount);
     VSyncCallback vsyncCallbacks_;
@@ -114,6 +129,7 @@ private:
     thread_local static inline int64_t periodShared_ = 0;
     thread_local static inline int64_t timeStampShared_ = 0;
     std::vector<FrameCallback> frameCallbacks_ = {};
+    std::shared_ptr<VSyncSharedPage> sharedPage_ = nullptr;
 };
 
 #ifdef __OHOS__
@@ -138,7 +154,8 @@ public:
     virtual VsyncError GetVSyncPeriod(int64_t &period);
     virtual VsyncError GetVSyncPeriodAndLastTimeStamp(int64_t &period, int64_t &timeStamp,
                                                         bool isThreadShared = false);
-    int32_t GetFd() { return fd_; }
+    // the fd may be handed to another process, so the receiver goes back to the socket if it used the shared page
+    int32_t GetFd();
 
     /* transfer the FD to other process(want to use the FD),
       the current process does not use the FD, so close FD, but not close vsync connection
@@ -153,6 +170,8 @@ public:
     virtual VsyncError RequestNextVSyncWithMultiCallback(FrameCallback callback);
 private:
     VsyncError Destroy();
+    VsyncError InitSharedPage();
+    VsyncError UseSocketLocked();
     sptr<IVSyncConnection> connection_;
     sptr<IRemoteObject> token_;
     std::shared_ptr<OHOS::AppExecFwk::EventHandler> looper_;
@@ -106,6 +106,9 @@ ParagraphBuilderImpl::ParagraphBuilderImpl(
 {
     threadId_ = pthread_self();
     builder_ = skt::ParagraphBuilder::make(TextStyleToSkStyle(style), fontCollection->CreateSktFontCollection());
+    layoutContent_ = std::make_shared<ParagraphLayoutContent>();
+    layoutContent_->fontCollection = fontCollection;
+    layoutContent_->AppendParagraphStyle(style);
 }
 
 ParagraphBuilderImpl::~ParagraphBuilderImpl() = default;
@@ -114,18 +117,27 @@ void ParagraphBuilderImpl::PushStyle(const TextStyle& style)
 {
     RecordDifferentPthreadCall(__FUNCTION__);
     builder_->pushStyle(TextStyleToSkStyle(style));
+    if (layoutContent_ != nullptr) {
+        layoutContent_->AppendTextStyle(style);
+    }
 }
 
 void ParagraphBuilderImpl::Pop()
 {
     RecordDifferentPthreadCall(__FUNCTION__);
     builder_->pop();
+    if (layoutContent_ != nullptr) {
+        layoutContent_->AppendPop();
+    }
 }
 
 void ParagraphBuilderImpl::AddText(const std::u16string& text)
 {
     RecordDifferentPthreadCall(__FUNCTION__);
     builder_->addText(text);
+    if (layoutContent_ != nullptr) {
+        layoutContent_->AppendText(text);
+    }
 }
 
 void ParagraphBuilderImpl::AddPlaceholder(PlaceholderRun& run)
@@ -139,12 +151,20 @@ void ParagraphBuilderImpl::AddPlaceholder(PlaceholderRun& run)
     placeholderStyle.fAlignment = static_cast<skt::PlaceholderAlignment>(run.alignment);
 
     builder_->addPlaceholder(placeholderStyle);
+    if (layoutContent_ != nullptr) {
+        layoutContent_->AppendPlaceholder(run);
+    }
 }
 
 std::unique_ptr<Paragraph> ParagraphBuilderImpl::Build()
 {
     RecordDifferentPthreadCall(__FUNCTION__);
     auto ret = std::make_unique<ParagraphImpl>(builder_->Build(), std::move(paints_));
+    if (layoutContent_ != nullptr) {
+        layoutContent_->UpdateHash();
+        ret->SetLayoutContent(std::move(layoutContent_));
+        layoutContent_ = nullptr;
+    }
     builder_->Reset();
     return ret;
 }
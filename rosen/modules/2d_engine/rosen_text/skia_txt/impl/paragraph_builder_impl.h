@@ -51,6 +51,8 @@ private:
 
     std::vector<PaintRecord> paints_;
     mutable pthread_t threadId_;
+    // only the first paragraph of a builder is cached, paint ids of later ones do not start from the style's
+    std::shared_ptr<ParagraphLayoutContent> layoutContent_;
 };
 } // namespace SPText
 } // namespace Rosen
@@ -130,6 +130,7 @@ void ParagraphImpl::MarkDirty()
     if (paragraph_ == nullptr) {
         return;
     }
+    layoutWidth_.reset();
     paragraph_->markDirty();
 }
 
@@ -148,12 +149,17 @@ void ParagraphImpl::UpdateFontSize(size_t from, size_t to, float fontSize)
     if (paragraph_ == nullptr) {
         return;
     }
+    // the paragraph no longer matches its content, so its layouts are not shared anymore
+    layoutContent_ = nullptr;
+    layoutWidth_.reset();
     paragraph_->updateFontSize(from, to, fontSize);
 }
 
 void ParagraphImpl::SetIndents(const std::vector<float>& indents)
 {
     RecordDifferentPthreadCall(__FUNCTION__);
+    layoutContent_ = nullptr;
+    layoutWidth_.reset();
     paragraph_->setIndents(indents);
 }
 
@@ -168,7 +174,22 @@ void ParagraphImpl::Layout(double width)
     RecordDifferentPthreadCall(__FUNCTION__);
     lineMetrics_.reset();
     lineMetricsStyles_.clear();
-    paragraph_->layout(width);
+    // laying out again at the same width is cheap in skparagraph, only changed widths go to the cache
+    if (layoutContent_ == nullptr || layoutWidth_ == width) {
+        paragraph_->layout(width);
+        layoutWidth_ = width;
+        return;
+    }
+
+    auto& cache = ParagraphLayoutCache::Instance();
+    auto cached = cache.Find(layoutContent_, width);
+    if (cached != nullptr) {
+        paragraph_ = std::move(cached);
+    } else {
+        paragraph_->layout(width);
+        cache.Insert(layoutContent_, width, paragraph_->CloneSelf());
+    }
+    layoutWidth_ = width;
 }
 
 double ParagraphImpl::GetGlyphsBoundsTop()
@@ -373,6 +394,8 @@ std::unique_ptr<Paragraph> ParagraphImpl::CloneSelf()
     std::unique_ptr<skt::Paragraph> sktParagraph = paragraph_->CloneSelf();
     std::unique_ptr<ParagraphImpl> paragraph = std::make_unique<ParagraphImpl>(std::move(sktParagraph),
         std::move(paints));
+    paragraph->layoutContent_ = layoutContent_;
+    paragraph->layoutWidth_ = layoutWidth_;
     return paragraph;
 }
 
@@ -382,6 +405,7 @@ void ParagraphImpl::UpdateColor(size_t from, size_t to, const RSColor& color)
     if (!paragraph_) {
         return;
     }
+    layoutContent_ = nullptr;
     auto unresolvedPaintID = paragraph_->updateColor(from, to,
         SkColorSetARGB(color.GetAlpha(), color.GetRed(), color.GetGreen(), color.GetBlue()));
     for (auto paintID : unresolvedPaintID) {
@@ -389,6 +413,11 @@ void ParagraphImpl::UpdateColor(size_t from, size_t to, const RSColor& color)
     }
 }
 
+void ParagraphImpl::SetLayoutContent(std::shared_ptr<const ParagraphLayoutContent> content)
+{
+    layoutContent_ = std::move(content);
+}
+
 void ParagraphImpl::RecordDifferentPthreadCall(const char* caller) const
 {
     pthread_t currenetThreadId = pthread_self();
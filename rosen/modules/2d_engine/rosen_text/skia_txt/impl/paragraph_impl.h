@@ -20,6 +20,7 @@
 #include <pthread.h>
 
 #include "modules/skparagraph/include/Paragraph.h"
+#include "paragraph_layout_cache.h"
 #include "txt/paint_record.h"
 #include "txt/paragraph.h"
 
@@ -119,6 +120,9 @@ public:
     TextStyle SkStyleToTextStyle(const skia::textlayout::TextStyle& skStyle) override;
     void UpdateColor(size_t from, size_t to, const RSColor& color) override;
 
+    // Paragraphs with a layout content share their layout with equal ones through ParagraphLayoutCache
+    void SetLayoutContent(std::shared_ptr<const ParagraphLayoutContent> content);
+
 private:
     void RecordDifferentPthreadCall(const char* caller) const;
 
@@ -130,6 +134,8 @@ private:
         const std::shared_ptr<OHOS::Rosen::TextEngine::SymbolAnimationConfig>&)> animationFunc_ = nullptr;
     uint32_t id_ = 0;
     mutable pthread_t threadId_;
+    std::shared_ptr<const ParagraphLayoutContent> layoutContent_;
+    std::optional<double> layoutWidth_;
 };
 } // namespace SPText
 } // namespace Rosen
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paragraph_layout_cache.h"
+
+#include <functional>
+#include <type_traits>
+
+namespace OHOS {
+namespace Rosen {
+namespace SPText {
+namespace {
+// rough size of the runs, glyphs and clusters skparagraph keeps per utf-16 code unit, and per line
+constexpr size_t BYTES_PER_CODE_UNIT = 128;
+constexpr size_t BYTES_PER_LINE = 256;
+
+enum class ContentTag : char {
+    PARAGRAPH_STYLE = 'P',
+    TEXT_STYLE = 'S',
+    POP = 'O',
+    TEXT = 'T',
+    PLACEHOLDER = 'H',
+};
+
+template<typename T>
+void AppendValue(std::string& key, const T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "only plain values are appended as bytes");
+    key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void AppendString(std::string& key, const std::string& value)
+{
+    AppendValue(key, value.size());
+    key.append(value);
+}
+
+void AppendStrings(std::string& key, const std::vector<std::string>& values)
+{
+    AppendValue(key, values.size());
+    for (const auto& value : values) {
+        AppendString(key, value);
+    }
+}
+
+void AppendU16String(std::string& key, const std::u16string& value)
+{
+    AppendValue(key, value.size());
+    key.append(reinterpret_cast<const char*>(value.data()), value.size() * sizeof(char16_t));
+}
+
+void AppendStyleFields(std::string& key, const TextStyle& style)
+{
+    AppendValue(key, style.color);
+    AppendValue(key, style.decoration);
+    AppendValue(key, style.decorationColor);
+    AppendValue(key, style.decorationStyle);
+    AppendValue(key, style.decorationThicknessMultiplier);
+    AppendValue(key, style.fontWeight);
+    AppendValue(key, style.fontWidth);
+    AppendValue(key, style.fontStyle);
+    AppendValue(key, style.baseline);
+    AppendValue(key, style.halfLeading);
+    AppendStrings(key, style.fontFamilies);
+    AppendValue(key, style.fontSize);
+    AppendValue(key, style.letterSpacing);
+    AppendValue(key, style.wordSpacing);
+    AppendValue(key, style.height);
+    AppendValue(key, style.heightOverride);
+    AppendString(key, style.locale);
+    AppendValue(key, style.backgroundRect);
+    AppendValue(key, style.styleId);
+    // paints only hold paint ids in the paragraph, the records themselves stay with each ParagraphImpl
+    AppendValue(key, style.background.has_value());
+    AppendValue(key, style.foreground.has_value());
+    AppendValue(key, style.textShadows.size());
+    for (const auto& shadow : style.textShadows) {
+        AppendValue(key, shadow.color);
+        AppendValue(key, shadow.offset);
+        AppendValue(key, shadow.blurSigma);
+    }
+    const auto& features = style.fontFeatures.GetFontFeatures();
+    AppendValue(key, features.size());
+    for (const auto& [tag, value] : features) {
+        AppendString(key, tag);
+        AppendValue(key, value);
+    }
+    const auto& axisValues = style.fontVariations.GetAxisValues();
+    AppendValue(key, axisValues.size());
+    for (const auto& [axis, value] : axisValues) {
+        AppendString(key, axis);
+        AppendValue(key, value);
+    }
+    AppendValue(key, style.isSymbolGlyph);
+    AppendValue(key, style.baseLineShift);
+    AppendValue(key, style.isPlaceholder);
+}
+} // namespace
+
+void ParagraphLayoutContent::AppendParagraphStyle(const ParagraphStyle& style)
+{
+    AppendValue(key, ContentTag::PARAGRAPH_STYLE);
+    AppendValue(key, style.fontWeight);
+    AppendValue(key, style.fontWidth);
+    AppendValue(key, style.fontStyle);
+    AppendValue(key, style.wordBreakType);
+    AppendString(key, style.fontFamily);
+    AppendValue(key, style.fontSize);
+    AppendValue(key, style.height);
+    AppendValue(key, style.heightOverride);
+    AppendValue(key, style.strutEnabled);
+    AppendValue(key, style.strutFontWeight);
+    AppendValue(key, style.strutFontWidth);
+    AppendValue(key, style.strutFontStyle);
+    AppendStrings(key, style.strutFontFamilies);
+    AppendValue(key, style.strutFontSize);
+    AppendValue(key, style.strutHeight);
+    AppendValue(key, style.strutHeightOverride);
+    AppendValue(key, style.strutHalfLeading);
+    AppendValue(key, style.strutLeading);
+    AppendValue(key, style.forceStrutHeight);
+    AppendValue(key, style.textAlign);
+    AppendValue(key, style.textDirection);
+    AppendValue(key, style.ellipsisModal);
+    AppendValue(key, style.maxLines);
+    AppendU16String(key, style.ellipsis);
+    AppendString(key, style.locale);
+    AppendValue(key, style.textSplitRatio);
+    AppendValue(key, style.textOverflower);
+    AppendValue(key, style.customSpTextStyle);
+    if (style.customSpTextStyle) {
+        AppendStyleFields(key, style.spTextStyle);
+    }
+    AppendValue(key, style.textHeightBehavior);
+    AppendValue(key, style.hintingIsOn);
+    AppendValue(key, style.breakStrategy);
+}
+
+void ParagraphLayoutContent::AppendTextStyle(const TextStyle& style)
+{
+    AppendValue(key, ContentTag::TEXT_STYLE);
+    AppendStyleFields(key, style);
+}
+
+void ParagraphLayoutContent::AppendPop()
+{
+    AppendValue(key, ContentTag::POP);
+}
+
+void ParagraphLayoutContent::AppendText(const std::u16string& text)
+{
+    AppendValue(key, ContentTag::TEXT);
+    AppendU16String(key, text);
+    textLength += text.size();
+}
+
+void ParagraphLayoutContent::AppendPlaceholder(const PlaceholderRun& run)
+{
+    AppendValue(key, ContentTag::PLACEHOLDER);
+    AppendValue(key, run.width);
+    AppendValue(key, run.height);
+    AppendValue(key, run.alignment);
+    AppendValue(key, run.baseline);
+    AppendValue(key, run.baselineOffset);
+}
+
+void ParagraphLayoutContent::UpdateHash()
+{
+    hash = std::hash<std::string>()(key) ^ std::hash<const void*>()(fontCollection.get());
+}
+
+bool ParagraphLayoutCache::CacheKey::operator==(const CacheKey& rhs) const
+{
+    if (width != rhs.width) {
+        return false;
+    }
+    if (content == rhs.content) {
+        return true;
+    }
+    return content->hash == rhs.content->hash && content->fontCollection == rhs.content->fontCollection &&
+        content->key == rhs.content->key;
+}
+
+size_t ParagraphLayoutCache::CacheKeyHash::operator()(const CacheKey& key) const
+{
+    return key.content->hash ^ (std::hash<double>()(key.width) << 1);
+}
+
+ParagraphLayoutCache& ParagraphLayoutCache::Instance()
+{
+    static ParagraphLayoutCache instance;
+    return instance;
+}
+
+size_t ParagraphLayoutCache::EstimateBytes(const ParagraphLayoutContent& content,
+    skia::textlayout::Paragraph& paragraph)
+{
+    return sizeof(CacheKey) + sizeof(Entry) + sizeof(ParagraphLayoutContent) + content.key.size() +
+        content.textLength * BYTES_PER_CODE_UNIT + paragraph.lineNumber() * BYTES_PER_LINE;
+}
+
+std::unique_ptr<skia::textlayout::Paragraph> ParagraphLayoutCache::Find(
+    const std::shared_ptr<const ParagraphLayoutContent>& content, double width)
+{
+    auto entry = cache_.Find({ content, width });
+    if (entry == nullptr) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    return entry->paragraph->CloneSelf();
+}
+
+void ParagraphLayoutCache::Insert(const std::shared_ptr<const ParagraphLayoutContent>& content, double width,
+    std::unique_ptr<skia::textlayout::Paragraph> paragraph)
+{
+    if (content == nullptr || paragraph == nullptr || cache_.GetShardBudget() == 0) {
+        return;
+    }
+    auto entry = std::make_shared<Entry>();
+    size_t bytes = EstimateBytes(*content, *paragraph);
+    entry->paragraph = std::move(paragraph);
+    cache_.Insert({ content, width }, std::move(entry), bytes);
+}
+
+void ParagraphLayoutCache::Clear()
+{
+    cache_.Clear();
+}
+
+void ParagraphLayoutCache::SetBudget(size_t bytes)
+{
+    cache_.SetBudget(bytes);
+}
+
+ParagraphLayoutCache::Statistics ParagraphLayoutCache::GetStatistics()
+{
+    return cache_.GetStatistics();
+}
+} // namespace SPText
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ROSEN_MODULES_SPTEXT_PARAGRAPH_LAYOUT_CACHE_H
+#define ROSEN_MODULES_SPTEXT_PARAGRAPH_LAYOUT_CACHE_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "modules/skparagraph/include/Paragraph.h"
+#include "txt/font_collection.h"
+#include "txt/paragraph_style.h"
+#include "txt/placeholder_run.h"
+#include "utils/sharded_lru_cache.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace SPText {
+// Everything a paragraph was built from, in the order it was passed to the builder.
+struct ParagraphLayoutContent {
+    std::string key;
+    size_t hash = 0;
+    size_t textLength = 0;
+    std::shared_ptr<txt::FontCollection> fontCollection;
+
+    void AppendParagraphStyle(const ParagraphStyle& style);
+    void AppendTextStyle(const TextStyle& style);
+    void AppendPop();
+    void AppendText(const std::u16string& text);
+    void AppendPlaceholder(const PlaceholderRun& run);
+    void UpdateHash();
+};
+
+// Process wide cache of laid out paragraphs, keyed by their content and layout width.
+// Cached paragraphs are never painted or changed, callers get a copy of the laid out lines and runs.
+class ParagraphLayoutCache {
+public:
+    using Statistics = LruCacheStatistics;
+    static constexpr size_t SHARD_COUNT = 8;
+    static constexpr size_t DEFAULT_BUDGET = 4 * 1024 * 1024;
+
+    static ParagraphLayoutCache& Instance();
+
+    std::unique_ptr<skia::textlayout::Paragraph> Find(
+        const std::shared_ptr<const ParagraphLayoutContent>& content, double width);
+    void Insert(const std::shared_ptr<const ParagraphLayoutContent>& content, double width,
+        std::unique_ptr<skia::textlayout::Paragraph> paragraph);
+    void Clear();
+
+    // budget in bytes, 0 disables the cache
+    void SetBudget(size_t bytes);
+    Statistics GetStatistics();
+
+private:
+    struct CacheKey {
+        std::shared_ptr<const ParagraphLayoutContent> content;
+        double width = 0;
+
+        bool operator==(const CacheKey& rhs) const;
+    };
+    struct CacheKeyHash {
+        size_t operator()(const CacheKey& key) const;
+    };
+    struct Entry {
+        // CloneSelf is not const, so copies of one paragraph are taken one at a time
+        std::mutex mutex;
+        std::unique_ptr<skia::textlayout::Paragraph> paragraph;
+    };
+
+    ParagraphLayoutCache() = default;
+    ~ParagraphLayoutCache() = default;
+    ParagraphLayoutCache(const ParagraphLayoutCache&) = delete;
+    ParagraphLayoutCache& operator=(const ParagraphLayoutCache&) = delete;
+
+    static size_t EstimateBytes(const ParagraphLayoutContent& content, skia::textlayout::Paragraph& paragraph);
+
+    ShardedLruCache<CacheKey, Entry, CacheKeyHash, SHARD_COUNT> cache_ { DEFAULT_BUDGET };
+};
+} // namespace SPText
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // ROSEN_MODULES_SPTEXT_PARAGRAPH_LAYOUT_CACHE_H
@@ -24,6 +24,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "impl/paragraph_layout_cache.h"
 #include "txt/platform.h"
 #include "txt/text_style.h"
 
@@ -104,6 +105,7 @@ void FontCollection::DisableFontFallback()
     if (sktFontCollection_) {
         sktFontCollection_->disableFontFallback();
     }
+    OHOS::Rosen::SPText::ParagraphLayoutCache::Instance().Clear();
 }
 
 void FontCollection::ClearFontFamilyCache()
@@ -112,6 +114,8 @@ void FontCollection::ClearFontFamilyCache()
     if (sktFontCollection_) {
         sktFontCollection_->clearCaches();
     }
+    // loaded fonts change font fallback, so laid out paragraphs are stale
+    OHOS::Rosen::SPText::ParagraphLayoutCache::Instance().Clear();
 }
 
 sk_sp<skia::textlayout::FontCollection> FontCollection::CreateSktFontCollection()
@@ -16,9 +16,14 @@
 #ifndef CMD_LIST_H
 #define CMD_LIST_H
 
+#include <atomic>
 #include <map>
 #include <optional>
+#include <thread>
 #include <vector>
+#ifndef NDEBUG
+#include <cassert>
+#endif
 
 #include "draw/canvas.h"
 #include "recording/op_item.h"
@@ -84,7 +89,7 @@ public:
     template<typename T, typename... Args>
     void AddOp(Args&&... args)
     {
-        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        RecordingLockGuard<std::recursive_mutex> lock(*this, mutex_);
         T* op = opAllocator_.Allocate<T>(std::forward<Args>(args)...);
         if (op == nullptr) {
             return;
@@ -105,6 +110,22 @@ public:
         opCnt_++;
     }
 
+    /**
+     * @brief   Binds the CmdList to the calling thread, ops and data are added without locking until
+     *          UnbindOwnerThread is called. The CmdList must be unbound before it is handed to other threads.
+     */
+    void BindOwnerThread();
+
+    /**
+     * @brief   Unbinds the CmdList from the owner thread, locking is used again for all accesses.
+     */
+    void UnbindOwnerThread();
+
+    /**
+     * @brief   Returns true if the CmdList is bound to an owner thread.
+     */
+    bool IsOwnerThreadBound() const;
+
     /**
      * @brief       Add a contiguous buffers to the CmdList.
      * @param data  A contiguous buffers.
@@ -116,9 +137,30 @@ public:
 
     /**
      * @brief   Gets the contiguous buffers of CmdList.
+     * @detail  Ops recorded in chunks have to be flattened by FlattenOpData first, the data is nullptr otherwise.
      */
     CmdListData GetData() const;
 
+    /**
+     * @brief   Copies the ops recorded in chunks into one contiguous buffer, so that GetData can return them.
+     * @detail  Addresses of the recorded ops are invalidated, offsets stay valid. It is called by the recording
+     *          thread when the recording is finished, and again before the data is marshalled or copied.
+     * @return  true if the ops are contiguous afterwards, otherwise false.
+     */
+    bool FlattenOpData();
+
+    /**
+     * @brief       Reserves the op buffer for the ops to be recorded, used to start a recording from a buffer
+     *              which is already large enough, e.g. at the size of the last recording of the same node.
+     * @param size  The size of the ops to be recorded.
+     */
+    bool ReserveOpData(size_t size);
+
+    /**
+     * @brief   Gets the size of the ops recorded, it does not flatten the op buffer.
+     */
+    size_t GetOpDataSize() const;
+
     // using for recording, should to remove after using shared memory
     bool SetUpImageData(const void* data, size_t size);
     uint32_t AddImageData(const void* data, size_t size);
@@ -241,6 +283,35 @@ public:
 #endif
 
 protected:
+    // Locks the mutex unless the CmdList is bound to an owner thread, which is checked in debug builds.
+    template<typename Mutex>
+    class RecordingLockGuard {
+    public:
+        RecordingLockGuard(const CmdList& cmdList, Mutex& mutex)
+            : mutex_(cmdList.isOwnerThreadBound_.load(std::memory_order_acquire) ? nullptr : &mutex)
+        {
+            if (mutex_ != nullptr) {
+                mutex_->lock();
+                return;
+            }
+#ifndef NDEBUG
+            assert(cmdList.ownerThreadId_ == std::this_thread::get_id());
+#endif
+        }
+
+        ~RecordingLockGuard()
+        {
+            if (mutex_ != nullptr) {
+                mutex_->unlock();
+            }
+        }
+
+        RecordingLockGuard(const RecordingLockGuard&) = delete;
+        RecordingLockGuard& operator=(const RecordingLockGuard&) = delete;
+    private:
+        Mutex* mutex_;
+    };
+
     MemAllocator opAllocator_;
     MemAllocator imageAllocator_;
     MemAllocator bitmapAllocator_;
@@ -262,6 +333,9 @@ protected:
 #endif
     std::vector<std::shared_ptr<ExtendDrawFuncObj>> drawFuncObjVec_;
     std::mutex drawFuncObjMutex_;
+    // read without the mutex by RecordingLockGuard, while another thread may unbind the list
+    std::atomic<bool> isOwnerThreadBound_ { false };
+    std::thread::id ownerThreadId_;
 };
 } // namespace Drawing
 } // namespace Rosen
@@ -16,6 +16,7 @@
 #ifndef DRAW_CMD_H
 #define DRAW_CMD_H
 
+#include <array>
 #include <chrono>
 #include <cstdint>
 #include <ctime>
@@ -96,6 +97,7 @@ public:
         IMAGE_SNAPSHOT_OPITEM,
         SURFACEBUFFER_OPITEM,
         DRAW_FUNC_OPITEM,
+        MAX_OPITEM, // the count of op types, add new op type before it
     };
 
     static void BrushHandleToBrush(const BrushHandle& brushHandle, const DrawCmdList& cmdList, Brush& brush);
@@ -134,7 +136,8 @@ public:
     const DrawCmdList& cmdList_;
 
 private:
-    static std::unordered_map<uint32_t, UnmarshallingFunc>* opUnmarshallingFuncLUT_;
+    // indexed by op type, zero-initialized before any static registration runs
+    static std::array<UnmarshallingFunc, DrawOpItem::MAX_OPITEM> opUnmarshallingFuncLUT_;
 };
 
 class GenerateCachedOpItemPlayer {
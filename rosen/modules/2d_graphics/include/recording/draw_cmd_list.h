@@ -18,6 +18,7 @@
 
 #include "draw/canvas.h"
 #include "recording/cmd_list.h"
+#include "recording/draw_op_arena.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -76,7 +77,7 @@ public:
         if (mode_ != UnmarshalMode::IMMEDIATE) {
             return false;
         }
-        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        RecordingLockGuard<std::recursive_mutex> lock(*this, mutex_);
         T* op = opAllocator_.Allocate<T>(std::forward<Args>(args)...);
         if (op == nullptr) {
             return false;
@@ -131,6 +132,20 @@ public:
      */
     void UnmarshallingDrawOps();
 
+    /**
+     * @brief   Creates a DrawOpItem, called by the Unmarshalling function of each DrawOpItem.
+     * @detail  While UnmarshallingDrawOps is running, the op and its control block are placed in the arena of
+     *          the DrawCmdList instead of allocated on heap one by one.
+     */
+    template<typename T, typename... Args>
+    std::shared_ptr<T> MakeDrawOp(Args&&... args) const
+    {
+        if (opArena_ != nullptr) {
+            return std::allocate_shared<T>(DrawOpArenaAllocator<T>(opArena_), std::forward<Args>(args)...);
+        }
+        return std::make_shared<T>(std::forward<Args>(args)...);
+    }
+
     /**
      * @brief   Draw cmd is empty or not.
      */
@@ -204,6 +219,8 @@ private:
     const UnmarshalMode mode_;
     const uint32_t offset_ = 2 * sizeof(int32_t); // 2 is width and height.Offset of first OpItem is behind the w and h
     std::vector<std::shared_ptr<DrawOpItem>> drawOpItems_;
+    // Only set while UnmarshallingDrawOps is running, the ops keep it alive after that.
+    mutable std::shared_ptr<DrawOpArena> opArena_;
 
     size_t lastOpGenSize_ = 0;
     std::vector<std::pair<uint32_t, uint32_t>> replacedOpListForBuffer_;
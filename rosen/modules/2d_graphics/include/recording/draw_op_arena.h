@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DRAW_OP_ARENA_H
+#define DRAW_OP_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "utils/drawing_macros.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+/**
+ * @brief   Bump allocator which holds the DrawOpItems created by DrawCmdList::UnmarshallingDrawOps.
+ * @detail  Memory is never freed one by one, all blocks are returned to a process wide block pool when the arena
+ *          is destroyed. The arena is created on the Unmarshalling-Thread and usually destroyed on the thread which
+ *          drops the last op, so the blocks are not kept in the thread local MemAllocatorPool. Allocate is not
+ *          thread safe, it is only called by the Unmarshalling-Thread.
+ */
+class DRAWING_API DrawOpArena {
+public:
+    static constexpr size_t MIN_BLOCK_SIZE = 1024;
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 16 * 1024;
+    static constexpr size_t MAX_BLOCK_SIZE = 1024 * 1024;
+    static constexpr size_t MAX_POOLED_BYTES = 4 * 1024 * 1024;
+
+    /**
+     * @param blockSize The size of the first block, it is added by the first Allocate.
+     */
+    explicit DrawOpArena(size_t blockSize = DEFAULT_BLOCK_SIZE);
+    ~DrawOpArena();
+
+    /**
+     * @brief       Gets memory from the current block, a new block is added if it is not enough.
+     * @param size  The size required.
+     * @param align The alignment required, must be a power of two.
+     * @return      The address of memory, nullptr if size is 0.
+     */
+    void* Allocate(size_t size, size_t align);
+
+    /**
+     * @brief   Gets the bytes handed out by Allocate.
+     */
+    size_t GetUsedSize() const;
+
+    /**
+     * @brief   Gets the count of blocks owned by the arena.
+     */
+    size_t GetBlockCount() const;
+
+    /**
+     * @brief   Gets the bytes of the free blocks kept by the block pool, at most MAX_POOLED_BYTES.
+     */
+    static size_t GetPooledBytes();
+
+    /**
+     * @brief   Frees all blocks kept by the block pool.
+     */
+    static void PurgePool();
+
+    DrawOpArena(const DrawOpArena&) = delete;
+    DrawOpArena& operator=(const DrawOpArena&) = delete;
+private:
+    struct Block {
+        char* data;
+        size_t capacity;
+    };
+
+    void AddBlock(size_t size);
+
+    std::vector<Block> blocks_;
+    size_t blockSize_;
+    char* cur_ = nullptr;
+    size_t remaining_ = 0;
+    size_t usedSize_ = 0;
+};
+
+/**
+ * @brief   Allocator used by std::allocate_shared to place a DrawOpItem and its control block in a DrawOpArena.
+ * @detail  Every allocator keeps the arena alive, so the arena is destroyed with the last DrawOpItem in it.
+ */
+template<typename T>
+class DrawOpArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit DrawOpArenaAllocator(std::shared_ptr<DrawOpArena> arena) : arena_(std::move(arena)) {}
+
+    template<typename U>
+    DrawOpArenaAllocator(const DrawOpArenaAllocator<U>& other) : arena_(other.arena_) {}
+
+    T* allocate(size_t n)
+    {
+        return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) {}
+
+    template<typename U>
+    bool operator==(const DrawOpArenaAllocator<U>& other) const
+    {
+        return arena_ == other.arena_;
+    }
+
+    template<typename U>
+    bool operator!=(const DrawOpArenaAllocator<U>& other) const
+    {
+        return arena_ != other.arena_;
+    }
+
+private:
+    template<typename U>
+    friend class DrawOpArenaAllocator;
+
+    std::shared_ptr<DrawOpArena> arena_;
+};
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // DRAW_OP_ARENA_H
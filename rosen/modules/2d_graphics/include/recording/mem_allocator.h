@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <mutex>
+#include <vector>
 #include "utils/drawing_macros.h"
 
 namespace OHOS {
@@ -31,6 +32,20 @@ public:
     MemAllocator();
     ~MemAllocator();
 
+    /**
+     * @brief           Switches between the contiguous mode and the chunked mode.
+     * @param chunked   In chunked mode the buffer grows by appending chunks instead of reallocating,
+     *                  so recorded data is never moved or copied while recording. Offsets stay stable
+     *                  and the chunks are copied into one contiguous buffer only when Flatten is called.
+     *                  Chunks are taken from and returned to the MemAllocatorPool of the calling thread.
+     */
+    void SetChunked(bool chunked);
+
+    /**
+     * @brief   Returns true if the memory allocator is in chunked mode.
+     */
+    bool IsChunked() const;
+
     /**
      * @brief       Creates a read-only memory allocator form a read-only buffer that will not be freed when destroyed.
      * @param data  A read-only buffer.
@@ -47,6 +62,17 @@ public:
      */
     bool BuildFromDataWithCopy(const void* data, size_t size);
 
+    /**
+     * @brief       Reserves memory for the data to be added, so that the memory allocator does not need to
+     *              grow step by step when the final size is known in advance.
+     *              In chunked mode a single chunk is replaced by one large enough for all the data, so that
+     *              the data stays contiguous. Offsets stay valid but addresses returned before are not, so it
+     *              should be called before recording starts.
+     * @param size  The size to be added.
+     * @return      true if reserve succeeded, otherwise false.
+     */
+    bool Reserve(size_t size);
+
     /**
      * @brief   Creates an object of T from a contiguous buffer in the memory allocator.
      * @param T     The name of object class.
@@ -62,12 +88,12 @@ public:
 
         if (capacity_ - size_ < sizeof(T)) {
             // The capacity is not enough, expand the capacity
-            if (Resize((capacity_ + sizeof(T)) * MEMORY_EXPANSION_FACTOR) == false) {
+            if (Expand(sizeof(T)) == false) {
                 return nullptr;
             }
         }
         T* obj = nullptr;
-        void* addr = static_cast<void*>(startPtr_ + size_);
+        void* addr = static_cast<void*>(tailPtr_ + (size_ - tailOffset_));
         obj = new (addr) T{std::forward<Args>(args)...};
         if (obj) {
             size_ += sizeof(T);
@@ -87,8 +113,17 @@ public:
      */
     size_t GetSize() const;
 
+    /**
+     * @brief   Copies all chunks into one contiguous buffer and frees them, offsets stay valid.
+     * @detail  Addresses returned before are invalidated, so it must be called by the thread which records,
+     *          or under the lock which guards the recording, and never while the data is being read.
+     * @return  true if the data is contiguous afterwards, otherwise false.
+     */
+    bool Flatten();
+
     /**
      * @brief Gets the address of the contiguous memory buffer held by MemAllocator.
+     * In chunked mode it returns nullptr while the data is held by more than one chunk, see Flatten.
      */
     const void* GetData() const;
 
@@ -112,13 +147,27 @@ public:
     MemAllocator& operator=(MemAllocator&&) = delete;
     MemAllocator& operator=(const MemAllocator&) = default;
 private:
+    struct Chunk {
+        char* data;     // Points to the beginning of the chunk
+        size_t offset;  // The offset of the chunk in the whole buffer
+        size_t size;    // The size of the chunk
+    };
+
+    bool Expand(size_t size);
     bool Resize(size_t size);
+    bool AddChunk(size_t size);
+    bool ReplaceChunk(size_t size);
+    void FreeData();
     void Clear();
 
     bool isReadOnly_;
+    bool isChunked_;
     size_t capacity_;   // The size of the memory block
     size_t size_;       // The size already used
     char* startPtr_;    // Points to the beginning of the memory block
+    char* tailPtr_;     // Points to the beginning of the block being written
+    size_t tailOffset_; // The offset of the block being written
+    std::vector<Chunk> chunks_; // Only used in chunked mode, sorted by offset
 };
 } // namespace Drawing
 } // namespace Rosen
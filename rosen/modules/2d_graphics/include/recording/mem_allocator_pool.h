@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MEM_ALLOCATOR_POOL_H
+#define MEM_ALLOCATOR_POOL_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "utils/drawing_macros.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+/**
+ * @brief   Thread-local pool of the buffers used by MemAllocator in chunked mode.
+ * @detail  Buffers are grouped by power of two size classes, a buffer released to the pool is reused by
+ *          the next recording on the same thread which needs a buffer of the same size class. Each pool is
+ *          bounded by its own limit, and the pools of all threads together by a process wide limit.
+ */
+class DRAWING_API MemAllocatorPool {
+public:
+    static constexpr size_t MIN_SIZE_CLASS_SHIFT = 10;  // 1KB
+    static constexpr size_t MAX_SIZE_CLASS_SHIFT = 24;  // 16MB
+    static constexpr size_t SIZE_CLASS_COUNT = MAX_SIZE_CLASS_SHIFT - MIN_SIZE_CLASS_SHIFT + 1;
+    static constexpr size_t DEFAULT_MAX_RETAINED_BYTES = 8 * 1024 * 1024;
+    static constexpr size_t DEFAULT_MAX_PROCESS_RETAINED_BYTES = 16 * 1024 * 1024;
+
+    struct Statistics {
+        uint64_t hitCount = 0;
+        uint64_t missCount = 0;
+        size_t retainedBytes = 0;
+        size_t maxRetainedBytes = 0;
+        size_t processRetainedBytes = 0;
+    };
+
+    /**
+     * @brief   Gets the pool of the calling thread.
+     */
+    static MemAllocatorPool& GetInstance();
+
+    /**
+     * @brief           Gets a buffer which can hold at least size bytes.
+     * @param size      The size required.
+     * @param capacity  Returns the real size of the buffer.
+     * @return          The buffer, it must be returned by Release or freed by delete[].
+     */
+    static char* Acquire(size_t size, size_t& capacity);
+
+    /**
+     * @brief           Returns a buffer to the pool, it is freed if the pool is full.
+     * @param data      The buffer allocated by new char[].
+     * @param capacity  The size of the buffer.
+     */
+    static void Release(char* data, size_t capacity);
+
+    /**
+     * @brief   Sets the upper limit of bytes retained by the pool, buffers over the limit are freed.
+     */
+    void SetMaxRetainedBytes(size_t maxRetainedBytes);
+
+    /**
+     * @brief   Sets the upper limit of bytes retained by the pools of all threads, buffers released over the
+     *          limit are freed. Buffers already retained by other threads are kept until they are acquired.
+     */
+    static void SetMaxProcessRetainedBytes(size_t maxRetainedBytes);
+
+    /**
+     * @brief   Frees all buffers retained by the pool.
+     */
+    void Purge();
+
+    Statistics GetStatistics() const;
+
+    ~MemAllocatorPool();
+
+    MemAllocatorPool(const MemAllocatorPool&) = delete;
+    MemAllocatorPool& operator=(const MemAllocatorPool&) = delete;
+private:
+    MemAllocatorPool() = default;
+
+    char* AcquireImpl(size_t size, size_t& capacity);
+    void ReleaseImpl(char* data, size_t capacity);
+
+    std::array<std::vector<std::pair<char*, size_t>>, SIZE_CLASS_COUNT> buffers_;
+    size_t retainedBytes_ = 0;
+    size_t maxRetainedBytes_ = DEFAULT_MAX_RETAINED_BYTES;
+    uint64_t hitCount_ = 0;
+    uint64_t missCount_ = 0;
+};
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // MEM_ALLOCATOR_POOL_H
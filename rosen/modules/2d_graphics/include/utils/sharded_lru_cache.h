@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SHARDED_LRU_CACHE_H
+#define SHARDED_LRU_CACHE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace OHOS {
+namespace Rosen {
+struct LruCacheStatistics {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t entries = 0;
+    size_t bytes = 0;
+};
+
+/**
+ * LRU cache bounded by the estimated bytes of its values, used by the text layout caches. The keys are spread over
+ * SHARD_COUNT shards with a lock each, and every shard gets an equal part of the budget. Values are handed out as
+ * shared pointers, so the ones dropped by the cache are destroyed after the shard is unlocked.
+ */
+template<typename Key, typename Value, typename Hash, size_t SHARD_COUNT>
+class ShardedLruCache {
+public:
+    explicit ShardedLruCache(size_t budget) : budget_(budget) {}
+    ~ShardedLruCache() = default;
+    ShardedLruCache(const ShardedLruCache&) = delete;
+    ShardedLruCache& operator=(const ShardedLruCache&) = delete;
+
+    std::shared_ptr<Value> Find(const Key& key)
+    {
+        auto& shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.nodes.find(key);
+        if (it == shard.nodes.end()) {
+            misses_++;
+            return nullptr;
+        }
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second.lruIter);
+        hits_++;
+        return it->second.value;
+    }
+
+    // replaces the value cached for key, values larger than GetShardBudget() are not cached
+    void Insert(const Key& key, std::shared_ptr<Value> value, size_t bytes)
+    {
+        size_t shardBudget = GetShardBudget();
+        if (value == nullptr || bytes > shardBudget) {
+            return;
+        }
+        std::vector<std::shared_ptr<Value>> dropped;
+        auto& shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto [it, inserted] = shard.nodes.try_emplace(key);
+        if (inserted) {
+            shard.lru.push_front(&it->first);
+            it->second.lruIter = shard.lru.begin();
+        } else {
+            shard.bytes -= it->second.bytes;
+            dropped.push_back(std::move(it->second.value));
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second.lruIter);
+        }
+        it->second.value = std::move(value);
+        it->second.bytes = bytes;
+        shard.bytes += bytes;
+        EvictLocked(shard, shardBudget, dropped);
+    }
+
+    // erases key only while it still maps to value, another thread may have replaced it meanwhile
+    void Erase(const Key& key, const Value* value)
+    {
+        std::shared_ptr<Value> erased;
+        auto& shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.nodes.find(key);
+        if (it == shard.nodes.end() || it->second.value.get() != value) {
+            return;
+        }
+        erased = std::move(it->second.value);
+        shard.bytes -= it->second.bytes;
+        shard.lru.erase(it->second.lruIter);
+        shard.nodes.erase(it);
+    }
+
+    void Clear()
+    {
+        for (auto& shard : shards_) {
+            std::unordered_map<Key, Node, Hash> nodes;
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.lru.clear();
+            shard.nodes.swap(nodes);
+            shard.bytes = 0;
+        }
+    }
+
+    // budget in bytes, 0 disables the cache
+    void SetBudget(size_t bytes)
+    {
+        budget_ = bytes;
+        std::vector<std::shared_ptr<Value>> dropped;
+        for (auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            EvictLocked(shard, bytes / SHARD_COUNT, dropped);
+        }
+    }
+
+    size_t GetShardBudget() const
+    {
+        return budget_ / SHARD_COUNT;
+    }
+
+    LruCacheStatistics GetStatistics()
+    {
+        LruCacheStatistics statistics;
+        statistics.hits = hits_;
+        statistics.misses = misses_;
+        statistics.evictions = evictions_;
+        for (auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            statistics.entries += shard.nodes.size();
+            statistics.bytes += shard.bytes;
+        }
+        return statistics;
+    }
+
+private:
+    struct Node {
+        std::shared_ptr<Value> value;
+        size_t bytes = 0;
+        typename std::list<const Key*>::iterator lruIter;
+    };
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<Key, Node, Hash> nodes;
+        // front is the most recently used key, the pointers refer to the keys stored in nodes
+        std::list<const Key*> lru;
+        size_t bytes = 0;
+    };
+
+    Shard& GetShard(const Key& key)
+    {
+        // unordered_map picks its buckets with the low bits of the same hash
+        return shards_[(Hash()(key) >> (sizeof(size_t) * 4)) % SHARD_COUNT];
+    }
+
+    void EvictLocked(Shard& shard, size_t budget, std::vector<std::shared_ptr<Value>>& dropped)
+    {
+        while (shard.bytes > budget && !shard.lru.empty()) {
+            auto it = shard.nodes.find(*shard.lru.back());
+            shard.lru.pop_back();
+            shard.bytes -= it->second.bytes;
+            dropped.push_back(std::move(it->second.value));
+            shard.nodes.erase(it);
+            evictions_++;
+        }
+    }
+
+    std::array<Shard, SHARD_COUNT> shards_;
+    std::atomic<size_t> budget_;
+    std::atomic<uint64_t> hits_ = 0;
+    std::atomic<uint64_t> misses_ = 0;
+    std::atomic<uint64_t> evictions_ = 0;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // SHARDED_LRU_CACHE_H
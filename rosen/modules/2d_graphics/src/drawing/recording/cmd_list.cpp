@@ -36,9 +36,31 @@ CmdList::~CmdList()
 #endif
 }
 
-uint32_t CmdList::AddCmdListData(const CmdListData& data)
+void CmdList::BindOwnerThread()
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    ownerThreadId_ = std::this_thread::get_id();
+    isOwnerThreadBound_.store(true, std::memory_order_release);
+}
+
+void CmdList::UnbindOwnerThread()
 {
+    if (!isOwnerThreadBound_.load(std::memory_order_acquire)) {
+        return;
+    }
     std::lock_guard<std::recursive_mutex> lock(mutex_);
+    isOwnerThreadBound_.store(false, std::memory_order_release);
+    ownerThreadId_ = std::thread::id();
+}
+
+bool CmdList::IsOwnerThreadBound() const
+{
+    return isOwnerThreadBound_.load(std::memory_order_acquire);
+}
+
+uint32_t CmdList::AddCmdListData(const CmdListData& data)
+{
+    RecordingLockGuard<std::recursive_mutex> lock(*this, mutex_);
     if (!lastOpItemOffset_.has_value()) {
         void* op = opAllocator_.Allocate<OpItem>(OPITEM_HEAD);
         if (op == nullptr) {
@@ -65,6 +87,23 @@ CmdListData CmdList::GetData() const
     return std::make_pair(opAllocator_.GetData(), opAllocator_.GetSize());
 }
 
+bool CmdList::FlattenOpData()
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    return opAllocator_.Flatten();
+}
+
+bool CmdList::ReserveOpData(size_t size)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    return opAllocator_.Reserve(size);
+}
+
+size_t CmdList::GetOpDataSize() const
+{
+    return opAllocator_.GetSize();
+}
+
 bool CmdList::SetUpImageData(const void* data, size_t size)
 {
     return imageAllocator_.BuildFromDataWithCopy(data, size);
@@ -72,7 +111,7 @@ bool CmdList::SetUpImageData(const void* data, size_t size)
 
 uint32_t CmdList::AddImageData(const void* data, size_t size)
 {
-    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    RecordingLockGuard<std::recursive_mutex> lock(*this, mutex_);
     void* addr = imageAllocator_.Add(data, size);
     if (addr == nullptr) {
         LOGD("CmdList AddImageData failed!");
@@ -93,7 +132,7 @@ CmdListData CmdList::GetAllImageData() const
 
 OpDataHandle CmdList::AddImage(const Image& image)
 {
-    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    RecordingLockGuard<std::recursive_mutex> lock(*this, mutex_);
     OpDataHandle ret = {0, 0};
     uint32_t uniqueId = image.GetUniqueID();
 
@@ -151,7 +190,7 @@ std::shared_ptr<Image> CmdList::GetImage(const OpDataHandle& imageHandle)
 
 uint32_t CmdList::AddBitmapData(const void* data, size_t size)
 {
-    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    RecordingLockGuard<std::recursive_mutex> lock(*this, mutex_);
     void* addr = bitmapAllocator_.Add(data, size);
     if (addr == nullptr) {
         LOGD("CmdList AddImageData failed!");
@@ -177,7 +216,7 @@ CmdListData CmdList::GetAllBitmapData() const
 
 uint32_t CmdList::AddExtendObject(const std::shared_ptr<ExtendObject>& object)
 {
-    std::lock_guard<std::mutex> lock(extendObjectMutex_);
+    RecordingLockGuard<std::mutex> lock(*this, extendObjectMutex_);
     extendObjectVec_.emplace_back(object);
     return static_cast<uint32_t>(extendObjectVec_.size()) - 1;
 }
@@ -211,7 +250,7 @@ uint32_t CmdList::SetupExtendObject(const std::vector<std::shared_ptr<ExtendObje
 
 uint32_t CmdList::AddImageObject(const std::shared_ptr<ExtendImageObject>& object)
 {
-    std::lock_guard<std::mutex> lock(imageObjectMutex_);
+    RecordingLockGuard<std::mutex> lock(*this, imageObjectMutex_);
     imageObjectVec_.emplace_back(object);
     return static_cast<uint32_t>(imageObjectVec_.size()) - 1;
 }
@@ -245,7 +284,7 @@ uint32_t CmdList::SetupObject(const std::vector<std::shared_ptr<ExtendImageObjec
 
 uint32_t CmdList::AddImageBaseObj(const std::shared_ptr<ExtendImageBaseObj>& object)
 {
-    std::lock_guard<std::mutex> lock(imageBaseObjMutex_);
+    RecordingLockGuard<std::mutex> lock(*this, imageBaseObjMutex_);
     imageBaseObjVec_.emplace_back(object);
     return static_cast<uint32_t>(imageBaseObjVec_.size()) - 1;
 }
@@ -293,7 +332,7 @@ uint32_t CmdList::GetOpCnt() const
 #ifdef ROSEN_OHOS
 uint32_t CmdList::AddSurfaceBuffer(const sptr<SurfaceBuffer>& surfaceBuffer)
 {
-    std::lock_guard<std::mutex> lock(surfaceBufferMutex_);
+    RecordingLockGuard<std::mutex> lock(*this, surfaceBufferMutex_);
     surfaceBufferVec_.emplace_back(surfaceBuffer);
     return static_cast<uint32_t>(surfaceBufferVec_.size()) - 1;
 }
@@ -328,7 +367,7 @@ uint32_t CmdList::SetupSurfaceBuffer(const std::vector<sptr<SurfaceBuffer>>& obj
 
 uint32_t CmdList::AddDrawFuncOjb(const std::shared_ptr<ExtendDrawFuncObj> &object)
 {
-    std::lock_guard<std::mutex> lock(drawFuncObjMutex_);
+    RecordingLockGuard<std::mutex> lock(*this, drawFuncObjMutex_);
     drawFuncObjVec_.emplace_back(object);
     return static_cast<uint32_t>(drawFuncObjVec_.size()) - 1;
 }
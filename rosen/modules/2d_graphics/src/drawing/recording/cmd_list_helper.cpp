@@ -242,6 +242,7 @@ CmdListHandle CmdListHelper::AddChildToCmdList(CmdList& cmdList, const std::shar
 
     childHandle.type = child->GetType();
 
+    child->FlattenOpData();
     auto childData = child->GetData();
     if (childData.first != nullptr && childData.second != 0) {
         childHandle.offset = cmdList.AddCmdListData(childData);
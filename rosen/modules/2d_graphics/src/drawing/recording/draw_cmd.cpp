@@ -307,33 +307,35 @@ bool GenerateCachedOpItemPlayer::GenerateCachedOpItem(uint32_t type, void* handl
 }
 
 /* UnmarshallingPlayer */
-std::unordered_map<uint32_t, UnmarshallingPlayer::UnmarshallingFunc>*
-    UnmarshallingPlayer::opUnmarshallingFuncLUT_ = nullptr;
+std::array<UnmarshallingPlayer::UnmarshallingFunc, DrawOpItem::MAX_OPITEM>
+    UnmarshallingPlayer::opUnmarshallingFuncLUT_ = {};
 
 bool UnmarshallingPlayer::RegisterUnmarshallingFunc(uint32_t type, UnmarshallingPlayer::UnmarshallingFunc func)
 {
-    if (!opUnmarshallingFuncLUT_) {
-        static std::unordered_map<uint32_t, UnmarshallingPlayer::UnmarshallingFunc> opUnmarshallingFuncLUT = {};
-        opUnmarshallingFuncLUT_ = &opUnmarshallingFuncLUT;
+    if (type >= DrawOpItem::MAX_OPITEM) {
+        LOGE("UnmarshallingPlayer::RegisterUnmarshallingFunc, invalid op type %{public}u", type);
+        return false;
     }
     std::unique_lock<std::mutex> lock(UnmarshallingFuncMapMutex_);
-    return opUnmarshallingFuncLUT_->emplace(type, func).second;
+    if (opUnmarshallingFuncLUT_[type] != nullptr) {
+        return false;
+    }
+    opUnmarshallingFuncLUT_[type] = func;
+    return true;
 }
 
 UnmarshallingPlayer::UnmarshallingPlayer(const DrawCmdList& cmdList) : cmdList_(cmdList) {}
 
 std::shared_ptr<DrawOpItem> UnmarshallingPlayer::Unmarshalling(uint32_t type, void* handle)
 {
-    if (type == DrawOpItem::OPITEM_HEAD || !opUnmarshallingFuncLUT_) {
+    if (type == DrawOpItem::OPITEM_HEAD || type >= DrawOpItem::MAX_OPITEM) {
         return nullptr;
     }
 
-    auto it = opUnmarshallingFuncLUT_->find(type);
-    if (it == opUnmarshallingFuncLUT_->end() || it->second == nullptr) {
+    auto func = opUnmarshallingFuncLUT_[type];
+    if (func == nullptr) {
         return nullptr;
     }
-
-    auto func = it->second;
     return (*func)(this->cmdList_, handle);
 }
 
@@ -352,7 +354,7 @@ DrawPointOpItem::DrawPointOpItem(const DrawCmdList& cmdList, DrawPointOpItem::Co
 
 std::shared_ptr<DrawOpItem> DrawPointOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawPointOpItem>(cmdList, static_cast<DrawPointOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawPointOpItem>(cmdList, static_cast<DrawPointOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawPointOpItem::Marshalling(DrawCmdList& cmdList)
@@ -379,7 +381,7 @@ DrawPointsOpItem::DrawPointsOpItem(const DrawCmdList& cmdList, DrawPointsOpItem:
 
 std::shared_ptr<DrawOpItem> DrawPointsOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawPointsOpItem>(cmdList, static_cast<DrawPointsOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawPointsOpItem>(cmdList, static_cast<DrawPointsOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawPointsOpItem::Marshalling(DrawCmdList& cmdList)
@@ -405,7 +407,7 @@ DrawLineOpItem::DrawLineOpItem(const DrawCmdList& cmdList, DrawLineOpItem::Const
 
 std::shared_ptr<DrawOpItem> DrawLineOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawLineOpItem>(cmdList, static_cast<DrawLineOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawLineOpItem>(cmdList, static_cast<DrawLineOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawLineOpItem::Marshalling(DrawCmdList& cmdList)
@@ -429,7 +431,7 @@ DrawRectOpItem::DrawRectOpItem(const DrawCmdList& cmdList, DrawRectOpItem::Const
 
 std::shared_ptr<DrawOpItem> DrawRectOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawRectOpItem>(cmdList, static_cast<DrawRectOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawRectOpItem>(cmdList, static_cast<DrawRectOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawRectOpItem::Marshalling(DrawCmdList& cmdList)
@@ -453,7 +455,8 @@ DrawRoundRectOpItem::DrawRoundRectOpItem(const DrawCmdList& cmdList, DrawRoundRe
 
 std::shared_ptr<DrawOpItem> DrawRoundRectOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawRoundRectOpItem>(cmdList, static_cast<DrawRoundRectOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawRoundRectOpItem>(
+        cmdList, static_cast<DrawRoundRectOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawRoundRectOpItem::Marshalling(DrawCmdList& cmdList)
@@ -480,7 +483,7 @@ DrawNestedRoundRectOpItem::DrawNestedRoundRectOpItem(
 
 std::shared_ptr<DrawOpItem> DrawNestedRoundRectOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawNestedRoundRectOpItem>(
+    return cmdList.MakeDrawOp<DrawNestedRoundRectOpItem>(
         cmdList, static_cast<DrawNestedRoundRectOpItem::ConstructorHandle*>(handle));
 }
 
@@ -506,7 +509,7 @@ DrawArcOpItem::DrawArcOpItem(const DrawCmdList& cmdList, DrawArcOpItem::Construc
 
 std::shared_ptr<DrawOpItem> DrawArcOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawArcOpItem>(cmdList, static_cast<DrawArcOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawArcOpItem>(cmdList, static_cast<DrawArcOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawArcOpItem::Marshalling(DrawCmdList& cmdList)
@@ -531,7 +534,7 @@ DrawPieOpItem::DrawPieOpItem(const DrawCmdList& cmdList, DrawPieOpItem::Construc
 
 std::shared_ptr<DrawOpItem> DrawPieOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawPieOpItem>(cmdList, static_cast<DrawPieOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawPieOpItem>(cmdList, static_cast<DrawPieOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawPieOpItem::Marshalling(DrawCmdList& cmdList)
@@ -555,7 +558,7 @@ DrawOvalOpItem::DrawOvalOpItem(const DrawCmdList& cmdList, DrawOvalOpItem::Const
 
 std::shared_ptr<DrawOpItem> DrawOvalOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawOvalOpItem>(cmdList, static_cast<DrawOvalOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawOvalOpItem>(cmdList, static_cast<DrawOvalOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawOvalOpItem::Marshalling(DrawCmdList& cmdList)
@@ -580,7 +583,7 @@ DrawCircleOpItem::DrawCircleOpItem(const DrawCmdList& cmdList, DrawCircleOpItem:
 
 std::shared_ptr<DrawOpItem> DrawCircleOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawCircleOpItem>(cmdList, static_cast<DrawCircleOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawCircleOpItem>(cmdList, static_cast<DrawCircleOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawCircleOpItem::Marshalling(DrawCmdList& cmdList)
@@ -607,7 +610,7 @@ DrawPathOpItem::DrawPathOpItem(const DrawCmdList& cmdList, DrawPathOpItem::Const
 
 std::shared_ptr<DrawOpItem> DrawPathOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawPathOpItem>(cmdList, static_cast<DrawPathOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawPathOpItem>(cmdList, static_cast<DrawPathOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawPathOpItem::Marshalling(DrawCmdList& cmdList)
@@ -639,7 +642,7 @@ DrawBackgroundOpItem::DrawBackgroundOpItem(const DrawCmdList& cmdList, DrawBackg
 
 std::shared_ptr<DrawOpItem> DrawBackgroundOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawBackgroundOpItem>(
+    return cmdList.MakeDrawOp<DrawBackgroundOpItem>(
         cmdList, static_cast<DrawBackgroundOpItem::ConstructorHandle*>(handle));
 }
 
@@ -674,7 +677,7 @@ DrawShadowStyleOpItem::DrawShadowStyleOpItem(
 
 std::shared_ptr<DrawOpItem> DrawShadowStyleOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawShadowStyleOpItem>(
+    return cmdList.MakeDrawOp<DrawShadowStyleOpItem>(
         cmdList, static_cast<DrawShadowStyleOpItem::ConstructorHandle*>(handle));
 }
 
@@ -708,7 +711,7 @@ DrawShadowOpItem::DrawShadowOpItem(const DrawCmdList& cmdList, DrawShadowOpItem:
 
 std::shared_ptr<DrawOpItem> DrawShadowOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawShadowOpItem>(cmdList, static_cast<DrawShadowOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawShadowOpItem>(cmdList, static_cast<DrawShadowOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawShadowOpItem::Marshalling(DrawCmdList& cmdList)
@@ -739,7 +742,7 @@ DrawRegionOpItem::DrawRegionOpItem(const DrawCmdList& cmdList, DrawRegionOpItem:
 
 std::shared_ptr<DrawOpItem> DrawRegionOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawRegionOpItem>(cmdList, static_cast<DrawRegionOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawRegionOpItem>(cmdList, static_cast<DrawRegionOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawRegionOpItem::Marshalling(DrawCmdList& cmdList)
@@ -771,7 +774,7 @@ DrawVerticesOpItem::DrawVerticesOpItem(const DrawCmdList& cmdList, DrawVerticesO
 
 std::shared_ptr<DrawOpItem> DrawVerticesOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawVerticesOpItem>(cmdList, static_cast<DrawVerticesOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawVerticesOpItem>(cmdList, static_cast<DrawVerticesOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawVerticesOpItem::Marshalling(DrawCmdList& cmdList)
@@ -800,7 +803,7 @@ DrawColorOpItem::DrawColorOpItem(DrawColorOpItem::ConstructorHandle* handle)
 
 std::shared_ptr<DrawOpItem> DrawColorOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawColorOpItem>(static_cast<DrawColorOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawColorOpItem>(static_cast<DrawColorOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawColorOpItem::Marshalling(DrawCmdList& cmdList)
@@ -831,7 +834,8 @@ DrawImageNineOpItem::DrawImageNineOpItem(const DrawCmdList& cmdList, DrawImageNi
 
 std::shared_ptr<DrawOpItem> DrawImageNineOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawImageNineOpItem>(cmdList, static_cast<DrawImageNineOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawImageNineOpItem>(
+        cmdList, static_cast<DrawImageNineOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawImageNineOpItem::Marshalling(DrawCmdList& cmdList)
@@ -872,7 +876,7 @@ DrawImageLatticeOpItem::DrawImageLatticeOpItem(
 
 std::shared_ptr<DrawOpItem> DrawImageLatticeOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawImageLatticeOpItem>(
+    return cmdList.MakeDrawOp<DrawImageLatticeOpItem>(
         cmdList, static_cast<DrawImageLatticeOpItem::ConstructorHandle*>(handle));
 }
 
@@ -913,7 +917,7 @@ DrawAtlasOpItem::DrawAtlasOpItem(const DrawCmdList& cmdList, DrawAtlasOpItem::Co
 
 std::shared_ptr<DrawOpItem> DrawAtlasOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawAtlasOpItem>(cmdList, static_cast<DrawAtlasOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawAtlasOpItem>(cmdList, static_cast<DrawAtlasOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawAtlasOpItem::Marshalling(DrawCmdList& cmdList)
@@ -951,7 +955,7 @@ DrawBitmapOpItem::DrawBitmapOpItem(const DrawCmdList& cmdList, DrawBitmapOpItem:
 
 std::shared_ptr<DrawOpItem> DrawBitmapOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawBitmapOpItem>(cmdList, static_cast<DrawBitmapOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawBitmapOpItem>(cmdList, static_cast<DrawBitmapOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawBitmapOpItem::Marshalling(DrawCmdList& cmdList)
@@ -987,7 +991,7 @@ DrawImageOpItem::DrawImageOpItem(const DrawCmdList& cmdList, DrawImageOpItem::Co
 
 std::shared_ptr<DrawOpItem> DrawImageOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawImageOpItem>(cmdList, static_cast<DrawImageOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawImageOpItem>(cmdList, static_cast<DrawImageOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawImageOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1034,7 +1038,8 @@ DrawImageRectOpItem::DrawImageRectOpItem(const Image& image, const Rect& src,
 
 std::shared_ptr<DrawOpItem> DrawImageRectOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawImageRectOpItem>(cmdList, static_cast<DrawImageRectOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawImageRectOpItem>(
+        cmdList, static_cast<DrawImageRectOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawImageRectOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1078,7 +1083,7 @@ DrawPictureOpItem::DrawPictureOpItem(const DrawCmdList& cmdList, DrawPictureOpIt
 
 std::shared_ptr<DrawOpItem> DrawPictureOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawPictureOpItem>(cmdList, static_cast<DrawPictureOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawPictureOpItem>(cmdList, static_cast<DrawPictureOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawPictureOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1123,7 +1128,7 @@ DrawTextBlobOpItem::DrawTextBlobOpItem(const DrawCmdList& cmdList, DrawTextBlobO
 
 std::shared_ptr<DrawOpItem> DrawTextBlobOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawTextBlobOpItem>(cmdList, static_cast<DrawTextBlobOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawTextBlobOpItem>(cmdList, static_cast<DrawTextBlobOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawTextBlobOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1407,7 +1412,7 @@ DrawSymbolOpItem::DrawSymbolOpItem(const DrawCmdList& cmdList, DrawSymbolOpItem:
 
 std::shared_ptr<DrawOpItem> DrawSymbolOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawSymbolOpItem>(cmdList, static_cast<DrawSymbolOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawSymbolOpItem>(cmdList, static_cast<DrawSymbolOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawSymbolOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1493,7 +1498,7 @@ ClipRectOpItem::ClipRectOpItem(ClipRectOpItem::ConstructorHandle* handle)
 
 std::shared_ptr<DrawOpItem> ClipRectOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<ClipRectOpItem>(static_cast<ClipRectOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<ClipRectOpItem>(static_cast<ClipRectOpItem::ConstructorHandle*>(handle));
 }
 
 void ClipRectOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1514,7 +1519,7 @@ ClipIRectOpItem::ClipIRectOpItem(ClipIRectOpItem::ConstructorHandle* handle)
 
 std::shared_ptr<DrawOpItem> ClipIRectOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<ClipIRectOpItem>(static_cast<ClipIRectOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<ClipIRectOpItem>(static_cast<ClipIRectOpItem::ConstructorHandle*>(handle));
 }
 
 void ClipIRectOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1536,7 +1541,7 @@ ClipRoundRectOpItem::ClipRoundRectOpItem(ClipRoundRectOpItem::ConstructorHandle*
 
 std::shared_ptr<DrawOpItem> ClipRoundRectOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<ClipRoundRectOpItem>(static_cast<ClipRoundRectOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<ClipRoundRectOpItem>(static_cast<ClipRoundRectOpItem::ConstructorHandle*>(handle));
 }
 
 void ClipRoundRectOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1560,7 +1565,7 @@ ClipPathOpItem::ClipPathOpItem(const DrawCmdList& cmdList, ClipPathOpItem::Const
 
 std::shared_ptr<DrawOpItem> ClipPathOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<ClipPathOpItem>(cmdList, static_cast<ClipPathOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<ClipPathOpItem>(cmdList, static_cast<ClipPathOpItem::ConstructorHandle*>(handle));
 }
 
 void ClipPathOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1589,7 +1594,7 @@ ClipRegionOpItem::ClipRegionOpItem(const DrawCmdList& cmdList, ClipRegionOpItem:
 
 std::shared_ptr<DrawOpItem> ClipRegionOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<ClipRegionOpItem>(cmdList, static_cast<ClipRegionOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<ClipRegionOpItem>(cmdList, static_cast<ClipRegionOpItem::ConstructorHandle*>(handle));
 }
 
 void ClipRegionOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1617,7 +1622,7 @@ SetMatrixOpItem::SetMatrixOpItem(SetMatrixOpItem::ConstructorHandle* handle) : D
 
 std::shared_ptr<DrawOpItem> SetMatrixOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<SetMatrixOpItem>(static_cast<SetMatrixOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<SetMatrixOpItem>(static_cast<SetMatrixOpItem::ConstructorHandle*>(handle));
 }
 
 void SetMatrixOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1639,7 +1644,7 @@ ResetMatrixOpItem::ResetMatrixOpItem() : DrawOpItem(RESET_MATRIX_OPITEM) {}
 
 std::shared_ptr<DrawOpItem> ResetMatrixOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<ResetMatrixOpItem>();
+    return cmdList.MakeDrawOp<ResetMatrixOpItem>();
 }
 
 void ResetMatrixOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1662,7 +1667,7 @@ ConcatMatrixOpItem::ConcatMatrixOpItem(ConcatMatrixOpItem::ConstructorHandle* ha
 
 std::shared_ptr<DrawOpItem> ConcatMatrixOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<ConcatMatrixOpItem>(static_cast<ConcatMatrixOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<ConcatMatrixOpItem>(static_cast<ConcatMatrixOpItem::ConstructorHandle*>(handle));
 }
 
 void ConcatMatrixOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1685,7 +1690,7 @@ TranslateOpItem::TranslateOpItem(TranslateOpItem::ConstructorHandle* handle)
 
 std::shared_ptr<DrawOpItem> TranslateOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<TranslateOpItem>(static_cast<TranslateOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<TranslateOpItem>(static_cast<TranslateOpItem::ConstructorHandle*>(handle));
 }
 
 void TranslateOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1706,7 +1711,7 @@ ScaleOpItem::ScaleOpItem(ScaleOpItem::ConstructorHandle* handle)
 
 std::shared_ptr<DrawOpItem> ScaleOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<ScaleOpItem>(static_cast<ScaleOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<ScaleOpItem>(static_cast<ScaleOpItem::ConstructorHandle*>(handle));
 }
 
 void ScaleOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1727,7 +1732,7 @@ RotateOpItem::RotateOpItem(RotateOpItem::ConstructorHandle* handle)
 
 std::shared_ptr<DrawOpItem> RotateOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<RotateOpItem>(static_cast<RotateOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<RotateOpItem>(static_cast<RotateOpItem::ConstructorHandle*>(handle));
 }
 
 void RotateOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1748,7 +1753,7 @@ ShearOpItem::ShearOpItem(ShearOpItem::ConstructorHandle* handle)
 
 std::shared_ptr<DrawOpItem> ShearOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<ShearOpItem>(static_cast<ShearOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<ShearOpItem>(static_cast<ShearOpItem::ConstructorHandle*>(handle));
 }
 
 void ShearOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1768,7 +1773,7 @@ FlushOpItem::FlushOpItem() : DrawOpItem(FLUSH_OPITEM) {}
 
 std::shared_ptr<DrawOpItem> FlushOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<FlushOpItem>();
+    return cmdList.MakeDrawOp<FlushOpItem>();
 }
 
 void FlushOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1789,7 +1794,7 @@ ClearOpItem::ClearOpItem(ClearOpItem::ConstructorHandle* handle)
 
 std::shared_ptr<DrawOpItem> ClearOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<ClearOpItem>(static_cast<ClearOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<ClearOpItem>(static_cast<ClearOpItem::ConstructorHandle*>(handle));
 }
 
 void ClearOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1809,7 +1814,7 @@ SaveOpItem::SaveOpItem() : DrawOpItem(SAVE_OPITEM) {}
 
 std::shared_ptr<DrawOpItem> SaveOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<SaveOpItem>();
+    return cmdList.MakeDrawOp<SaveOpItem>();
 }
 
 void SaveOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1836,7 +1841,7 @@ SaveLayerOpItem::SaveLayerOpItem(const DrawCmdList& cmdList, SaveLayerOpItem::Co
 
 std::shared_ptr<DrawOpItem> SaveLayerOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<SaveLayerOpItem>(cmdList, static_cast<SaveLayerOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<SaveLayerOpItem>(cmdList, static_cast<SaveLayerOpItem::ConstructorHandle*>(handle));
 }
 
 void SaveLayerOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1866,7 +1871,7 @@ RestoreOpItem::RestoreOpItem() : DrawOpItem(RESTORE_OPITEM) {}
 
 std::shared_ptr<DrawOpItem> RestoreOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<RestoreOpItem>();
+    return cmdList.MakeDrawOp<RestoreOpItem>();
 }
 
 void RestoreOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1886,7 +1891,7 @@ DiscardOpItem::DiscardOpItem() : DrawOpItem(DISCARD_OPITEM) {}
 
 std::shared_ptr<DrawOpItem> DiscardOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DiscardOpItem>();
+    return cmdList.MakeDrawOp<DiscardOpItem>();
 }
 
 void DiscardOpItem::Marshalling(DrawCmdList& cmdList)
@@ -1912,7 +1917,7 @@ ClipAdaptiveRoundRectOpItem::ClipAdaptiveRoundRectOpItem(
 
 std::shared_ptr<DrawOpItem> ClipAdaptiveRoundRectOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<ClipAdaptiveRoundRectOpItem>(
+    return cmdList.MakeDrawOp<ClipAdaptiveRoundRectOpItem>(
         cmdList, static_cast<ClipAdaptiveRoundRectOpItem::ConstructorHandle*>(handle));
 }
 
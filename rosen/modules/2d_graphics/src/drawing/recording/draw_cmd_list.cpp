@@ -53,6 +53,8 @@ DrawCmdList::DrawCmdList(DrawCmdList::UnmarshalMode mode) : width_(0), height_(0
 DrawCmdList::DrawCmdList(int32_t width, int32_t height, DrawCmdList::UnmarshalMode mode)
     : width_(width), height_(height), mode_(mode)
 {
+    // Recording grows the op buffer by chunks, it is flattened once by FlattenOpData when recording is finished
+    opAllocator_.SetChunked(true);
     opAllocator_.Add(&width_, sizeof(int32_t));
     opAllocator_.Add(&height_, sizeof(int32_t));
 }
@@ -67,7 +69,7 @@ bool DrawCmdList::AddDrawOp(std::shared_ptr<DrawOpItem>&& drawOpItem)
     if (mode_ != DrawCmdList::UnmarshalMode::DEFERRED) {
         return false;
     }
-    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    RecordingLockGuard<std::recursive_mutex> lock(*this, mutex_);
     drawOpItems_.emplace_back(drawOpItem);
     return true;
 }
@@ -234,6 +236,8 @@ void DrawCmdList::UnmarshallingDrawOps()
     UnmarshallingPlayer player = { *this };
     drawOpItems_.clear();
     lastOpGenSize_ = 0;
+    // The ops are usually larger than their handles, size the first block of the arena to the op data.
+    opArena_ = std::make_shared<DrawOpArena>((opAllocator_.GetSize() - offset_) * 2);
     uint32_t opReplaceIndex = 0;
     uint32_t offset = offset_;
     do {
@@ -274,6 +278,7 @@ void DrawCmdList::UnmarshallingDrawOps()
             break;
         }
     } while (offset != 0);
+    opArena_ = nullptr;
     lastOpGenSize_ = opAllocator_.GetSize();
 
     if ((int)imageAllocator_.GetSize() > 0) {
@@ -461,10 +466,12 @@ void DrawCmdList::PlaybackToDrawCmdList(std::shared_ptr<DrawCmdList> drawCmdList
         return;
     }
 
-    void* addr = opAllocator_.OffsetToAddr(offset_);
-    if (addr == nullptr) {
+    FlattenOpData();
+    auto cmdListData = GetData();
+    if (cmdListData.first == nullptr || cmdListData.second <= offset_) {
         return;
     }
+    const void* addr = static_cast<const char*>(cmdListData.first) + offset_;
 
 #ifdef SUPPORT_OHOS_PIXMAP
     {
@@ -476,7 +483,7 @@ void DrawCmdList::PlaybackToDrawCmdList(std::shared_ptr<DrawCmdList> drawCmdList
         std::lock_guard<std::mutex> lock(drawCmdList->imageBaseObjMutex_);
         drawCmdList->imageBaseObjVec_.swap(imageBaseObjVec_);
     }
-    size_t size = opAllocator_.GetSize() - offset_;
+    size_t size = cmdListData.second - offset_;
     auto imageData = GetAllImageData();
     auto bitmapData = GetAllBitmapData();
     drawCmdList->opAllocator_.Add(addr, size);
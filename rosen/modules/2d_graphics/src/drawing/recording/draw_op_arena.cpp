@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "recording/draw_op_arena.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <mutex>
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+namespace {
+constexpr size_t MIN_BLOCK_SHIFT = 10;
+constexpr size_t MAX_BLOCK_SHIFT = 20;
+static_assert((static_cast<size_t>(1) << MIN_BLOCK_SHIFT) == DrawOpArena::MIN_BLOCK_SIZE, "MIN_BLOCK_SIZE");
+static_assert((static_cast<size_t>(1) << MAX_BLOCK_SHIFT) == DrawOpArena::MAX_BLOCK_SIZE, "MAX_BLOCK_SIZE");
+
+// Free blocks of all arenas, shared by all threads and bounded by MAX_POOLED_BYTES.
+class BlockPool {
+public:
+    static BlockPool& GetInstance()
+    {
+        // Never destroyed, arenas may still be released during static destruction.
+        static BlockPool* instance = new BlockPool();
+        return *instance;
+    }
+
+    // Blocks up to MAX_BLOCK_SIZE are rounded up to a power of two so that they can be reused.
+    char* Acquire(size_t size, size_t& capacity)
+    {
+        size_t shift = MIN_BLOCK_SHIFT;
+        while (shift <= MAX_BLOCK_SHIFT && (static_cast<size_t>(1) << shift) < size) {
+            shift++;
+        }
+        if (shift > MAX_BLOCK_SHIFT) {
+            capacity = size;
+            return new char[size];
+        }
+        capacity = static_cast<size_t>(1) << shift;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto& blocks = blocks_[shift - MIN_BLOCK_SHIFT];
+            if (!blocks.empty()) {
+                char* data = blocks.back();
+                blocks.pop_back();
+                pooledBytes_ -= capacity;
+                return data;
+            }
+        }
+        return new char[capacity];
+    }
+
+    void Release(char* data, size_t capacity)
+    {
+        size_t shift = MIN_BLOCK_SHIFT;
+        while (shift <= MAX_BLOCK_SHIFT && (static_cast<size_t>(1) << shift) != capacity) {
+            shift++;
+        }
+        if (shift <= MAX_BLOCK_SHIFT) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (pooledBytes_ + capacity <= DrawOpArena::MAX_POOLED_BYTES) {
+                blocks_[shift - MIN_BLOCK_SHIFT].push_back(data);
+                pooledBytes_ += capacity;
+                return;
+            }
+        }
+        delete[] data;
+    }
+
+    size_t GetPooledBytes()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return pooledBytes_;
+    }
+
+    void Purge()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& blocks : blocks_) {
+            for (char* data : blocks) {
+                delete[] data;
+            }
+            blocks.clear();
+        }
+        pooledBytes_ = 0;
+    }
+
+private:
+    BlockPool() = default;
+
+    std::mutex mutex_;
+    std::array<std::vector<char*>, MAX_BLOCK_SHIFT - MIN_BLOCK_SHIFT + 1> blocks_;
+    size_t pooledBytes_ = 0;
+};
+} // namespace
+
+DrawOpArena::DrawOpArena(size_t blockSize)
+    : blockSize_(std::min(std::max(blockSize, MIN_BLOCK_SIZE), MAX_BLOCK_SIZE)) {}
+
+DrawOpArena::~DrawOpArena()
+{
+    auto& pool = BlockPool::GetInstance();
+    for (auto& block : blocks_) {
+        pool.Release(block.data, block.capacity);
+    }
+    blocks_.clear();
+}
+
+void* DrawOpArena::Allocate(size_t size, size_t align)
+{
+    if (size == 0) {
+        return nullptr;
+    }
+    size_t padding = (align - reinterpret_cast<uintptr_t>(cur_) % align) % align;
+    if (cur_ == nullptr || remaining_ < size + padding) {
+        // Reserve align bytes so the first object of the new block always fits.
+        AddBlock(size + align);
+        padding = (align - reinterpret_cast<uintptr_t>(cur_) % align) % align;
+    }
+    char* addr = cur_ + padding;
+    cur_ = addr + size;
+    remaining_ -= size + padding;
+    usedSize_ += size;
+    return addr;
+}
+
+void DrawOpArena::AddBlock(size_t size)
+{
+    size_t capacity = 0;
+    char* data = BlockPool::GetInstance().Acquire(std::max(size, blockSize_), capacity);
+    blocks_.push_back({ data, capacity });
+    cur_ = data;
+    remaining_ = capacity;
+    // Next block is twice as large, so a big list only needs a few blocks.
+    blockSize_ = std::min(std::max(blockSize_, capacity) * 2, MAX_BLOCK_SIZE);
+}
+
+size_t DrawOpArena::GetUsedSize() const
+{
+    return usedSize_;
+}
+
+size_t DrawOpArena::GetBlockCount() const
+{
+    return blocks_.size();
+}
+
+size_t DrawOpArena::GetPooledBytes()
+{
+    return BlockPool::GetInstance().GetPooledBytes();
+}
+
+void DrawOpArena::PurgePool()
+{
+    BlockPool::GetInstance().Purge();
+}
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
@@ -15,6 +15,9 @@
 
 #include "recording/mem_allocator.h"
 
+#include <algorithm>
+
+#include "recording/mem_allocator_pool.h"
 #include "securec.h"
 #include "utils/log.h"
 
@@ -26,13 +29,41 @@ constexpr size_t LARGE_MALLOC = 200000000;
 }
 static constexpr size_t MEM_SIZE_MAX = SIZE_MAX;
 
-MemAllocator::MemAllocator() : isReadOnly_(false), capacity_(0), size_(0), startPtr_(nullptr) {}
+MemAllocator::MemAllocator()
+    : isReadOnly_(false), isChunked_(false), capacity_(0), size_(0), startPtr_(nullptr), tailPtr_(nullptr),
+      tailOffset_(0)
+{}
 
 MemAllocator::~MemAllocator()
 {
     Clear();
 }
 
+void MemAllocator::SetChunked(bool chunked)
+{
+    if (isChunked_ == chunked) {
+        return;
+    }
+    if (!isReadOnly_ && startPtr_) {
+        if (chunked) {
+            // The existing contiguous buffer becomes the first chunk
+            chunks_.push_back({ startPtr_, 0, capacity_ });
+        } else if (Flatten()) {
+            capacity_ = chunks_.front().size;
+            chunks_.clear();
+        } else {
+            LOGE("MemAllocator::SetChunked flatten failed");
+            return;
+        }
+    }
+    isChunked_ = chunked;
+}
+
+bool MemAllocator::IsChunked() const
+{
+    return isChunked_;
+}
+
 bool MemAllocator::BuildFromData(const void* data, size_t size)
 {
     if (!data || size == 0 || size > MEM_SIZE_MAX) {
@@ -42,6 +73,7 @@ bool MemAllocator::BuildFromData(const void* data, size_t size)
     Clear();
     isReadOnly_ = true;
     startPtr_ = const_cast<char*>(static_cast<const char*>(data));
+    tailPtr_ = startPtr_;
     capacity_ = size;
     size_ = size;
 
@@ -61,25 +93,80 @@ bool MemAllocator::BuildFromDataWithCopy(const void* data, size_t size)
     return true;
 }
 
-void MemAllocator::Clear()
+void MemAllocator::FreeData()
 {
-    if (!isReadOnly_ && startPtr_) {
-        delete[] startPtr_;
+    if (!isReadOnly_) {
+        if (!chunks_.empty()) {
+            for (auto& chunk : chunks_) {
+                MemAllocatorPool::Release(chunk.data, chunk.size);
+            }
+        } else if (startPtr_) {
+            delete[] startPtr_;
+        }
     }
-    isReadOnly_ = true;
+    chunks_.clear();
     startPtr_ = nullptr;
+    tailPtr_ = nullptr;
+    tailOffset_ = 0;
     capacity_ = 0;
     size_ = 0;
 }
 
+void MemAllocator::Clear()
+{
+    FreeData();
+    isReadOnly_ = true;
+}
+
 void MemAllocator::ClearData()
 {
-    if (!isReadOnly_ && startPtr_) {
-        delete[] startPtr_;
+    FreeData();
+}
+
+bool MemAllocator::Reserve(size_t size)
+{
+    if (isReadOnly_ || size == 0 || size > MEM_SIZE_MAX) {
+        return false;
     }
-    startPtr_ = nullptr;
-    capacity_ = 0;
-    size_ = 0;
+    if (capacity_ > size_ && capacity_ - size_ >= size) {
+        return true;
+    }
+    if (isChunked_ && chunks_.size() == 1) {
+        return ReplaceChunk(size_ + size);
+    }
+    return isChunked_ ? AddChunk(size) : Resize(size_ + size);
+}
+
+bool MemAllocator::ReplaceChunk(size_t size)
+{
+    if (size > LARGE_MALLOC) {
+        LOGW("MemAllocator::ReplaceChunk this time malloc large memory, size:%{public}zu", size);
+    }
+    size_t chunkSize = 0;
+    char* newData = MemAllocatorPool::Acquire(size, chunkSize);
+    if (!newData) {
+        return false;
+    }
+    auto& chunk = chunks_.front();
+    if (size_ > 0 && memcpy_s(newData, chunkSize, chunk.data, size_) != EOK) {
+        MemAllocatorPool::Release(newData, chunkSize);
+        return false;
+    }
+    MemAllocatorPool::Release(chunk.data, chunk.size);
+    chunk = { newData, 0, chunkSize };
+    startPtr_ = newData;
+    tailPtr_ = newData;
+    tailOffset_ = 0;
+    capacity_ = chunkSize;
+    return true;
+}
+
+bool MemAllocator::Expand(size_t size)
+{
+    if (isChunked_) {
+        return AddChunk((capacity_ > size ? capacity_ : size) * MEMORY_EXPANSION_FACTOR);
+    }
+    return Resize((capacity_ + size) * MEMORY_EXPANSION_FACTOR);
 }
 
 bool MemAllocator::Resize(size_t size)
@@ -104,29 +191,96 @@ bool MemAllocator::Resize(size_t size)
         }
     }
     startPtr_ = newData;
+    tailPtr_ = newData;
     capacity_ = size;
     return true;
 }
 
+bool MemAllocator::AddChunk(size_t size)
+{
+    // The new chunk starts at the aligned end of the used size, the tail of the previous chunk is left unused.
+    size_t offset = size_;
+    if (auto mod = offset % ALIGN_SIZE; mod != 0) {
+        offset += ALIGN_SIZE - mod;
+    }
+    if (isReadOnly_ || size == 0 || size > MEM_SIZE_MAX || offset > MEM_SIZE_MAX - size) {
+        return false;
+    }
+    if (size > LARGE_MALLOC) {
+        LOGW("MemAllocator::AddChunk this time malloc large memory, size:%{public}zu", size);
+    }
+    size_t chunkSize = 0;
+    char* newData = MemAllocatorPool::Acquire(size, chunkSize);
+    if (!newData) {
+        return false;
+    }
+
+    chunks_.push_back({ newData, offset, chunkSize });
+    if (chunks_.size() == 1) {
+        startPtr_ = newData;
+    }
+    tailPtr_ = newData;
+    tailOffset_ = offset;
+    capacity_ = offset + chunkSize;
+    size_ = offset;
+    return true;
+}
+
+bool MemAllocator::Flatten()
+{
+    if (chunks_.size() <= 1) {
+        return true;
+    }
+    size_t newSize = 0;
+    char* newData = MemAllocatorPool::Acquire(size_, newSize);
+    if (!newData) {
+        return false;
+    }
+    for (size_t i = 0; i < chunks_.size(); ++i) {
+        const auto& chunk = chunks_[i];
+        size_t end = (i + 1 < chunks_.size()) ? chunks_[i + 1].offset : size_;
+        size_t used = std::min(chunk.size, end - chunk.offset);
+        if (used > 0 && memcpy_s(newData + chunk.offset, newSize - chunk.offset, chunk.data, used) != EOK) {
+            MemAllocatorPool::Release(newData, newSize);
+            return false;
+        }
+        // Fills the unused tail of the chunk so that the flattened buffer is deterministic
+        if (chunk.offset + used < end) {
+            memset_s(newData + chunk.offset + used, end - chunk.offset - used, 0, end - chunk.offset - used);
+        }
+    }
+    for (auto& chunk : chunks_) {
+        MemAllocatorPool::Release(chunk.data, chunk.size);
+    }
+    chunks_.clear();
+    chunks_.push_back({ newData, 0, newSize });
+    startPtr_ = newData;
+    tailPtr_ = newData;
+    tailOffset_ = 0;
+    capacity_ = newSize;
+    return true;
+}
+
 void* MemAllocator::Add(const void* data, size_t size)
 {
     if (isReadOnly_ || !data || size == 0 || size > MEM_SIZE_MAX) {
         return nullptr;
     }
-    auto current = startPtr_ + size_;
+    auto current = tailPtr_ + (size_ - tailOffset_);
     if (auto mod = reinterpret_cast<uintptr_t>(current) % ALIGN_SIZE; mod != 0) {
         size_ += ALIGN_SIZE - mod;
     }
 
     if (capacity_ == 0 || capacity_ < size_ + size) {
         // The capacity is not enough, expand the capacity
-        if (Resize((capacity_ + size) * MEMORY_EXPANSION_FACTOR) == false) {
+        if (Expand(size) == false) {
             return nullptr;
         }
     }
-    if (!memcpy_s(startPtr_ + size_, capacity_ - size_, data, size)) {
+    char* addr = tailPtr_ + (size_ - tailOffset_);
+    if (!memcpy_s(addr, capacity_ - size_, data, size)) {
         size_ += size;
-        return startPtr_ + size_ - size;
+        return addr;
     } else {
         return nullptr;
     }
@@ -139,6 +293,10 @@ size_t MemAllocator::GetSize() const
 
 const void* MemAllocator::GetData() const
 {
+    if (chunks_.size() > 1) {
+        LOGE("MemAllocator::GetData data is not flattened");
+        return nullptr;
+    }
     return startPtr_;
 }
 
@@ -148,7 +306,18 @@ uint32_t MemAllocator::AddrToOffset(const void* addr) const
         return 0;
     }
 
-    auto offset = static_cast<uint32_t>(static_cast<const char*>(addr) - startPtr_);
+    auto ptr = static_cast<const char*>(addr);
+    if (chunks_.size() > 1) {
+        for (auto iter = chunks_.rbegin(); iter != chunks_.rend(); ++iter) {
+            if (ptr >= iter->data && ptr < iter->data + iter->size) {
+                auto offset = static_cast<uint32_t>(iter->offset + (ptr - iter->data));
+                return offset > size_ ? 0 : offset;
+            }
+        }
+        return 0;
+    }
+
+    auto offset = static_cast<uint32_t>(ptr - startPtr_);
     if (offset > size_) {
         return 0;
     }
@@ -160,8 +329,21 @@ void* MemAllocator::OffsetToAddr(size_t offset) const
     if (offset >= size_) {
         return nullptr;
     }
+    if (offset >= tailOffset_) {
+        return static_cast<void*>(tailPtr_ + (offset - tailOffset_));
+    }
 
-    return static_cast<void*>(startPtr_ + offset);
+    // Only reached in chunked mode, finds the last chunk which starts before the offset
+    auto iter = std::upper_bound(chunks_.begin(), chunks_.end(), offset,
+        [](size_t value, const Chunk& chunk) { return value < chunk.offset; });
+    if (iter == chunks_.begin()) {
+        return nullptr;
+    }
+    --iter;
+    if (offset - iter->offset >= iter->size) {
+        return nullptr;
+    }
+    return static_cast<void*>(iter->data + (offset - iter->offset));
 }
 } // namespace Drawing
 } // namespace Rosen
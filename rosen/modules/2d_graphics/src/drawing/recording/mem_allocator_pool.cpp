@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "recording/mem_allocator_pool.h"
+
+#include <atomic>
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+namespace {
+// Set when the pool of the thread is destroyed, buffers released after that are freed directly.
+thread_local bool g_poolDestroyed = false;
+// Bytes retained by the pools of all threads.
+std::atomic<size_t> g_processRetainedBytes = 0;
+std::atomic<size_t> g_maxProcessRetainedBytes = MemAllocatorPool::DEFAULT_MAX_PROCESS_RETAINED_BYTES;
+
+// Returns the smallest size class which can hold size bytes.
+size_t CeilSizeClass(size_t size)
+{
+    size_t shift = MemAllocatorPool::MIN_SIZE_CLASS_SHIFT;
+    while (shift <= MemAllocatorPool::MAX_SIZE_CLASS_SHIFT && (static_cast<size_t>(1) << shift) < size) {
+        shift++;
+    }
+    return shift - MemAllocatorPool::MIN_SIZE_CLASS_SHIFT;
+}
+
+// Returns the largest size class which a buffer of capacity bytes can serve.
+size_t FloorSizeClass(size_t capacity)
+{
+    size_t shift = MemAllocatorPool::MIN_SIZE_CLASS_SHIFT;
+    while (shift < MemAllocatorPool::MAX_SIZE_CLASS_SHIFT && (static_cast<size_t>(1) << (shift + 1)) <= capacity) {
+        shift++;
+    }
+    return shift - MemAllocatorPool::MIN_SIZE_CLASS_SHIFT;
+}
+} // namespace
+
+MemAllocatorPool& MemAllocatorPool::GetInstance()
+{
+    static thread_local MemAllocatorPool instance;
+    return instance;
+}
+
+MemAllocatorPool::~MemAllocatorPool()
+{
+    Purge();
+    g_poolDestroyed = true;
+}
+
+char* MemAllocatorPool::Acquire(size_t size, size_t& capacity)
+{
+    if (g_poolDestroyed) {
+        capacity = size;
+        return new char[size];
+    }
+    return GetInstance().AcquireImpl(size, capacity);
+}
+
+void MemAllocatorPool::Release(char* data, size_t capacity)
+{
+    if (data == nullptr) {
+        return;
+    }
+    if (g_poolDestroyed) {
+        delete[] data;
+        return;
+    }
+    GetInstance().ReleaseImpl(data, capacity);
+}
+
+char* MemAllocatorPool::AcquireImpl(size_t size, size_t& capacity)
+{
+    size_t sizeClass = CeilSizeClass(size);
+    if (sizeClass < SIZE_CLASS_COUNT) {
+        auto& buffers = buffers_[sizeClass];
+        if (!buffers.empty()) {
+            auto [data, bufferCapacity] = buffers.back();
+            buffers.pop_back();
+            retainedBytes_ -= bufferCapacity;
+            g_processRetainedBytes.fetch_sub(bufferCapacity, std::memory_order_relaxed);
+            hitCount_++;
+            capacity = bufferCapacity;
+            return data;
+        }
+        // Rounds the size up to the size class so that the buffer can be reused by any request of the class
+        size = static_cast<size_t>(1) << (sizeClass + MIN_SIZE_CLASS_SHIFT);
+    }
+    missCount_++;
+    capacity = size;
+    return new char[size];
+}
+
+void MemAllocatorPool::ReleaseImpl(char* data, size_t capacity)
+{
+    if (capacity < (static_cast<size_t>(1) << MIN_SIZE_CLASS_SHIFT) ||
+        capacity > (static_cast<size_t>(1) << (MAX_SIZE_CLASS_SHIFT + 1)) ||
+        retainedBytes_ + capacity > maxRetainedBytes_) {
+        delete[] data;
+        return;
+    }
+    size_t processRetainedBytes = g_processRetainedBytes.fetch_add(capacity, std::memory_order_relaxed) + capacity;
+    if (processRetainedBytes > g_maxProcessRetainedBytes.load(std::memory_order_relaxed)) {
+        g_processRetainedBytes.fetch_sub(capacity, std::memory_order_relaxed);
+        delete[] data;
+        return;
+    }
+    buffers_[FloorSizeClass(capacity)].emplace_back(data, capacity);
+    retainedBytes_ += capacity;
+}
+
+void MemAllocatorPool::SetMaxRetainedBytes(size_t maxRetainedBytes)
+{
+    maxRetainedBytes_ = maxRetainedBytes;
+    // Frees the largest buffers first until the pool fits the new limit
+    for (auto iter = buffers_.rbegin(); iter != buffers_.rend() && retainedBytes_ > maxRetainedBytes_; ++iter) {
+        while (!iter->empty() && retainedBytes_ > maxRetainedBytes_) {
+            retainedBytes_ -= iter->back().second;
+            g_processRetainedBytes.fetch_sub(iter->back().second, std::memory_order_relaxed);
+            delete[] iter->back().first;
+            iter->pop_back();
+        }
+    }
+}
+
+void MemAllocatorPool::SetMaxProcessRetainedBytes(size_t maxRetainedBytes)
+{
+    g_maxProcessRetainedBytes.store(maxRetainedBytes, std::memory_order_relaxed);
+}
+
+void MemAllocatorPool::Purge()
+{
+    for (auto& buffers : buffers_) {
+        for (auto& [data, capacity] : buffers) {
+            delete[] data;
+        }
+        buffers.clear();
+    }
+    g_processRetainedBytes.fetch_sub(retainedBytes_, std::memory_order_relaxed);
+    retainedBytes_ = 0;
+}
+
+MemAllocatorPool::Statistics MemAllocatorPool::GetStatistics() const
+{
+    Statistics statistics;
+    statistics.hitCount = hitCount_;
+    statistics.missCount = missCount_;
+    statistics.retainedBytes = retainedBytes_;
+    statistics.maxRetainedBytes = maxRetainedBytes_;
+    statistics.processRetainedBytes = g_processRetainedBytes.load(std::memory_order_relaxed);
+    return statistics;
+}
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
@@ -36,6 +36,13 @@ public:
     virtual VsyncError Destroy() = 0;
     virtual VsyncError SetUiDvsyncSwitch(bool dvsyncSwitch) = 0;
     virtual VsyncError SetUiDvsyncConfig(int32_t bufferCount) = 0;
+    // Returns the shared page of the connection and the eventfd signaled for every event published to it, the
+    // caller owns the returned fds. Events are still sent through the receive fd until SetSharedPageEnabled(true).
+    // Returns VSYNC_ERROR_NOT_SUPPORT if the distributor does not use shared pages.
+    virtual VsyncError GetSharedPage(int32_t &pageFd, int32_t &eventFd) = 0;
+    // Switches the connection between the shared page and the receive fd, the receiver enables the page once it is
+    // mapped and disables it again before the receive fd is used.
+    virtual VsyncError SetSharedPageEnabled(bool enabled) = 0;
 
     DECLARE_INTERFACE_DESCRIPTOR(u"IVSyncConnection");
 
@@ -47,6 +54,8 @@ protected:
         IVSYNC_CONNECTION_DESTROY,
         IVSYNC_CONNECTION_SET_UI_DVSYNC_SWITCH,
         IVSYNC_CONNECTION_SET_UI_DVSYNC_CONFIG,
+        IVSYNC_CONNECTION_GET_SHARED_PAGE,
+        IVSYNC_CONNECTION_SET_SHARED_PAGE_ENABLED,
     };
 };
 } // namespace Vsync
@@ -35,6 +35,8 @@ public:
     virtual VsyncError Destroy() override;
     virtual VsyncError SetUiDvsyncSwitch(bool dvsyncSwitch) override;
     virtual VsyncError SetUiDvsyncConfig(int32_t bufferCount) override;
+    virtual VsyncError GetSharedPage(int32_t &pageFd, int32_t &eventFd) override;
+    virtual VsyncError SetSharedPageEnabled(bool enabled) override;
 
 private:
     static inline BrokerDelegator<VSyncConnectionProxy> delegator_;
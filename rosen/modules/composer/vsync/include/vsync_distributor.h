@@ -18,6 +18,7 @@
 #define VSYNC_VSYNC_DISTRIBUTOR_H
 
 #include <refbase.h>
+#include <unique_fd.h>
 
 #include <mutex>
 #include <vector>
@@ -27,6 +28,7 @@
 #include "local_socketpair.h"
 #include "vsync_controller.h"
 #include "vsync_connection_stub.h"
+#include "vsync_shared_page.h"
 
 #include "vsync_system_ability_listener.h"
 
@@ -60,6 +62,8 @@ public:
     virtual VsyncError Destroy() override;
     virtual VsyncError SetUiDvsyncSwitch(bool vsyncSwitch) override;
     virtual VsyncError SetUiDvsyncConfig(int32_t bufferCount) override;
+    virtual VsyncError GetSharedPage(int32_t &pageFd, int32_t &eventFd) override;
+    virtual VsyncError SetSharedPageEnabled(bool enabled) override;
 
     int32_t PostEvent(int64_t now, int64_t period, int64_t vsyncCount);
 
@@ -78,6 +82,7 @@ public:
 private:
     VsyncError CleanAllLocked();
     VsyncError GetRemoteDistributorLocked(sptr<VSyncDistributor> &distributor);
+    int32_t PostSharedEvent(const std::shared_ptr<UniqueFd>& eventFd);
     class VSyncConnectionDeathRecipient : public IRemoteObject::DeathRecipient {
     public:
         explicit VSyncConnectionDeathRecipient(wptr<VSyncConnection> conn);
@@ -93,6 +98,11 @@ private:
     // Circular reference， need check
     wptr<VSyncDistributor> distributor_;
     sptr<LocalSocketPair> socketPair_;
+    // used instead of socketPair_ once the receiver mapped the page and enabled it
+    std::shared_ptr<VSyncSharedPage> sharedPage_ = nullptr;
+    // copied under mutex_ by PostEvent, so it is not closed while the vsync thread writes to it
+    std::shared_ptr<UniqueFd> eventFd_ = nullptr;
+    bool isSharedPageEnabled_ = false;
     bool isDead_;
     std::mutex mutex_;
 };
@@ -131,6 +141,10 @@ public:
     int64_t GetUiCommandDelayTime();
     void UpdatePendingReferenceTime(int64_t &timeStamp);
     void SetHardwareTaskNum(uint32_t num);
+    bool IsSharedPageEnabled() const
+    {
+        return isSharedPageEnabled_;
+    }
 
 private:
 
@@ -196,6 +210,7 @@ private:
 #endif
     bool isRs_ = false;
     std::atomic<bool> hasVsync_ = false;
+    bool isSharedPageEnabled_ = false;
 };
 } // namespace Rosen
 } // namespace OHOS
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VSYNC_VSYNC_SHARED_PAGE_H
+#define VSYNC_VSYNC_SHARED_PAGE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace OHOS {
+namespace Rosen {
+// The last vsync event of a connection. The sequence is odd while the distributor updates the slot, readers retry
+// until they read the same even sequence before and after the data.
+struct VSyncSharedSlot {
+    std::atomic<uint32_t> sequence;
+    uint32_t reserved;
+    alignas(8) std::atomic<int64_t> timestamp;
+    alignas(8) std::atomic<int64_t> period;
+    alignas(8) std::atomic<int64_t> vsyncCount;
+};
+
+/*
+ * A page holding the VSyncSharedSlot of one connection. The distributor publishes the vsync events of the connection
+ * by writing the slot instead of sending them through the socket, the receiver maps the page read only and reads the
+ * slot without locking. Every connection has its own page, so a receiver can not see the events of other processes.
+ */
+class VSyncSharedPage {
+public:
+    static constexpr size_t PAGE_SIZE = 4096;
+
+    // creates the page on the distributor side
+    static std::shared_ptr<VSyncSharedPage> Create(const std::string& name);
+    // maps a page received from the distributor read only, fd is not kept and can be closed afterwards
+    static std::shared_ptr<VSyncSharedPage> Map(int32_t fd);
+    ~VSyncSharedPage();
+    // nocopyable
+    VSyncSharedPage(const VSyncSharedPage &) = delete;
+    VSyncSharedPage &operator=(const VSyncSharedPage &) = delete;
+
+    // -1 if the page is mapped read only
+    int32_t GetFd() const
+    {
+        return fd_;
+    }
+    // the slot has only one writer at a time, does nothing if the page is mapped read only
+    void Publish(int64_t timestamp, int64_t period, int64_t vsyncCount);
+    bool Read(int64_t& timestamp, int64_t& period, int64_t& vsyncCount) const;
+
+private:
+    VSyncSharedPage(int32_t fd, VSyncSharedSlot* slot);
+
+    int32_t fd_ = -1;
+    VSyncSharedSlot* slot_ = nullptr;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // VSYNC_VSYNC_SHARED_PAGE_H
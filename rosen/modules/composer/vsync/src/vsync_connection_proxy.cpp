@@ -14,6 +14,7 @@
  */
 
 #include "vsync_connection_proxy.h"
+#include <unistd.h>
 #include "graphic_common.h"
 #include "vsync_log.h"
 
@@ -98,6 +99,50 @@ VsyncError VSyncConnectionProxy::GetReceiveFd(int32_t &fd)
     return VSYNC_ERROR_OK;
 }
 
+VsyncError VSyncConnectionProxy::GetSharedPage(int32_t &pageFd, int32_t &eventFd)
+{
+    MessageOption opt;
+    MessageParcel arg;
+    MessageParcel ret;
+
+    arg.WriteInterfaceToken(GetDescriptor());
+    int res = Remote()->SendRequest(IVSYNC_CONNECTION_GET_SHARED_PAGE, arg, ret, opt);
+    if (res != NO_ERROR) {
+        VLOGD("GetSharedPage Failed, res = %{public}d", res);
+        return VSYNC_ERROR_NOT_SUPPORT;
+    }
+    pageFd = ret.ReadFileDescriptor();
+    eventFd = ret.ReadFileDescriptor();
+    if (pageFd < 0 || eventFd < 0) {
+        VLOGE("GetSharedPage Invalid pageFd:%{public}d eventFd:%{public}d", pageFd, eventFd);
+        if (pageFd >= 0) {
+            close(pageFd);
+        }
+        if (eventFd >= 0) {
+            close(eventFd);
+        }
+        return VSYNC_ERROR_API_FAILED;
+    }
+    return VSYNC_ERROR_OK;
+}
+
+VsyncError VSyncConnectionProxy::SetSharedPageEnabled(bool enabled)
+{
+    // synchronous, the receiver switches its fd only after the distributor switched
+    MessageOption opt;
+    MessageParcel arg;
+    MessageParcel ret;
+
+    arg.WriteInterfaceToken(GetDescriptor());
+    arg.WriteBool(enabled);
+    int res = Remote()->SendRequest(IVSYNC_CONNECTION_SET_SHARED_PAGE_ENABLED, arg, ret, opt);
+    if (res != NO_ERROR) {
+        VLOGE("SetSharedPageEnabled Failed, enabled:%{public}d res = %{public}d", enabled, res);
+        return VSYNC_ERROR_API_FAILED;
+    }
+    return VSYNC_ERROR_OK;
+}
+
 VsyncError VSyncConnectionProxy::SetVSyncRate(int32_t rate)
 {
     if (rate < -1) {
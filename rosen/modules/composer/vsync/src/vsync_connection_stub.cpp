@@ -72,6 +72,24 @@ int32_t VSyncConnectionStub::OnRemoteRequest(uint32_t code, MessageParcel &data,
             int32_t bufferCount = data.ReadInt32();
             return SetUiDvsyncConfig(bufferCount);
         }
+        case IVSYNC_CONNECTION_GET_SHARED_PAGE: {
+            int32_t pageFd = -1;
+            int32_t eventFd = -1;
+            int32_t ret = GetSharedPage(pageFd, eventFd);
+            if (ret != VSYNC_ERROR_OK) {
+                return ret;
+            }
+            // the parcel duplicates the fds
+            reply.WriteFileDescriptor(pageFd);
+            reply.WriteFileDescriptor(eventFd);
+            close(pageFd);
+            close(eventFd);
+            break;
+        }
+        case IVSYNC_CONNECTION_SET_SHARED_PAGE_ENABLED: {
+            bool enabled = data.ReadBool();
+            return SetSharedPageEnabled(enabled);
+        }
         default: {
             // check add log
             return VSYNC_ERROR_INVALID_OPERATING;
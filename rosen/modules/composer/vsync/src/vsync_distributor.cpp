@@ -18,9 +18,13 @@
 #include <condition_variable>
 #include <algorithm>
 #include <cstdint>
+#include <cstdlib>
 #include <mutex>
 #include <sched.h>
+#include <sys/eventfd.h>
 #include <sys/resource.h>
+#include <unistd.h>
+#include <parameters.h>
 #include <scoped_bytrace.h>
 #include <hitrace_meter.h>
 #include "vsync_log.h"
@@ -159,9 +163,91 @@ VsyncError VSyncConnection::GetReceiveFd(int32_t &fd)
     return VSYNC_ERROR_OK;
 }
 
+VsyncError VSyncConnection::GetSharedPage(int32_t &pageFd, int32_t &eventFd)
+{
+    std::unique_lock<std::mutex> locker(mutex_);
+    if (isDead_) {
+        VLOGE("%{public}s VSync Client Connection is dead, name:%{public}s.", __func__, info_.name_.c_str());
+        return VSYNC_ERROR_API_FAILED;
+    }
+    if (sharedPage_ == nullptr) {
+        sptr<VSyncDistributor> distributor = nullptr;
+        VsyncError ret = GetRemoteDistributorLocked(distributor);
+        if (ret != VSYNC_ERROR_OK) {
+            return ret;
+        }
+        if (!distributor->IsSharedPageEnabled()) {
+            return VSYNC_ERROR_NOT_SUPPORT;
+        }
+        // the page of a connection is only shared with its receiver
+        std::shared_ptr<VSyncSharedPage> sharedPage = VSyncSharedPage::Create("vsync_" + info_.name_);
+        if (sharedPage == nullptr) {
+            return VSYNC_ERROR_API_FAILED;
+        }
+        int32_t fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (fd < 0) {
+            VLOGE("%{public}s eventfd failed, errno:%{public}d", __func__, errno);
+            return VSYNC_ERROR_API_FAILED;
+        }
+        eventFd_ = std::make_shared<UniqueFd>(fd);
+        sharedPage_ = sharedPage;
+    }
+    pageFd = dup(sharedPage_->GetFd());
+    eventFd = dup(eventFd_->Get());
+    if (pageFd < 0 || eventFd < 0) {
+        VLOGE("%{public}s dup failed, errno:%{public}d", __func__, errno);
+        if (pageFd >= 0) {
+            close(pageFd);
+        }
+        if (eventFd >= 0) {
+            close(eventFd);
+        }
+        return VSYNC_ERROR_API_FAILED;
+    }
+    return VSYNC_ERROR_OK;
+}
+
+VsyncError VSyncConnection::SetSharedPageEnabled(bool enabled)
+{
+    std::unique_lock<std::mutex> locker(mutex_);
+    if (isDead_) {
+        VLOGE("%{public}s VSync Client Connection is dead, name:%{public}s.", __func__, info_.name_.c_str());
+        return VSYNC_ERROR_API_FAILED;
+    }
+    if (enabled && sharedPage_ == nullptr) {
+        VLOGE("%{public}s no shared page, name:%{public}s.", __func__, info_.name_.c_str());
+        return VSYNC_ERROR_API_FAILED;
+    }
+    isSharedPageEnabled_ = enabled;
+    if (!enabled && sharedPage_ != nullptr) {
+        // the receiver went back to the socket, it is not switched to the page again
+        sharedPage_ = nullptr;
+        eventFd_ = nullptr;
+    }
+    return VSYNC_ERROR_OK;
+}
+
+int32_t VSyncConnection::PostSharedEvent(const std::shared_ptr<UniqueFd>& eventFd)
+{
+    // the write never blocks, the eventfd counter only keeps growing until the receiver reads it
+    int32_t ret = 0;
+    do {
+        ret = eventfd_write(eventFd->Get(), 1);
+    } while (ret == -1 && errno == EINTR);
+    if (ret == -1) {
+        ScopedBytrace failed("failed");
+        return errno == EAGAIN ? ERRNO_EAGAIN : ERRNO_OTHER;
+    }
+    ScopedDebugTrace successful("successful");
+    info_.postVSyncCount_++;
+    // 3: same as the size of the data sent through the socket
+    return static_cast<int32_t>(sizeof(int64_t) * 3);
+}
+
 int32_t VSyncConnection::PostEvent(int64_t now, int64_t period, int64_t vsyncCount)
 {
     sptr<LocalSocketPair> socketPair;
+    std::shared_ptr<UniqueFd> eventFd;
     {
         std::unique_lock<std::mutex> locker(mutex_);
         if (isDead_) {
@@ -169,8 +255,18 @@ int32_t VSyncConnection::PostEvent(int64_t now, int64_t period, int64_t vsyncCou
             VLOGE("%{public}s VSync Client Connection is dead, name:%{public}s.", __func__, info_.name_.c_str());
             return ERRNO_OTHER;
         }
+        if (isSharedPageEnabled_) {
+            // publishing under the lock keeps a single writer for the slot
+            RS_TRACE_NAME_FMT("PublishVsyncTo conn: %s, now:%ld, refreshRate:%d", info_.name_.c_str(), now,
+                refreshRate_);
+            sharedPage_->Publish(now, period, vsyncCount);
+            eventFd = eventFd_;
+        }
         socketPair = socketPair_;
     }
+    if (eventFd != nullptr) {
+        return PostSharedEvent(eventFd);
+    }
     if (socketPair == nullptr) {
         RS_TRACE_NAME_FMT("socketPair is null, conn: %s", info_.name_.c_str());
         return ERRNO_OTHER;
@@ -217,6 +313,9 @@ VsyncError VSyncConnection::SetVSyncRate(int32_t rate)
 VsyncError VSyncConnection::CleanAllLocked()
 {
     socketPair_ = nullptr;
+    isSharedPageEnabled_ = false;
+    sharedPage_ = nullptr;
+    eventFd_ = nullptr;
     sptr<VSyncDistributor> distributor = nullptr;
     VsyncError ret = GetRemoteDistributorLocked(distributor);
     if (ret != VSYNC_ERROR_OK) {
@@ -275,6 +374,7 @@ VSyncDistributor::VSyncDistributor(sptr<VSyncController> controller, std::string
     if (name == DEFAULT_RS_NAME) {
         isRs_ = true;
     }
+    isSharedPageEnabled_ = std::atoi(system::GetParameter("rosen.vsync.sharedpage.enabled", "0").c_str()) != 0;
 #if defined(RS_ENABLE_DVSYNC)
     dvsync_ = new DVsync(isRs_);
     if (dvsync_->IsFeatureEnabled()) {
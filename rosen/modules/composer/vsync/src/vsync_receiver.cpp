@@ -18,6 +18,7 @@
 #include <unistd.h>
 #include <scoped_bytrace.h>
 #include <fcntl.h>
+#include <sys/eventfd.h>
 #include <hitrace_meter.h>
 #include "event_handler.h"
 #include "graphic_common.h"
@@ -25,6 +26,7 @@
 #include "res_type.h"
 #include "rs_frame_report_ext.h"
 #include "vsync_log.h"
+#include "vsync_shared_page.h"
 #include "sandbox_utils.h"
 #include <rs_trace.h>
 
@@ -39,6 +41,15 @@ void VSyncCallBackListener::OnReadable(int32_t fileDescriptor)
     if (fileDescriptor < 0) {
         return;
     }
+    std::shared_ptr<VSyncSharedPage> sharedPage = nullptr;
+    {
+        std::lock_guard<std::mutex> locker(mtx_);
+        sharedPage = sharedPage_;
+    }
+    if (sharedPage != nullptr) {
+        OnSharedPageReadable(fileDescriptor, sharedPage);
+        return;
+    }
     // 3 is array size.
     int64_t data[3];
     ssize_t ret = 0;
@@ -62,6 +73,28 @@ void VSyncCallBackListener::OnReadable(int32_t fileDescriptor)
     HandleVsyncCallbacks(data, dataCount);
 }
 
+void VSyncCallBackListener::OnSharedPageReadable(int32_t fileDescriptor,
+    const std::shared_ptr<VSyncSharedPage>& sharedPage)
+{
+    // the eventfd counter holds all the events since the last read, only the latest one is kept in the slot
+    eventfd_t eventCount = 0;
+    int32_t ret = 0;
+    do {
+        ret = eventfd_read(fileDescriptor, &eventCount);
+    } while (ret == -1 && errno == EINTR);
+    if (ret == -1) {
+        return;
+    }
+    // 3 is array size.
+    int64_t data[3];
+    // 1, 2: index of array data.
+    if (!sharedPage->Read(data[0], data[1], data[2])) {
+        VLOGE("%{public}s read shared page failed", __func__);
+        return;
+    }
+    HandleVsyncCallbacks(data, sizeof(data));
+}
+
 void VSyncCallBackListener::HandleVsyncCallbacks(int64_t data[], ssize_t dataCount)
 {
     VSyncCallback cb = nullptr;
@@ -143,7 +176,11 @@ VsyncError VSyncReceiver::Init()
         return VSYNC_ERROR_NULLPTR;
     }
 
-    VsyncError ret = connection_->GetReceiveFd(fd_);
+    // the distributor keeps sending the events through the socket unless the page is mapped and enabled
+    VsyncError ret = InitSharedPage();
+    if (ret != VSYNC_ERROR_OK) {
+        ret = connection_->GetReceiveFd(fd_);
+    }
     if (ret != VSYNC_ERROR_OK) {
         return ret;
     }
@@ -168,6 +205,71 @@ VsyncError VSyncReceiver::Init()
     return VSYNC_ERROR_OK;
 }
 
+VsyncError VSyncReceiver::InitSharedPage()
+{
+    int32_t pageFd = INVALID_FD;
+    int32_t eventFd = INVALID_FD;
+    VsyncError ret = connection_->GetSharedPage(pageFd, eventFd);
+    if (ret != VSYNC_ERROR_OK) {
+        return ret;
+    }
+    std::shared_ptr<VSyncSharedPage> sharedPage = VSyncSharedPage::Map(pageFd);
+    close(pageFd);
+    if (sharedPage == nullptr) {
+        close(eventFd);
+        return VSYNC_ERROR_API_FAILED;
+    }
+    ret = connection_->SetSharedPageEnabled(true);
+    if (ret != VSYNC_ERROR_OK) {
+        close(eventFd);
+        return ret;
+    }
+    listener_->SetSharedPage(sharedPage);
+    fd_ = eventFd;
+    return VSYNC_ERROR_OK;
+}
+
+VsyncError VSyncReceiver::UseSocketLocked()
+{
+    if (!listener_->HasSharedPage()) {
+        return VSYNC_ERROR_OK;
+    }
+    VsyncError ret = connection_->SetSharedPageEnabled(false);
+    if (ret != VSYNC_ERROR_OK) {
+        return ret;
+    }
+    int32_t socketFd = INVALID_FD;
+    ret = connection_->GetReceiveFd(socketFd);
+    if (ret != VSYNC_ERROR_OK) {
+        return ret;
+    }
+    int32_t retVal = fcntl(socketFd, F_SETFL, O_NONBLOCK); // set fd to NonBlock mode
+    if (retVal != 0) {
+        VLOGW("%{public}s fcntl set fd:%{public}d NonBlock failed, retVal:%{public}d, errno:%{public}d",
+            __func__, socketFd, retVal, errno);
+    }
+    if (looper_ != nullptr) {
+        looper_->RemoveFileDescriptorListener(fd_);
+    }
+    close(fd_);
+    listener_->SetSharedPage(nullptr);
+    fd_ = socketFd;
+    if (looper_ != nullptr) {
+        looper_->AddFileDescriptorListener(fd_, AppExecFwk::FILE_DESCRIPTOR_INPUT_EVENT, listener_, "vSyncTask");
+    }
+    return VSYNC_ERROR_OK;
+}
+
+int32_t VSyncReceiver::GetFd()
+{
+    std::lock_guard<std::mutex> locker(initMutex_);
+    if (UseSocketLocked() != VSYNC_ERROR_OK) {
+        VLOGE("%{public}s switch back to the socket failed, name:%{public}s", __func__, name_.c_str());
+        return INVALID_FD;
+    }
+    return fd_;
+}
+
 void VSyncReceiver::ThreadCreateNotify()
 {
     int32_t pid = getprocpid();
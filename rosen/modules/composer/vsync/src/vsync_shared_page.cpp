@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "vsync_shared_page.h"
+#include <ashmem.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "vsync_log.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+// the distributor updates a slot in a few stores, readers normally never retry
+constexpr int32_t MAX_READ_RETRIES = 64;
+}
+
+static_assert(sizeof(VSyncSharedSlot) == 32, "the slot layout is shared by 32 and 64 bit processes");
+static_assert(std::atomic<int64_t>::is_always_lock_free, "slots must be lock free to be shared by processes");
+
+std::shared_ptr<VSyncSharedPage> VSyncSharedPage::Create(const std::string& name)
+{
+    int32_t fd = AshmemCreate(name.c_str(), PAGE_SIZE);
+    if (fd < 0) {
+        VLOGE("%{public}s AshmemCreate failed, errno:%{public}d", __func__, errno);
+        return nullptr;
+    }
+    void* addr = mmap(nullptr, PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        VLOGE("%{public}s mmap failed, errno:%{public}d", __func__, errno);
+        close(fd);
+        return nullptr;
+    }
+    // the fd given to the receivers can only be mapped read only
+    if (AshmemSetProt(fd, PROT_READ) != 0) {
+        VLOGE("%{public}s AshmemSetProt failed, errno:%{public}d", __func__, errno);
+        munmap(addr, PAGE_SIZE);
+        close(fd);
+        return nullptr;
+    }
+    // ashmem is zero filled, the slot starts with an even sequence and no event
+    return std::shared_ptr<VSyncSharedPage>(new VSyncSharedPage(fd, static_cast<VSyncSharedSlot*>(addr)));
+}
+
+std::shared_ptr<VSyncSharedPage> VSyncSharedPage::Map(int32_t fd)
+{
+    if (fd < 0 || AshmemGetSize(fd) < static_cast<int>(PAGE_SIZE)) {
+        VLOGE("%{public}s invalid fd:%{public}d", __func__, fd);
+        return nullptr;
+    }
+    void* addr = mmap(nullptr, PAGE_SIZE, PROT_READ, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        VLOGE("%{public}s mmap failed, errno:%{public}d", __func__, errno);
+        return nullptr;
+    }
+    return std::shared_ptr<VSyncSharedPage>(new VSyncSharedPage(-1, static_cast<VSyncSharedSlot*>(addr)));
+}
+
+VSyncSharedPage::VSyncSharedPage(int32_t fd, VSyncSharedSlot* slot) : fd_(fd), slot_(slot)
+{
+}
+
+VSyncSharedPage::~VSyncSharedPage()
+{
+    munmap(slot_, PAGE_SIZE);
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+void VSyncSharedPage::Publish(int64_t timestamp, int64_t period, int64_t vsyncCount)
+{
+    if (fd_ < 0) {
+        return;
+    }
+    VSyncSharedSlot& target = *slot_;
+    uint32_t sequence = target.sequence.load(std::memory_order_relaxed);
+    target.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    target.timestamp.store(timestamp, std::memory_order_relaxed);
+    target.period.store(period, std::memory_order_relaxed);
+    target.vsyncCount.store(vsyncCount, std::memory_order_relaxed);
+    target.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+bool VSyncSharedPage::Read(int64_t& timestamp, int64_t& period, int64_t& vsyncCount) const
+{
+    const VSyncSharedSlot& source = *slot_;
+    for (int32_t i = 0; i < MAX_READ_RETRIES; i++) {
+        uint32_t sequence = source.sequence.load(std::memory_order_acquire);
+        if ((sequence & 1u) != 0) {
+            continue;
+        }
+        timestamp = source.timestamp.load(std::memory_order_relaxed);
+        period = source.period.load(std::memory_order_relaxed);
+        vsyncCount = source.vsyncCount.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (source.sequence.load(std::memory_order_relaxed) == sequence) {
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include "vsync_distributor.h"
+#include "vsync_controller.h"
+#include "vsync_shared_page.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+class VSyncSharedPageTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+
+    static inline sptr<VSyncController> vsyncController = nullptr;
+    static inline sptr<VSyncDistributor> vsyncDistributor = nullptr;
+    static inline sptr<VSyncGenerator> vsyncGenerator = nullptr;
+};
+
+void VSyncSharedPageTest::SetUpTestCase()
+{
+    vsyncGenerator = CreateVSyncGenerator();
+    vsyncController = new VSyncController(vsyncGenerator, 0);
+    vsyncDistributor = new VSyncDistributor(vsyncController, "VSyncSharedPageTest");
+}
+
+void VSyncSharedPageTest::TearDownTestCase()
+{
+    vsyncGenerator = nullptr;
+    DestroyVSyncGenerator();
+    vsyncController = nullptr;
+    vsyncDistributor = nullptr;
+}
+
+namespace {
+/*
+* Function: PublishAndRead001
+* Type: Function
+* Rank: Important(2)
+* EnvConditions: N/A
+* CaseDescription: 1. publish an event to a page
+*                  2. read it through a read only mapping of the page
+ */
+HWTEST_F(VSyncSharedPageTest, PublishAndRead001, Function | MediumTest| Level3)
+{
+    auto page = VSyncSharedPage::Create("VSyncSharedPageTest");
+    ASSERT_NE(page, nullptr);
+    auto readOnlyPage = VSyncSharedPage::Map(page->GetFd());
+    ASSERT_NE(readOnlyPage, nullptr);
+    ASSERT_EQ(readOnlyPage->GetFd(), -1);
+
+    page->Publish(1000, 16, 1);
+    page->Publish(2000, 8, 2);
+    int64_t timestamp = 0;
+    int64_t period = 0;
+    int64_t vsyncCount = 0;
+    ASSERT_TRUE(readOnlyPage->Read(timestamp, period, vsyncCount));
+    ASSERT_EQ(timestamp, 2000);
+    ASSERT_EQ(period, 8);
+    ASSERT_EQ(vsyncCount, 2);
+
+    // a read only page can not publish
+    readOnlyPage->Publish(3000, 8, 3);
+    ASSERT_TRUE(page->Read(timestamp, period, vsyncCount));
+    ASSERT_EQ(vsyncCount, 2);
+}
+
+/*
+* Function: GetSharedPage001
+* Type: Function
+* Rank: Important(2)
+* EnvConditions: N/A
+* CaseDescription: 1. call GetSharedPage with the shared page disabled and enabled
+*                  2. check events go through the socket until the page is enabled
+*                  3. post an event to the connection and read it from the page
+*                  4. disable the page and check events go through the socket again
+ */
+HWTEST_F(VSyncSharedPageTest, GetSharedPage001, Function | MediumTest| Level3)
+{
+    sptr<VSyncConnection> conn = new VSyncConnection(vsyncDistributor, "VSyncSharedPageTest");
+    int32_t socketFd = -1;
+    ASSERT_EQ(conn->GetReceiveFd(socketFd), VSYNC_ERROR_OK);
+    fcntl(socketFd, F_SETFL, O_NONBLOCK);
+    int32_t pageFd = -1;
+    int32_t eventFd = -1;
+    vsyncDistributor->isSharedPageEnabled_ = false;
+    ASSERT_EQ(conn->GetSharedPage(pageFd, eventFd), VSYNC_ERROR_NOT_SUPPORT);
+    ASSERT_EQ(conn->SetSharedPageEnabled(true), VSYNC_ERROR_API_FAILED);
+    vsyncDistributor->isSharedPageEnabled_ = true;
+    ASSERT_EQ(conn->GetSharedPage(pageFd, eventFd), VSYNC_ERROR_OK);
+    ASSERT_GE(pageFd, 0);
+    ASSERT_GE(eventFd, 0);
+    auto page = VSyncSharedPage::Map(pageFd);
+    close(pageFd);
+    ASSERT_NE(page, nullptr);
+
+    // 3 is array size.
+    int64_t data[3];
+    eventfd_t eventCount = 0;
+    ASSERT_EQ(conn->PostEvent(500, 16, 1), static_cast<int32_t>(sizeof(data)));
+    ASSERT_EQ(read(socketFd, data, sizeof(data)), static_cast<ssize_t>(sizeof(data)));
+    ASSERT_EQ(eventfd_read(eventFd, &eventCount), -1);
+
+    ASSERT_EQ(conn->SetSharedPageEnabled(true), VSYNC_ERROR_OK);
+    ASSERT_EQ(conn->PostEvent(1000, 16, 2), static_cast<int32_t>(sizeof(data)));
+    ASSERT_EQ(conn->PostEvent(2000, 16, 3), static_cast<int32_t>(sizeof(data)));
+    ASSERT_EQ(eventfd_read(eventFd, &eventCount), 0);
+    ASSERT_EQ(eventCount, 2u);
+    ASSERT_EQ(read(socketFd, data, sizeof(data)), -1);
+    int64_t timestamp = 0;
+    int64_t period = 0;
+    int64_t vsyncCount = 0;
+    ASSERT_TRUE(page->Read(timestamp, period, vsyncCount));
+    ASSERT_EQ(timestamp, 2000);
+    ASSERT_EQ(vsyncCount, 3);
+
+    ASSERT_EQ(conn->SetSharedPageEnabled(false), VSYNC_ERROR_OK);
+    ASSERT_EQ(conn->PostEvent(3000, 16, 4), static_cast<int32_t>(sizeof(data)));
+    ASSERT_EQ(read(socketFd, data, sizeof(data)), static_cast<ssize_t>(sizeof(data)));
+    ASSERT_EQ(data[0], 3000);
+    ASSERT_TRUE(page->Read(timestamp, period, vsyncCount));
+    ASSERT_EQ(vsyncCount, 3);
+    close(eventFd);
+    close(socketFd);
+    vsyncDistributor->isSharedPageEnabled_ = false;
+}
+
+/*
+* Function: GetSharedPage002
+* Type: Function
+* Rank: Important(2)
+* EnvConditions: N/A
+* CaseDescription: 1. get the shared pages of two connections
+*                  2. check the events of one connection are not visible in the page of the other
+ */
+HWTEST_F(VSyncSharedPageTest, GetSharedPage002, Function | MediumTest| Level3)
+{
+    vsyncDistributor->isSharedPageEnabled_ = true;
+    sptr<VSyncConnection> conns[] = {
+        new VSyncConnection(vsyncDistributor, "VSyncSharedPageTest0"),
+        new VSyncConnection(vsyncDistributor, "VSyncSharedPageTest1"),
+    };
+    std::shared_ptr<VSyncSharedPage> pages[2];
+    for (int32_t i = 0; i < 2; i++) {
+        int32_t pageFd = -1;
+        int32_t eventFd = -1;
+        ASSERT_EQ(conns[i]->GetSharedPage(pageFd, eventFd), VSYNC_ERROR_OK);
+        pages[i] = VSyncSharedPage::Map(pageFd);
+        close(pageFd);
+        close(eventFd);
+        ASSERT_NE(pages[i], nullptr);
+        ASSERT_EQ(conns[i]->SetSharedPageEnabled(true), VSYNC_ERROR_OK);
+    }
+    conns[0]->PostEvent(1000, 16, 1);
+    int64_t timestamp = 0;
+    int64_t period = 0;
+    int64_t vsyncCount = 0;
+    ASSERT_TRUE(pages[0]->Read(timestamp, period, vsyncCount));
+    ASSERT_EQ(timestamp, 1000);
+    ASSERT_TRUE(pages[1]->Read(timestamp, period, vsyncCount));
+    ASSERT_EQ(timestamp, 0);
+    ASSERT_EQ(vsyncCount, 0);
+    vsyncDistributor->isSharedPageEnabled_ = false;
+}
+
+/*
+* Function: Destroy001
+* Type: Function
+* Rank: Important(2)
+* EnvConditions: N/A
+* CaseDescription: 1. enable the shared page of a connection and destroy it
+*                  2. check the page and the eventfd are released with the socket
+ */
+HWTEST_F(VSyncSharedPageTest, Destroy001, Function | MediumTest| Level3)
+{
+    vsyncDistributor->isSharedPageEnabled_ = true;
+    sptr<VSyncConnection> conn = new VSyncConnection(vsyncDistributor, "VSyncSharedPageTest");
+    int32_t pageFd = -1;
+    int32_t eventFd = -1;
+    ASSERT_EQ(conn->GetSharedPage(pageFd, eventFd), VSYNC_ERROR_OK);
+    close(pageFd);
+    close(eventFd);
+    ASSERT_EQ(conn->SetSharedPageEnabled(true), VSYNC_ERROR_OK);
+    conn->Destroy();
+    ASSERT_EQ(conn->sharedPage_, nullptr);
+    ASSERT_EQ(conn->eventFd_, nullptr);
+    ASSERT_FALSE(conn->isSharedPageEnabled_);
+    ASSERT_LT(conn->PostEvent(1000, 16, 1), 0);
+    vsyncDistributor->isSharedPageEnabled_ = false;
+}
+} // namespace
+} // namespace Rosen
+} // namespace OHOS
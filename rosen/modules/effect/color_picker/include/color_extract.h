@@ -84,6 +84,11 @@ private:
     static constexpr int COMPONENT_BLUE = -1;
     static constexpr int QUANTIZE_WORD_WIDTH = 5;
     static constexpr int QUANTIZE_WORD_MASK = (1 << QUANTIZE_WORD_WIDTH) - 1;
+    static uint32_t GatherPixels(Media::PixelMap& pixmap, uint32_t left, uint32_t top, uint32_t right,
+        uint32_t bottom, uint32_t* colorVal);
+    // Returns UINT32_MAX when the pixel format is not RGBA_8888 or BGRA_8888.
+    static uint32_t GatherRawPixels(Media::PixelMap& pixmap, uint32_t left, uint32_t top, uint32_t right,
+        uint32_t bottom, uint32_t* colorVal);
     static uint32_t QuantizedRed(uint32_t color);
     static uint32_t QuantizedGreen(uint32_t color);
     static uint32_t QuantizedBlue(uint32_t color);
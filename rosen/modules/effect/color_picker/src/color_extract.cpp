@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 #include "color_extract.h"
+#include <array>
 #include <cmath>
 #include <iostream>
 #include <vector>
@@ -39,18 +40,8 @@ ColorExtract::ColorExtract(std::shared_ptr<Media::PixelMap> pixmap)
         delete[] ptr;
     });
     colorVal_ = std::move(colorShared);
-    uint32_t realColorCnt = 0;
-    for (int i = 0; i < pixmap->GetHeight(); i++) {
-        for (int j = 0; j < pixmap->GetWidth(); j++) {
-            uint32_t pixelColor;
-            pixmap->GetARGB32Color(j, i, pixelColor);
-            if (GetARGB32ColorA(pixelColor) != 0) {
-                colorVal[realColorCnt] = pixelColor;
-                realColorCnt++;
-            }
-        }
-    }
-    colorValLen_ = realColorCnt;
+    colorValLen_ = GatherPixels(*pixmap, 0, 0, static_cast<uint32_t>(pixmap->GetWidth()),
+        static_cast<uint32_t>(pixmap->GetHeight()), colorVal);
     grayMsd_ = CalcGrayMsd();
     contrastToWhite_ = CalcContrastToWhite();
     GetNFeatureColors(specifiedFeatureColorNum_);
@@ -75,21 +66,76 @@ ColorExtract::ColorExtract(std::shared_ptr<Media::PixelMap> pixmap, double* coor
         delete[] ptr;
     });
     colorVal_ = std::move(colorShared);
-    uint32_t realColorCnt = 0;
+    colorValLen_ = GatherPixels(*pixmap, left, top, right, bottom, colorVal);
+    grayMsd_ = CalcGrayMsd();
+    contrastToWhite_ = CalcContrastToWhite();
+    GetNFeatureColors(specifiedFeatureColorNum_);
+}
+
+uint32_t ColorExtract::GatherPixels(Media::PixelMap& pixmap, uint32_t left, uint32_t top, uint32_t right,
+    uint32_t bottom, uint32_t* colorVal)
+{
+    uint32_t realColorCnt = GatherRawPixels(pixmap, left, top, right, bottom, colorVal);
+    if (realColorCnt != UINT32_MAX) {
+        return realColorCnt;
+    }
+    realColorCnt = 0;
     for (uint32_t i = top; i < bottom; i++) {
         for (uint32_t j = left; j < right; j++) {
             uint32_t pixelColor;
-            pixmap->GetARGB32Color(j, i, pixelColor);
+            pixmap.GetARGB32Color(j, i, pixelColor);
             if (GetARGB32ColorA(pixelColor) != 0) {
                 colorVal[realColorCnt] = pixelColor;
                 realColorCnt++;
             }
         }
     }
-    colorValLen_ = realColorCnt;
-    grayMsd_ = CalcGrayMsd();
-    contrastToWhite_ = CalcContrastToWhite();
-    GetNFeatureColors(specifiedFeatureColorNum_);
+    return realColorCnt;
+}
+
+uint32_t ColorExtract::GatherRawPixels(Media::PixelMap& pixmap, uint32_t left, uint32_t top, uint32_t right,
+    uint32_t bottom, uint32_t* colorVal)
+{
+    // byte offsets of r, g, b, a in one pixel
+    uint32_t offsetR = 0;
+    uint32_t offsetB = 0;
+    switch (pixmap.GetPixelFormat()) {
+        case Media::PixelFormat::RGBA_8888:
+            offsetR = 0; // 0 is the offset of red in RGBA
+            offsetB = 2; // 2 is the offset of blue in RGBA
+            break;
+        case Media::PixelFormat::BGRA_8888:
+            offsetR = 2; // 2 is the offset of red in BGRA
+            offsetB = 0; // 0 is the offset of blue in BGRA
+            break;
+        default:
+            return UINT32_MAX;
+    }
+    constexpr uint32_t offsetG = 1;
+    constexpr uint32_t offsetA = 3;
+    constexpr uint32_t pixelBytes = 4;
+    const uint8_t* pixels = pixmap.GetPixels();
+    int32_t rowStride = pixmap.GetRowStride();
+    if (pixels == nullptr || rowStride < static_cast<int32_t>(right * pixelBytes) ||
+        right > static_cast<uint32_t>(pixmap.GetWidth()) || bottom > static_cast<uint32_t>(pixmap.GetHeight())) {
+        return UINT32_MAX;
+    }
+
+    // Walk the rows directly instead of a bounds-checked GetARGB32Color call per pixel. Every pixel is stored and
+    // the count only moves on for non-transparent ones, so the loop has no branch and can be vectorized.
+    uint32_t realColorCnt = 0;
+    for (uint32_t i = top; i < bottom; i++) {
+        const uint8_t* row = pixels + static_cast<size_t>(i) * static_cast<size_t>(rowStride);
+        for (uint32_t j = left; j < right; j++) {
+            const uint8_t* pixel = row + j * pixelBytes;
+            uint32_t alpha = pixel[offsetA];
+            colorVal[realColorCnt] = (alpha << ARGB_A_SHIFT) | (static_cast<uint32_t>(pixel[offsetR]) << ARGB_R_SHIFT) |
+                (static_cast<uint32_t>(pixel[offsetG]) << ARGB_G_SHIFT) |
+                (static_cast<uint32_t>(pixel[offsetB]) << ARGB_B_SHIFT);
+            realColorCnt += (alpha != 0) ? 1 : 0;
+        }
+    }
+    return realColorCnt;
 }
 
 // Return red component of a quantized color
@@ -230,7 +276,8 @@ uint32_t ColorExtract::CalcGrayMsd() const
     }
     uint32_t grayAve = graySum / colorValLen_;
     for (uint32_t i = 0; i < colorValLen_; i++) {
-        grayVar += pow(static_cast<long long int>(Rgb2Gray(colorVal[i])) - grayAve, 2); // 2 is square
+        long long int grayDiff = static_cast<long long int>(Rgb2Gray(colorVal[i])) - grayAve;
+        grayVar += grayDiff * grayDiff;
     }
     grayVar /= colorValLen_;
     return static_cast<uint32_t>(grayVar);
@@ -249,12 +296,17 @@ float ColorExtract::NormalizeRgb(uint32_t val)
 
 float ColorExtract::CalcRelativeLum(uint32_t color)
 {
-    uint32_t r = GetARGB32ColorR(color);
-    uint32_t g = GetARGB32ColorG(color);
-    uint32_t b = GetARGB32ColorB(color);
-    float R = NormalizeRgb(r);
-    float G = NormalizeRgb(g);
-    float B = NormalizeRgb(b);
+    // NormalizeRgb calls pow, look it up from a table built once for the 256 values of a component.
+    static const std::array<float, ARGB_MASK + 1> normalizedRgb = [] {
+        std::array<float, ARGB_MASK + 1> table {};
+        for (uint32_t i = 0; i < table.size(); i++) {
+            table[i] = NormalizeRgb(i);
+        }
+        return table;
+    }();
+    float R = normalizedRgb[GetARGB32ColorR(color)];
+    float G = normalizedRgb[GetARGB32ColorG(color)];
+    float B = normalizedRgb[GetARGB32ColorB(color)];
     return R * RED_LUMINACE_RATIO + G * GREEN_LUMINACE_RATIO + B * BLUE_LUMINACE_RATIO;
 }
 
@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include "color_picker_unittest.h"
 #include "color_picker.h"
 #include "color.h"
@@ -543,5 +545,55 @@ HWTEST_F(ColorPickerUnittest, GetTopProportionColors, TestSize.Level1)
     std::vector<ColorManager::Color> colors2 = pColorPicker->GetTopProportionColors(0);
     ASSERT_EQ(colors2.size(), 0);
 }
+
+/**
+ * @tc.name: GatherPixelsTest001
+ * @tc.desc: Ensure the pixels read from the rows are the same as the ones from GetARGB32Color.
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.author:
+ */
+HWTEST_F(ColorPickerUnittest, GatherPixelsTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ColorPickerUnittest GatherPixelsTest001 start";
+    constexpr uint32_t width = 100;
+    constexpr uint32_t height = 100;
+    std::vector<uint32_t> colors(width * height);
+    for (uint32_t i = 0; i < colors.size(); i++) {
+        // every 7th pixel is transparent
+        uint32_t alpha = (i % 7 == 0) ? 0 : 0xFF;
+        colors[i] = (alpha << 24) | ((i * 13) & 0xFFFFFF); // 24 is the shift of alpha, 13 makes colors vary
+    }
+    for (auto format : { PixelFormat::RGBA_8888, PixelFormat::BGRA_8888 }) {
+        InitializationOptions opts;
+        opts.size.width = width;
+        opts.size.height = height;
+        opts.pixelFormat = format;
+        opts.alphaType = AlphaType::IMAGE_ALPHA_TYPE_UNPREMUL;
+        opts.editable = true;
+        std::unique_ptr<PixelMap> pixmap = PixelMap::Create(colors.data(), colors.size(), opts);
+        ASSERT_NE(pixmap, nullptr);
+
+        uint32_t errorCode = SUCCESS;
+        std::shared_ptr<ColorPicker> pColorPicker = ColorPicker::CreateColorPicker(std::move(pixmap), errorCode);
+        ASSERT_EQ(errorCode, SUCCESS);
+        ASSERT_NE(pColorPicker, nullptr);
+
+        auto& scaledPixmap = pColorPicker->pixelmap_;
+        std::vector<uint32_t> expected;
+        for (int i = 0; i < scaledPixmap->GetHeight(); i++) {
+            for (int j = 0; j < scaledPixmap->GetWidth(); j++) {
+                uint32_t pixelColor = 0;
+                scaledPixmap->GetARGB32Color(j, i, pixelColor);
+                if (ColorExtract::GetARGB32ColorA(pixelColor) != 0) {
+                    expected.push_back(pixelColor);
+                }
+            }
+        }
+        ASSERT_EQ(pColorPicker->colorValLen_, expected.size());
+        uint32_t* colorVal = pColorPicker->colorVal_.get();
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), colorVal));
+    }
+}
 } // namespace Rosen
 } // namespace OHOS
@@ -226,7 +226,9 @@ static std::vector<RectI> MergeDirtyHistory(RSDisplayRenderNodeDrawable& display
     RectI rect = dirtyManager->GetDirtyRegionFlipWithinSurface();
     auto rects = RSUniRenderUtil::ScreenIntersectDirtyRects(dirtyRegion, screenInfo);
     if (!rect.IsEmpty()) {
-        rects.emplace_back(rect);
+        // the dirty tiles of scattered small updates are kept apart instead of being joined into rect
+        auto dirtyRects = dirtyManager->GetDirtyRegionRectsFlipWithinSurface();
+        rects.insert(rects.end(), dirtyRects.begin(), dirtyRects.end());
         RectI screenRectI(0, 0, static_cast<int32_t>(screenInfo.phyWidth), static_cast<int32_t>(screenInfo.phyHeight));
         GpuDirtyRegionCollection::GetInstance().UpdateGlobalDirtyInfoForDFX(rect.IntersectRect(screenRectI));
     }
@@ -16,12 +16,14 @@
 
 #include "rs_base_render_util.h"
 
+#include <limits>
 #include <parameters.h>
 #include <sys/stat.h>
 #include <sys/time.h>
 #include <unistd.h>
 #include <unordered_set>
 
+#include "ffrt_inner.h"
 #include "include/utils/SkCamera.h"
 #include "png.h"
 #include "rs_frame_rate_vote.h"
@@ -60,6 +62,8 @@ const uint32_t STUB_PIXEL_FMT_RGBA_16161616 = 0X7fff0001;
 const uint32_t STUB_PIXEL_FMT_RGBA_1010102 = 0X7fff0002;
 constexpr uint32_t MATRIX_SIZE = 20; // colorMatrix size
 constexpr int BITMAP_DEPTH = 8;
+constexpr int32_t YUV_ROWS_PER_TASK = 64;
+constexpr int32_t GAMUT_PIXELS_PER_TASK = 64 * 1024;
 
 inline constexpr float PassThrough(float v)
 {
@@ -367,6 +371,16 @@ public:
         return ApplyTransForm(FromLinear(xyzToRgb_ * xyz), clamper_);
     }
 
+    Vector3f LinearToXYZ(const Vector3f& linear) const
+    {
+        return rgbToXyz_ * linear;
+    }
+
+    Vector3f XYZToLinear(const Vector3f& xyz) const
+    {
+        return xyzToRgb_ * xyz;
+    }
+
 private:
     Matrix3f rgbToXyz_;
     Matrix3f xyzToRgb_;
@@ -624,6 +638,134 @@ Offset ConvertColorGamut(uint8_t* dst, uint8_t* src, int32_t pixelFormat, Simple
     return len;
 }
 
+// Runs func on the ranges [begin, end) of [0, count), the calling thread takes the first range and waits for the
+// others.
+void ParallelForRanges(int32_t count, int32_t rangeSize, const std::function<void(int32_t, int32_t)>& func)
+{
+    if (count <= rangeSize) {
+        func(0, count);
+        return;
+    }
+    std::vector<ffrt::dependence> deps;
+    for (int32_t begin = rangeSize; begin < count; begin += rangeSize) {
+        int32_t end = std::min(begin + rangeSize, count);
+        deps.emplace_back(ffrt::submit_h([&func, begin, end]() { func(begin, end); }, {}, {},
+            ffrt::task_attr().qos(ffrt::qos_user_interactive)));
+    }
+    func(0, rangeSize);
+    ffrt::wait(deps);
+}
+
+// Same conversion as ConvertColorGamut() for 8 bit formats, with the transfer functions of both color spaces turned
+// into tables and their matrices into one. The loops have no calls or branches so that they can be vectorized.
+class GamutConvertKernel {
+public:
+    GamutConvertKernel(const SimpleColorSpace& srcColorSpace, const SimpleColorSpace& dstColorSpace)
+    {
+        for (uint32_t i = 0; i < toLinear_.size(); i++) {
+            float value = RGBUint8ToFloat(static_cast<uint8_t>(i));
+            toLinear_[i] = srcColorSpace.ToLinear(Vector3f { value, value, value })[0];
+        }
+        // RGBFloatToUint8() rounds to i from (i - 0.5) / 255, the linear value of it is where the output becomes i
+        thresholds_[0] = std::numeric_limits<float>::lowest();
+        for (uint32_t i = 1; i < thresholds_.size(); i++) {
+            float value = (i - 0.5f) / 255.0f; // 255.0f is the max value.
+            thresholds_[i] = dstColorSpace.ToLinear(Vector3f { value, value, value })[0];
+        }
+        // column i is the conversion of the i-th primary
+        for (int i = 0; i < dstLength; i++) {
+            Vector3f primary { 0.0f, 0.0f, 0.0f };
+            primary[i] = 1.0f;
+            Vector3f column = dstColorSpace.XYZToLinear(srcColorSpace.LinearToXYZ(primary));
+            for (int j = 0; j < dstLength; j++) {
+                matrix_[j * dstLength + i] = column[j];
+            }
+        }
+    }
+    ~GamutConvertKernel() = default;
+
+    static bool IsSupportedFormat(int32_t pixelFormat)
+    {
+        return GetPixelBytes(pixelFormat) > 0;
+    }
+
+    static uint32_t GetPixelBytes(int32_t pixelFormat)
+    {
+        switch (static_cast<GraphicPixelFormat>(pixelFormat)) {
+            case GraphicPixelFormat::GRAPHIC_PIXEL_FMT_RGBX_8888:
+            case GraphicPixelFormat::GRAPHIC_PIXEL_FMT_RGBA_8888:
+            case GraphicPixelFormat::GRAPHIC_PIXEL_FMT_BGRX_8888:
+            case GraphicPixelFormat::GRAPHIC_PIXEL_FMT_BGRA_8888:
+                return 4; // 4 bytes per pixel.
+            case GraphicPixelFormat::GRAPHIC_PIXEL_FMT_RGB_888:
+                return 3; // 3 bytes per pixel.
+            default:
+                return 0;
+        }
+    }
+
+    void ConvertPixels(uint8_t* dst, const uint8_t* src, int32_t count, int32_t pixelFormat) const
+    {
+        switch (static_cast<GraphicPixelFormat>(pixelFormat)) {
+            case GraphicPixelFormat::GRAPHIC_PIXEL_FMT_RGBX_8888:
+            case GraphicPixelFormat::GRAPHIC_PIXEL_FMT_RGBA_8888: {
+                // 4 bytes per pixel, R: 0, B: 2
+                ConvertPixels<4, 0, 2>(dst, src, count);
+                break;
+            }
+            case GraphicPixelFormat::GRAPHIC_PIXEL_FMT_BGRX_8888:
+            case GraphicPixelFormat::GRAPHIC_PIXEL_FMT_BGRA_8888: {
+                // 4 bytes per pixel, R: 2, B: 0
+                ConvertPixels<4, 2, 0>(dst, src, count);
+                break;
+            }
+            case GraphicPixelFormat::GRAPHIC_PIXEL_FMT_RGB_888: {
+                // 3 bytes per pixel, R: 0, B: 2
+                ConvertPixels<3, 0, 2>(dst, src, count);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+private:
+    template<uint32_t PIXEL_BYTES, uint32_t R, uint32_t B>
+    void ConvertPixels(uint8_t* dst, const uint8_t* src, int32_t count) const
+    {
+        constexpr uint32_t G = 1;
+        constexpr uint32_t A = 3;
+        for (int32_t i = 0; i < count; i++) {
+            const uint8_t* srcPixel = src + i * PIXEL_BYTES;
+            uint8_t* dstPixel = dst + i * PIXEL_BYTES;
+            float r = toLinear_[srcPixel[R]];
+            float g = toLinear_[srcPixel[G]];
+            float b = toLinear_[srcPixel[B]];
+            // 0 - 8: index of matrix_
+            dstPixel[R] = ToUint8(matrix_[0] * r + matrix_[1] * g + matrix_[2] * b);
+            dstPixel[G] = ToUint8(matrix_[3] * r + matrix_[4] * g + matrix_[5] * b);
+            dstPixel[B] = ToUint8(matrix_[6] * r + matrix_[7] * g + matrix_[8] * b);
+            if constexpr (PIXEL_BYTES > A) {
+                dstPixel[A] = srcPixel[A];
+            }
+        }
+    }
+
+    uint8_t ToUint8(float linear) const
+    {
+        // the last threshold not above linear, thresholds_[0] is the lowest float
+        uint32_t value = 0;
+        for (uint32_t step = 128; step > 0; step >>= 1) { // 128: half of the 256 thresholds
+            value += (linear >= thresholds_[value + step]) ? step : 0;
+        }
+        return static_cast<uint8_t>(value);
+    }
+
+    std::array<float, 256> toLinear_ {}; // 256: all the 8 bit values
+    std::array<float, 256> thresholds_ {};
+    std::array<float, dstLength * dstLength> matrix_ {}; // linear rgb of src to linear rgb of dst, row-major
+};
+
 bool ConvertBufferColorGamut(std::vector<uint8_t>& dstBuf, const sptr<OHOS::SurfaceBuffer>& srcBuf,
     GraphicColorGamut srcGamut, GraphicColorGamut dstGamut, const std::vector<GraphicHDRMetaData>& metaDatas)
 {
@@ -647,6 +789,18 @@ bool ConvertBufferColorGamut(std::vector<uint8_t>& dstBuf, const sptr<OHOS::Surf
     uint32_t offsetDst = 0, offsetSrc = 0;
     auto& srcColorSpace = GetColorSpaceOfCertainGamut(srcGamut, metaDatas);
     auto& dstColorSpace = GetColorSpaceOfCertainGamut(dstGamut, metaDatas);
+    if (GamutConvertKernel::IsSupportedFormat(pixelFormat)) {
+        uint32_t pixelBytes = GamutConvertKernel::GetPixelBytes(pixelFormat);
+        int32_t pixelCount = static_cast<int32_t>(bufferSize / pixelBytes);
+        dstBuf.resize(pixelCount * pixelBytes);
+        GamutConvertKernel kernel(srcColorSpace, dstColorSpace);
+        uint8_t* dstStart = dstBuf.data();
+        ParallelForRanges(pixelCount, GAMUT_PIXELS_PER_TASK, [&](int32_t begin, int32_t end) {
+            kernel.ConvertPixels(dstStart + begin * pixelBytes, srcStart + begin * pixelBytes, end - begin,
+                pixelFormat);
+        });
+        return true;
+    }
     while (offsetSrc < bufferSize) {
         uint8_t* dst = &dstBuf[offsetDst];
         uint8_t* src = srcStart + offsetSrc;
@@ -713,6 +867,46 @@ static int Table_fu2[256] = { -227, -226, -224, -222, -220, -219, -217, -215, -2
     182, 184, 186, 187, 189, 191, 193, 195, 196, 198, 200, 202, 203, 205, 207, 209, 211, 212, 214, 216, 218,
     219, 221, 223, 225 };
 
+inline uint8_t ClampToUint8(int32_t val)
+{
+    return static_cast<uint8_t>(std::min(std::max(val, 0), 255)); // 255 is upper threshold
+}
+
+// Converts the rows [rowBegin, rowEnd) of a YUV420SP buffer, the chroma of a row pair is looked up once into per
+// pixel differences so that the loop writing the pixels has no table lookups and can be vectorized.
+void ConvertYUV420SPRows(uint8_t* rgbaDst, const uint8_t* ybase, const uint8_t* uvbase, int32_t width, int32_t stride,
+    int32_t uOffset, int32_t rowBegin, int32_t rowEnd)
+{
+    std::vector<int32_t> rdif(width);
+    std::vector<int32_t> invgdif(width);
+    std::vector<int32_t> bdif(width);
+    int32_t vOffset = 1 - uOffset;
+    int32_t chromaRow = -1;
+    for (int32_t i = rowBegin; i < rowEnd; i++) {
+        if (i / 2 != chromaRow) { // 2 luma rows share 1 chroma row
+            chromaRow = i / 2;
+            const uint8_t* uvRow = uvbase + chromaRow * stride;
+            for (int32_t j = 0; j < width; j++) {
+                int32_t uvIdx = (j / 2) * 2; // 2 luma pixels share 1 uv pair
+                int32_t U = uvRow[uvIdx + uOffset];
+                int32_t V = uvRow[uvIdx + vOffset];
+                rdif[j] = Table_fv1[V];
+                invgdif[j] = Table_fu1[U] + Table_fv2[V];
+                bdif[j] = Table_fu2[U];
+            }
+        }
+        const uint8_t* yRow = ybase + i * stride;
+        uint8_t* dstRow = rgbaDst + static_cast<size_t>(i) * width * 4; // 4 is color channel
+        for (int32_t j = 0; j < width; j++) {
+            int32_t Y = yRow[j];
+            dstRow[j * 4] = ClampToUint8(Y + rdif[j]); // 4 is color channel
+            dstRow[j * 4 + 1] = ClampToUint8(Y - invgdif[j]); // 4 is color channel, 1 is green
+            dstRow[j * 4 + 2] = ClampToUint8(Y + bdif[j]); // 4 is color channel, 2 is blue
+            dstRow[j * 4 + 3] = 255; // 4 is color channel, 3 is alpha, 255 is upper threshold
+        }
+    }
+}
+
 bool ConvertYUV420SPToRGBA(std::vector<uint8_t>& rgbaBuf, const sptr<OHOS::SurfaceBuffer>& srcBuf)
 {
     if (srcBuf == nullptr || rgbaBuf.empty()) {
@@ -752,40 +946,13 @@ bool ConvertYUV420SPToRGBA(std::vector<uint8_t>& rgbaBuf, const sptr<OHOS::Surfa
     }
     uint8_t* ybase = src;
     uint8_t* ubase = &src[len];
-
-    int rgb[3] = {0, 0, 0};
-    int idx = 0;
-    int rdif = 0;
-    int invgdif = 0;
-    int bdif = 0;
-    for (int i = 0; i < bufferHeight; i++) {
-        for (int j = 0; j < bufferWidth; j++) {
-            int Y = static_cast<int>(ybase[i * bufferStride + j]);
-            int U = static_cast<int>(ubase[i / 2 * bufferStride + (j / 2) * 2 + 1]);
-            int V = static_cast<int>(ubase[i / 2 * bufferStride + (j / 2) * 2]);
-            if (srcBuf->GetFormat() == GRAPHIC_PIXEL_FMT_YCBCR_420_SP) {
-                std::swap(U, V);
-            }
-            rdif = Table_fv1[V];
-            invgdif = Table_fu1[U] + Table_fv2[V];
-            bdif = Table_fu2[U];
-
-            rgb[0] = Y + rdif;
-            rgb[1] = Y - invgdif;
-            rgb[2] = Y + bdif; // 2 is index
-
-            for (int k = 0; k < 3; k++) { // 3 is index
-                idx = (i * bufferWidth + j) * 4 + k; // 4 is color channel
-                if (rgb[k] >= 0 && rgb[k] <= 255) { // 255 is upper threshold
-                    rgbaDst[idx] = static_cast<uint8_t>(rgb[k]);
-                } else {
-                    rgbaDst[idx] = (rgb[k] < 0) ? 0 : 255; // 255 is upper threshold
-                }
-            }
-            ++idx;
-            rgbaDst[idx] = 255; // 255 is upper threshold
-        }
-    }
+    // NV12 stores U first, NV21 stores V first
+    int32_t uOffset = (srcBuf->GetFormat() == GRAPHIC_PIXEL_FMT_YCBCR_420_SP) ? 0 : 1;
+    // the padded rows are not part of the image and rgbaBuf has no room for them
+    int32_t rows = std::min(bufferHeight, static_cast<int32_t>(rgbaBuf.size() / (bufferWidth * 4))); // 4: rgba
+    ParallelForRanges(rows, YUV_ROWS_PER_TASK, [&](int32_t rowBegin, int32_t rowEnd) {
+        ConvertYUV420SPRows(rgbaDst, ybase, ubase, bufferWidth, bufferStride, uOffset, rowBegin, rowEnd);
+    });
     return true;
 }
 } // namespace Detail
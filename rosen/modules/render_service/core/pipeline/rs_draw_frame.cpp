@@ -15,9 +15,12 @@
 
 #include "pipeline/rs_draw_frame.h"
 
+#include <algorithm>
+#include <chrono>
 #include <hitrace_meter.h>
 #include <parameters.h>
 
+#include "ffrt_inner.h"
 #include "rs_trace.h"
 
 #include "pipeline/rs_main_thread.h"
@@ -148,13 +151,14 @@ void RSDrawFrame::PostDirectCompositionJankStats(const JankDurationParams& rsPar
 void RSDrawFrame::Sync()
 {
     RS_TRACE_NAME_FMT("Sync");
+    auto start = std::chrono::steady_clock::now();
     RSMainThread::Instance()->GetContext().GetGlobalRootRenderNode()->Sync();
 
     auto& pendingSyncNodes = RSMainThread::Instance()->GetContext().pendingSyncNodes_;
     for (auto& [id, weakPtr] : pendingSyncNodes) {
         if (auto node = weakPtr.lock()) {
             if (!RSUifirstManager::Instance().CollectSkipSyncNode(node)) {
-                node->Sync();
+                syncNodes_.emplace_back(std::move(node));
             } else {
                 node->SkipSync();
             }
@@ -162,7 +166,54 @@ void RSDrawFrame::Sync()
     }
     pendingSyncNodes.clear();
 
+    auto syncNodeCount = syncNodes_.size();
+    SyncRenderParamsInParallel();
+    for (auto& node : syncNodes_) {
+        node->Sync();
+    }
+    syncNodes_.clear();
+
     unirenderInstance_.Sync(stagingRenderThreadParams_);
+    auto syncTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    RS_TRACE_INT("RSDrawFrame::SyncNodeCount", static_cast<int64_t>(syncNodeCount));
+    RS_TRACE_INT("RSDrawFrame::SyncTime", static_cast<int64_t>(syncTime));
+}
+
+void RSDrawFrame::SyncRenderParamsInParallel()
+{
+    const uint32_t chunkSize = RSSystemProperties::GetParallelSyncSize();
+    if (!RSSystemProperties::GetParallelSyncFlag() || chunkSize == 0 || syncNodes_.size() <= chunkSize) {
+        return;
+    }
+    // Surface and display nodes mark their params dirty inside OnSync and share buffers with other threads, so they
+    // keep syncing their params serially in Sync().
+    std::vector<RSRenderNode*> nodes;
+    nodes.reserve(syncNodes_.size());
+    for (const auto& node : syncNodes_) {
+        auto type = node->GetType();
+        if (type != RSRenderNodeType::SURFACE_NODE && type != RSRenderNodeType::DISPLAY_NODE) {
+            nodes.push_back(node.get());
+        }
+    }
+    if (nodes.size() <= chunkSize) {
+        return;
+    }
+    RS_TRACE_NAME_FMT("SyncRenderParamsInParallel nodes:%zu chunk:%u", nodes.size(), chunkSize);
+    auto syncChunk = [&nodes](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            nodes[i]->SyncRenderParams();
+        }
+    };
+    // the render thread takes the first chunk itself and waits for the others
+    std::vector<ffrt::dependence> deps;
+    for (size_t begin = chunkSize; begin < nodes.size(); begin += chunkSize) {
+        size_t end = std::min(begin + chunkSize, nodes.size());
+        deps.emplace_back(ffrt::submit_h([&syncChunk, begin, end]() { syncChunk(begin, end); }, {}, {},
+            ffrt::task_attr().qos(ffrt::qos_user_interactive)));
+    }
+    syncChunk(0, chunkSize);
+    ffrt::wait(deps);
 }
 
 void RSDrawFrame::UnblockMainThread()
@@ -19,6 +19,7 @@
 #include <cstdint>
 #include <list>
 #include <mutex>
+#include <vector>
 
 #include "system/rs_system_parameters.h"
 
@@ -47,6 +48,7 @@ private:
     void RenderFrame();
     void UnblockMainThread();
     void Sync();
+    void SyncRenderParamsInParallel();
     void Render();
     void ReleaseSelfDrawingNodeBuffer();
     void JankStatsRenderFrameStart();
@@ -61,6 +63,8 @@ private:
     std::condition_variable frameCV_;
     bool canUnblockMainThread = false;
     std::unique_ptr<RSRenderThreadParams> stagingRenderThreadParams_ = nullptr;
+    // nodes to be synced this frame, kept as a member so the capacity is reused
+    std::vector<std::shared_ptr<RSRenderNode>> syncNodes_;
     RsParallelType rsParallelType_;
     static bool debugTraceEnabled_;
 };
@@ -28,6 +28,7 @@
 
 #include "benchmarks/file_utils.h"
 #include "delegate/rs_functional_delegate.h"
+#include "ffrt_inner.h"
 #include "hgm_core.h"
 #include "hgm_energy_consumption_policy.h"
 #include "hgm_frame_rate_manager.h"
@@ -2244,6 +2245,39 @@ RSVisibleLevel RSMainThread::CalcSurfaceNodeVisibleRegion(const std::shared_ptr<
     return visibleLevel;
 }
 
+RSMainThread::OcclusionCacheEntry RSMainThread::CreateOcclusionCacheEntry(
+    const std::shared_ptr<RSSurfaceRenderNode>& surface, bool needProcess) const
+{
+    enum InputFlag : uint32_t {
+        FLAG_TRANSPARENT = 1 << 0,
+        FLAG_WINDOW_CORNER = 1 << 1,
+        FLAG_ANIMATE = 1 << 2,
+        FLAG_CONTAINER_WINDOW = 1 << 3,
+        FLAG_PARENT_LEASH_WINDOW_IN_SCALE = 1 << 4,
+        FLAG_STARTING_WINDOW_STAGE = 1 << 5,
+        FLAG_FILTER_CACHE_VALID = 1 << 6,
+        FLAG_HISEARCH = 1 << 7,
+    };
+    OcclusionCacheEntry entry;
+    entry.id = surface->GetId();
+    entry.needProcess = needProcess;
+    if (!needProcess || !isUniRender_) {
+        return entry;
+    }
+    entry.occlusionRect = surface->GetSurfaceOcclusionRect(isUniRender_);
+    entry.dstRect = surface->GetDstRect();
+    entry.opaqueRegion = surface->GetOpaqueRegion();
+    entry.inputFlags = (surface->IsTransparent() ? FLAG_TRANSPARENT : 0) |
+        (surface->HasWindowCorner() ? FLAG_WINDOW_CORNER : 0) |
+        (surface->GetAnimateState() ? FLAG_ANIMATE : 0) |
+        (surface->HasContainerWindow() ? FLAG_CONTAINER_WINDOW : 0) |
+        (surface->IsParentLeashWindowInScale() ? FLAG_PARENT_LEASH_WINDOW_IN_SCALE : 0) |
+        (surface->IsSurfaceInStartingWindowStage() ? FLAG_STARTING_WINDOW_STAGE : 0) |
+        (surface->GetFilterCacheValidForOcclusion() ? FLAG_FILTER_CACHE_VALID : 0) |
+        (surface->GetName().find("hisearch") != std::string::npos ? FLAG_HISEARCH : 0);
+    return entry;
+}
+
 void RSMainThread::CalcOcclusionImplementation(const std::shared_ptr<RSDisplayRenderNode>& displayNode,
     std::vector<RSBaseRenderNode::SharedPtr>& curAllSurfaces, VisibleData& dstCurVisVec,
     std::map<NodeId, RSVisibleLevel>& dstVisMapForVsyncRate)
@@ -2254,45 +2288,97 @@ void RSMainThread::CalcOcclusionImplementation(const std::shared_ptr<RSDisplayRe
     std::map<NodeId, RSVisibleLevel> visMapForVsyncRate;
     bool hasFilterCacheOcclusion = false;
     bool filterCacheOcclusionEnabled = RSSystemParameters::GetFilterCacheOcculusionEnabled();
+    bool isOcclusionInSpecificScenes = deviceType_ == DeviceType::PC && !threeFingerScenesList_.empty();
+
+    // The result of a surface only depends on itself and the surfaces above it, so the surfaces above the topmost
+    // changed one reuse last result. Non-uniRender merges last visible region and is always calculated from scratch.
+    auto& cache = occlusionCaches_[displayNode ? displayNode->GetId() : INVALID_NODEID];
+    if (!isUniRender_ || cache.focusNodeId != focusNodeId_ ||
+        cache.filterCacheOcclusionEnabled != filterCacheOcclusionEnabled ||
+        cache.isOcclusionInSpecificScenes != isOcclusionInSpecificScenes) {
+        cache.entries.clear();
+    }
+    cache.focusNodeId = focusNodeId_;
+    cache.filterCacheOcclusionEnabled = filterCacheOcclusionEnabled;
+    cache.isOcclusionInSpecificScenes = isOcclusionInSpecificScenes;
+    size_t reusedCount = 0;
 
     auto calculator = [this, &displayNode, &occlusionSurfaces, &accumulatedRegion, &curVisVec, &visMapForVsyncRate,
-        &hasFilterCacheOcclusion, filterCacheOcclusionEnabled] (std::shared_ptr<RSSurfaceRenderNode>& curSurface,
-        bool needSetVisibleRegion) {
+        &hasFilterCacheOcclusion, &cache, &reusedCount, filterCacheOcclusionEnabled] (
+        std::shared_ptr<RSSurfaceRenderNode>& curSurface, bool needSetVisibleRegion, size_t index, bool& useCache) {
         curSurface->setQosCal(vsyncControlEnabled_);
-        if (!CheckSurfaceNeedProcess(occlusionSurfaces, curSurface)) {
-            curSurface->SetVisibleRegionRecursive({}, curVisVec, visMapForVsyncRate);
+        bool needProcess = CheckSurfaceNeedProcess(occlusionSurfaces, curSurface);
+        auto entry = CreateOcclusionCacheEntry(curSurface, needProcess);
+        if (useCache && index < cache.entries.size() && cache.entries[index].IsSameInput(entry)) {
+            const auto& cachedEntry = cache.entries[index];
+            if (needProcess) {
+                curSurface->SetVisibleRegionRecursive(cachedEntry.totalRegion, curVisVec, visMapForVsyncRate,
+                    needSetVisibleRegion, cachedEntry.visibleLevel, !systemAnimatedScenesList_.empty());
+            } else {
+                curSurface->SetVisibleRegionRecursive({}, curVisVec, visMapForVsyncRate);
+            }
+            hasFilterCacheOcclusion = cachedEntry.hasFilterCacheOcclusion;
+            reusedCount++;
             return;
         }
+        if (useCache) {
+            // topmost changed surface, continue with the region accumulated by the surfaces above it
+            useCache = false;
+            accumulatedRegion = index > 0 ? cache.entries[index - 1].accumulatedRegion : Occlusion::Region {};
+        }
 
-        Occlusion::Region curRegion {};
-        Occlusion::Region totalRegion {};
-        auto visibleLevel =
-            CalcSurfaceNodeVisibleRegion(displayNode, curSurface, accumulatedRegion, curRegion, totalRegion);
-
-        curSurface->SetVisibleRegionRecursive(totalRegion, curVisVec, visMapForVsyncRate, needSetVisibleRegion,
-            visibleLevel, !systemAnimatedScenesList_.empty());
-        curSurface->AccumulateOcclusionRegion(
-            accumulatedRegion, curRegion, hasFilterCacheOcclusion, isUniRender_, filterCacheOcclusionEnabled);
+        if (!needProcess) {
+            curSurface->SetVisibleRegionRecursive({}, curVisVec, visMapForVsyncRate);
+        } else {
+            Occlusion::Region curRegion {};
+            entry.visibleLevel =
+                CalcSurfaceNodeVisibleRegion(displayNode, curSurface, accumulatedRegion, curRegion, entry.totalRegion);
+
+            curSurface->SetVisibleRegionRecursive(entry.totalRegion, curVisVec, visMapForVsyncRate,
+                needSetVisibleRegion, entry.visibleLevel, !systemAnimatedScenesList_.empty());
+            curSurface->AccumulateOcclusionRegion(
+                accumulatedRegion, curRegion, hasFilterCacheOcclusion, isUniRender_, filterCacheOcclusionEnabled);
+        }
+        if (!isUniRender_) {
+            return;
+        }
+        entry.accumulatedRegion = accumulatedRegion;
+        entry.hasFilterCacheOcclusion = hasFilterCacheOcclusion;
+        if (index < cache.entries.size()) {
+            cache.entries[index] = std::move(entry);
+        } else {
+            cache.entries.emplace_back(std::move(entry));
+        }
     };
 
+    size_t surfaceCount = 0;
+    bool useCache = true;
     for (auto it = curAllSurfaces.rbegin(); it != curAllSurfaces.rend(); ++it) {
         auto curSurface = RSBaseRenderNode::ReinterpretCast<RSSurfaceRenderNode>(*it);
         if (curSurface && !curSurface->IsLeashWindow()) {
-            curSurface->SetOcclusionInSpecificScenes(deviceType_ == DeviceType::PC && !threeFingerScenesList_.empty());
-            calculator(curSurface, true);
+            curSurface->SetOcclusionInSpecificScenes(isOcclusionInSpecificScenes);
+            calculator(curSurface, true, surfaceCount++, useCache);
         }
     }
+    if (isUniRender_) {
+        cache.entries.resize(surfaceCount);
+    }
+    RS_OPTIONAL_TRACE_NAME_FMT("RSMainThread::CalcOcclusionImplementation surfaces:%zu reused:%zu",
+        surfaceCount, reusedCount);
 
     // if there are valid filter cache occlusion, recalculate surfacenode visibleregionforcallback for WMS/QOS callback
+    // the cache was just refreshed by the pass above, so this pass only applies the cached results
     if (hasFilterCacheOcclusion && isUniRender_) {
         curVisVec.clear();
         visMapForVsyncRate.clear();
         occlusionSurfaces.clear();
         accumulatedRegion = {};
+        surfaceCount = 0;
+        useCache = true;
         for (auto it = curAllSurfaces.rbegin(); it != curAllSurfaces.rend(); ++it) {
             auto curSurface = RSBaseRenderNode::ReinterpretCast<RSSurfaceRenderNode>(*it);
             if (curSurface && !curSurface->IsLeashWindow()) {
-                calculator(curSurface, false);
+                calculator(curSurface, false, surfaceCount++, useCache);
             }
         }
     }
@@ -2381,6 +2467,12 @@ void RSMainThread::CalcOcclusion()
     for (auto& surfaces : curAllSurfacesInDisplay) {
         CalcOcclusionImplementation(surfaces.first, surfaces.second, dstCurVisVec, dstVisMapForVsyncRate);
     }
+    // drop the occlusion cache of removed displays
+    for (auto it = occlusionCaches_.begin(); it != occlusionCaches_.end();) {
+        bool displayExists = std::any_of(curAllSurfacesInDisplay.begin(), curAllSurfacesInDisplay.end(),
+            [id = it->first](const auto& surfaces) { return surfaces.first->GetId() == id; });
+        it = displayExists ? std::next(it) : occlusionCaches_.erase(it);
+    }
 
     // Callback to WMS and QOS
     CallbackToWMS(dstCurVisVec);
@@ -2767,6 +2859,7 @@ void RSMainThread::Animate(uint64_t timestamp)
         auto screenManager = CreateOrGetScreenManager();
         needPrintAnimationDFX = screenManager != nullptr && screenManager->IsAllScreensPowerOff();
     }
+    PrepareAnimate(timestamp);
     // iterate and animate all animating nodes, remove if animation finished
     EraseIf(context_->animatingNodeList_,
         [this, timestamp, period, isDisplaySyncEnabled, isRateDeciderEnabled, &totalAnimationSize,
@@ -2811,6 +2904,8 @@ void RSMainThread::Animate(uint64_t timestamp)
         }
         return !hasRunningAnimation;
     });
+    // the outputs of the scheduler point into animations which may be released from now on
+    animationScheduler_.Clear();
     if (needPrintAnimationDFX && needRequestNextVsync && animationPids.size() > 0) {
         std::string pidList;
         for (const auto& pid : animationPids) {
@@ -2842,6 +2937,37 @@ void RSMainThread::Animate(uint64_t timestamp)
     PerfAfterAnim(needRequestNextVsync);
 }
 
+void RSMainThread::PrepareAnimate(uint64_t timestamp)
+{
+    animationScheduler_.Clear();
+    if (!RSSystemProperties::GetAnimationSchedulerFlag()) {
+        return;
+    }
+    for (const auto& [id, weakNode] : context_->animatingNodeList_) {
+        auto node = weakNode.lock();
+        if (node == nullptr || cacheCmdSkippedInfo_.count(ExtractPid(node->GetId())) > 0) {
+            continue;
+        }
+        node->PrepareAnimate(timestamp, animationScheduler_);
+    }
+    const size_t jobCount = animationScheduler_.GetJobCount();
+    const size_t chunkSize = RSSystemProperties::GetAnimationParallelSize();
+    if (chunkSize == 0 || jobCount <= chunkSize) {
+        animationScheduler_.Evaluate();
+        return;
+    }
+    RS_TRACE_NAME_FMT("RSMainThread::PrepareAnimate jobs:%zu chunk:%zu", jobCount, chunkSize);
+    // the main thread takes the first chunk itself and waits for the others
+    std::vector<ffrt::dependence> deps;
+    for (size_t begin = chunkSize; begin < jobCount; begin += chunkSize) {
+        size_t end = std::min(begin + chunkSize, jobCount);
+        deps.emplace_back(ffrt::submit_h([this, begin, end]() { animationScheduler_.Evaluate(begin, end); }, {}, {},
+            ffrt::task_attr().qos(ffrt::qos_user_interactive)));
+    }
+    animationScheduler_.Evaluate(0, chunkSize);
+    ffrt::wait(deps);
+}
+
 bool RSMainThread::IsNeedProcessBySingleFrameComposer(std::unique_ptr<RSTransactionData>& rsTransactionData)
 {
     if (!isUniRender_ || !rsTransactionData) {
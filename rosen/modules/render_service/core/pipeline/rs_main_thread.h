@@ -30,6 +30,7 @@
 #include "vsync_distributor.h"
 #include "vsync_receiver.h"
 
+#include "animation/rs_animation_scheduler.h"
 #include "command/rs_command.h"
 #include "common/rs_common_def.h"
 #include "common/rs_thread_handler.h"
@@ -369,6 +370,7 @@ private:
     void OnVsync(uint64_t timestamp, uint64_t frameCount, void* data);
     void ProcessCommand();
     void Animate(uint64_t timestamp);
+    void PrepareAnimate(uint64_t timestamp);
     void ConsumeAndUpdateAllNodes();
     void CollectInfoForHardwareComposer();
     void ReleaseAllNodesBuffer();
@@ -381,6 +383,36 @@ private:
     RSVisibleLevel CalcSurfaceNodeVisibleRegion(const std::shared_ptr<RSDisplayRenderNode>& displayNode,
         const std::shared_ptr<RSSurfaceRenderNode>& surfaceNode, Occlusion::Region& accumulatedRegion,
         Occlusion::Region& curRegion, Occlusion::Region& totalRegion);
+    // occlusion inputs and result of one surface, kept across frames to skip surfaces above the topmost changed one
+    struct OcclusionCacheEntry {
+        NodeId id = INVALID_NODEID;
+        Occlusion::Rect occlusionRect;
+        RectI dstRect;
+        Occlusion::Region opaqueRegion;
+        uint32_t inputFlags = 0;
+        bool needProcess = false;
+        RSVisibleLevel visibleLevel = RSVisibleLevel::RS_UNKNOW_VISIBLE_LEVEL;
+        Occlusion::Region totalRegion;
+        // state after this surface is accumulated
+        Occlusion::Region accumulatedRegion;
+        bool hasFilterCacheOcclusion = false;
+
+        bool IsSameInput(const OcclusionCacheEntry& other) const
+        {
+            return id == other.id && needProcess == other.needProcess && inputFlags == other.inputFlags &&
+                occlusionRect == other.occlusionRect && dstRect == other.dstRect &&
+                opaqueRegion.GetRegionRects() == other.opaqueRegion.GetRegionRects();
+        }
+    };
+    struct OcclusionCache {
+        uint64_t focusNodeId = 0;
+        bool filterCacheOcclusionEnabled = false;
+        bool isOcclusionInSpecificScenes = false;
+        // in reverse z-order, same as the calculation
+        std::vector<OcclusionCacheEntry> entries;
+    };
+    OcclusionCacheEntry CreateOcclusionCacheEntry(const std::shared_ptr<RSSurfaceRenderNode>& surface,
+        bool needProcess) const;
     void CalcOcclusionImplementation(const std::shared_ptr<RSDisplayRenderNode>& displayNode,
         std::vector<RSBaseRenderNode::SharedPtr>& curAllSurfaces, VisibleData& dstCurVisVec,
         std::map<NodeId, RSVisibleLevel>& dstPidVisMap);
@@ -555,6 +587,7 @@ private:
     std::atomic<bool> screenPowerOnChanged_ = false;
     std::atomic_bool doWindowAnimate_ = false;
     std::vector<NodeId> lastSurfaceIds_;
+    std::unordered_map<NodeId, OcclusionCache> occlusionCaches_;
     std::atomic<int32_t> focusAppPid_ = -1;
     std::atomic<int32_t> focusAppUid_ = -1;
     const uint8_t opacity_ = 255;
@@ -603,6 +636,7 @@ private:
     std::shared_ptr<RSRenderFrameRateLinker> rsFrameRateLinker_ = nullptr;
     pid_t desktopPidForRotationScene_ = 0;
     FrameRateRange rsCurrRange_;
+    RSAnimationScheduler animationScheduler_;
 
     // UIFirst
     std::list<std::shared_ptr<RSSurfaceRenderNode>> subThreadNodes_;
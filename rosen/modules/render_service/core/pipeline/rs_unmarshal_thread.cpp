@@ -15,12 +15,17 @@
 
 #include "pipeline/rs_unmarshal_thread.h"
 
+#include <chrono>
+#include <cinttypes>
+
 #include "pipeline/rs_base_render_util.h"
 #include "pipeline/rs_main_thread.h"
 #include "platform/common/rs_log.h"
+#include "platform/common/rs_system_properties.h"
 #include "transaction/rs_transaction_data.h"
 #include "rs_frame_report.h"
 #include "rs_profiler.h"
+#include "rs_trace.h"
 
 #ifdef RES_SCHED_ENABLE
 #include "qos.h"
@@ -68,20 +73,30 @@ void RSUnmarshalThread::RecvParcel(std::shared_ptr<MessageParcel>& parcel)
         return;
     }
     bool isPendingUnmarshal = (parcel->GetDataSize() > MIN_PENDING_REQUEST_SYNC_DATA_SIZE);
-    RSTaskMessage::RSTask task = [this, parcel = parcel, isPendingUnmarshal]() {
+    uint64_t recvSeq = nextRecvSeq_.fetch_add(1);
+    RSTaskMessage::RSTask task = [this, parcel = parcel, isPendingUnmarshal, recvSeq]() {
+        RS_TRACE_NAME_FMT("RSUnmarshalThread::Unmarshal seq:%" PRIu64 " size:%zu tid:%d",
+            recvSeq, parcel->GetDataSize(), gettid());
+        auto start = std::chrono::steady_clock::now();
         SetFrameParam(REQUEST_FRAME_AWARE_ID, REQUEST_FRAME_AWARE_LOAD, REQUEST_FRAME_AWARE_NUM, 0);
         SetFrameLoad(REQUEST_FRAME_AWARE_LOAD);
         auto transData = RSBaseRenderUtil::ParseTransactionData(*parcel);
         SetFrameLoad(REQUEST_FRAME_STANDARD_LOAD);
-        if (!transData) {
-            return;
+        if (transData) {
+            RS_PROFILER_ON_PARCEL_RECEIVE(parcel.get(), transData.get());
+        }
+        if (RSSystemProperties::GetUnmarshParallelFlag()) {
+            // One counter per worker, shows the unmarshal latency of each worker in trace.
+            auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start).count();
+            RS_TRACE_INT(("RSUnmarshalWorker" + std::to_string(gettid())).c_str(), latency);
         }
-        RS_PROFILER_ON_PARCEL_RECEIVE(parcel.get(), transData.get());
+        bool hasData = (transData != nullptr);
         {
             std::lock_guard<std::mutex> lock(transactionDataMutex_);
-            cachedTransactionDataMap_[transData->GetSendingPid()].emplace_back(std::move(transData));
+            MergeUnmarshalledData(recvSeq, std::move(transData));
         }
-        if (isPendingUnmarshal) {
+        if (hasData && isPendingUnmarshal) {
             RSMainThread::Instance()->RequestNextVSync();
         }
     };
@@ -107,6 +122,27 @@ void RSUnmarshalThread::RecvParcel(std::shared_ptr<MessageParcel>& parcel)
     }
 }
 
+void RSUnmarshalThread::MergeUnmarshalledData(uint64_t recvSeq, std::unique_ptr<RSTransactionData> transData)
+{
+    if (recvSeq == nextMergeSeq_ && unmarshalledDataMap_.empty()) {
+        // fast path, the parcels are finished in order
+        if (transData) {
+            cachedTransactionDataMap_[transData->GetSendingPid()].emplace_back(std::move(transData));
+        }
+        ++nextMergeSeq_;
+        return;
+    }
+    unmarshalledDataMap_.emplace(recvSeq, std::move(transData));
+    auto iter = unmarshalledDataMap_.begin();
+    while (iter != unmarshalledDataMap_.end() && iter->first == nextMergeSeq_) {
+        if (iter->second) {
+            cachedTransactionDataMap_[iter->second->GetSendingPid()].emplace_back(std::move(iter->second));
+        }
+        iter = unmarshalledDataMap_.erase(iter);
+        ++nextMergeSeq_;
+    }
+}
+
 TransactionDataMap RSUnmarshalThread::GetCachedTransactionData()
 {
     TransactionDataMap transactionData;
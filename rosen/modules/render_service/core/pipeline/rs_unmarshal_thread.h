@@ -16,6 +16,8 @@
 #ifndef RS_UNMARSHAL_THREAD_H
 #define RS_UNMARSHAL_THREAD_H
 
+#include <atomic>
+#include <map>
 #include <mutex>
 
 #include "event_handler.h"
@@ -45,6 +47,8 @@ private:
 
     void SetFrameLoad(int load);
     void SetFrameParam(int requestId, int load, int frameNum, int value);
+    // Called with transactionDataMutex_ held, transData may be nullptr if the parcel is invalid.
+    void MergeUnmarshalledData(uint64_t recvSeq, std::unique_ptr<RSTransactionData> transData);
     static constexpr uint32_t MIN_PENDING_REQUEST_SYNC_DATA_SIZE = 32 * 1024;
 
     std::shared_ptr<AppExecFwk::EventRunner> runner_ = nullptr;
@@ -52,6 +56,11 @@ private:
 
     std::mutex transactionDataMutex_;
     TransactionDataMap cachedTransactionDataMap_;
+    // Parcels are unmarshalled concurrently in parallel mode, the finished ones wait here until all parcels
+    // received before them are finished, so the order of each pid is the order of RecvParcel.
+    std::map<uint64_t, std::unique_ptr<RSTransactionData>> unmarshalledDataMap_;
+    std::atomic<uint64_t> nextRecvSeq_ { 0 };
+    uint64_t nextMergeSeq_ = 0;
     bool willHaveCachedData_ = false;
     int unmarshalTid_ = -1;
     int unmarshalLoad_ = 0;
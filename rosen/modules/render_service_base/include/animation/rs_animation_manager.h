@@ -29,6 +29,7 @@
 
 namespace OHOS {
 namespace Rosen {
+class RSAnimationScheduler;
 class RSDirtyRegionManager;
 class RSPaintFilterCanvas;
 class RSProperties;
@@ -55,6 +56,8 @@ public:
     pid_t GetAnimationPid() const;
 
     std::tuple<bool, bool, bool> Animate(int64_t time, bool nodeIsOnTheTree);
+    // queues the interpolations of the animations Animate(time, nodeIsOnTheTree) would run
+    void PrepareAnimate(int64_t time, bool nodeIsOnTheTree, RSAnimationScheduler& scheduler);
 
     // spring animation related
     void RegisterSpringAnimation(PropertyId propertyId, AnimationId animId);
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_ANIMATION_SCHEDULER_H
+#define RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_ANIMATION_SCHEDULER_H
+
+#include <cstddef>
+#include <vector>
+
+#include "animation/rs_spring_model.h"
+#include "common/rs_macros.h"
+
+namespace OHOS {
+namespace Rosen {
+class RSInterpolator;
+class RSInterpolatorTable;
+
+/**
+ * Collects the interpolations of one frame of animations, so they are evaluated in one pass instead of one animation
+ * at a time. RSRenderAnimation::PrepareAnimate() queues the interpolator input of the frame, Evaluate() computes all
+ * queued values, and RSRenderAnimation::Animate() then writes them to the properties in the usual order.
+ *
+ * Jobs are kept in dense arrays per interpolator type. Evaluate(begin, end) only reads the interpolators and spring
+ * models and writes the output of its own jobs, so disjoint ranges can be evaluated on different threads. The outputs
+ * point into the animations, so the scheduler must be evaluated and cleared before any animation is released.
+ */
+class RSB_EXPORT RSAnimationScheduler {
+public:
+    RSAnimationScheduler() = default;
+    ~RSAnimationScheduler() = default;
+    RSAnimationScheduler(const RSAnimationScheduler&) = delete;
+    RSAnimationScheduler& operator=(const RSAnimationScheduler&) = delete;
+
+    // output is set to interpolator.Interpolate(input)
+    void AddInterpolation(RSInterpolator& interpolator, float input, float& output);
+    // output is set to 1 + model.CalculateDisplacement(time)
+    void AddSpring(const RSSpringModel<float>& model, double time, float& output);
+    // output is set to table.Sample(input)
+    void AddTable(const RSInterpolatorTable& table, float input, float& output);
+
+    size_t GetJobCount() const
+    {
+        return cubicBezierJobs_.size() + interpolatorJobs_.size() + springJobs_.size() + tableJobs_.size();
+    }
+    // evaluates the jobs in [begin, end) of [0, GetJobCount())
+    void Evaluate(size_t begin, size_t end);
+    void Evaluate()
+    {
+        Evaluate(0, GetJobCount());
+    }
+    void Clear();
+
+private:
+    struct InterpolatorJob {
+        const RSInterpolator* interpolator;
+        float input;
+        float* output;
+    };
+    struct SpringJob {
+        const RSSpringModel<float>* model;
+        double time;
+        float* output;
+    };
+    struct TableJob {
+        const RSInterpolatorTable* table;
+        float input;
+        float* output;
+    };
+
+    // cubic bezier is the default curve, it is evaluated without a virtual call
+    std::vector<InterpolatorJob> cubicBezierJobs_;
+    std::vector<InterpolatorJob> interpolatorJobs_;
+    std::vector<SpringJob> springJobs_;
+    std::vector<TableJob> tableJobs_;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_ANIMATION_SCHEDULER_H
@@ -17,8 +17,10 @@
 #define RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_CUBIC_BEZIER_INTERPOLATOR_H
 
 #include <cinttypes>
+#include <memory>
 
 #include "animation/rs_interpolator.h"
+#include "animation/rs_interpolator_cache.h"
 #include "common/rs_common_def.h"
 
 namespace OHOS {
@@ -38,6 +40,9 @@ private:
     RSCubicBezierInterpolator(uint64_t id, float ctlX1, float ctlY1, float ctlX2, float ctlY2);
 
     int BinarySearch(float key) const;
+    // the curve at the precision of a double, used to build table_
+    float CalculatePreciseValue(float input) const;
+    void InitTable();
 
     constexpr static int MAX_RESOLUTION = 4000;
     constexpr static float SEARCH_STEP = 1.0f / MAX_RESOLUTION;
@@ -46,6 +51,8 @@ private:
     float controlY1_ { 0.0 };
     float controlX2_ { 0.0 };
     float controlY2_ { 0.0 };
+    // shared by all interpolators of the same curve, null or not sampled if the curve is evaluated directly
+    std::shared_ptr<const RSInterpolatorTable> table_;
 };
 } // namespace Rosen
 } // namespace OHOS
@@ -58,6 +58,8 @@ private:
     static uint64_t GenerateId();
     float prevInput_ { -1.0f };
     float prevOutput_ { -1.0f };
+
+    friend class RSAnimationScheduler;
 };
 
 class RSB_EXPORT LinearInterpolator : public RSInterpolator {
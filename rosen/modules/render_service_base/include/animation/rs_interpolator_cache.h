@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_INTERPOLATOR_CACHE_H
+#define RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_INTERPOLATOR_CACHE_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "common/rs_macros.h"
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * Samples of a curve at SEGMENT_COUNT + 1 evenly spaced inputs over [0, 1], read back with linear interpolation.
+ * When the table is built, the interpolated value at the middle of every segment is checked against the curve. If
+ * any of them is more than MAX_ERROR away, the samples are dropped and the owner keeps evaluating the curve itself.
+ */
+class RSB_EXPORT RSInterpolatorTable {
+public:
+    static constexpr int SEGMENT_COUNT = 512;
+    // half a pixel over a move of 1000 pixels
+    static constexpr float MAX_ERROR = 5e-4f;
+
+    // duration is not used by the table, spring curves keep the duration they are estimated to rest after in it
+    explicit RSInterpolatorTable(const std::function<float(float)>& curve, float duration = 0.0f);
+    ~RSInterpolatorTable() = default;
+
+    bool IsSampled() const
+    {
+        return !values_.empty();
+    }
+    float GetDuration() const
+    {
+        return duration_;
+    }
+    // input is clamped to [0, 1], only valid if IsSampled()
+    float Sample(float input) const;
+
+private:
+    std::vector<float> values_;
+    float duration_ = 0.0f;
+};
+
+enum class RSInterpolatorTableType : uint8_t {
+    CUBIC_BEZIER,
+    SPRING_INTERPOLATOR,
+    INTERPOLATING_SPRING,
+};
+
+struct RSInterpolatorTableKey {
+    RSInterpolatorTableType type;
+    std::array<float, 4> params;
+
+    bool operator==(const RSInterpolatorTableKey& rhs) const
+    {
+        return type == rhs.type && params == rhs.params;
+    }
+};
+
+/**
+ * Tables of the curves in use, shared by every interpolator and animation with the same curve parameters. Most
+ * animations use one of a few preset curves, so each table is built once and then only sampled.
+ */
+class RSB_EXPORT RSInterpolatorCache {
+public:
+    static constexpr size_t CAPACITY = 128;
+
+    static RSInterpolatorCache& Instance();
+
+    // returns the table cached under key, build is called outside of the lock if there is none.
+    // Keys with non-finite params are never cached and return nullptr.
+    std::shared_ptr<const RSInterpolatorTable> GetTable(const RSInterpolatorTableKey& key,
+        const std::function<std::shared_ptr<const RSInterpolatorTable>()>& build);
+    size_t GetSize();
+    void Clear();
+
+private:
+    RSInterpolatorCache();
+    ~RSInterpolatorCache() = default;
+    RSInterpolatorCache(const RSInterpolatorCache&) = delete;
+    RSInterpolatorCache& operator=(const RSInterpolatorCache&) = delete;
+
+    struct KeyHash {
+        size_t operator()(const RSInterpolatorTableKey& key) const;
+    };
+    struct Entry;
+    using EntryMap = std::unordered_map<RSInterpolatorTableKey, Entry, KeyHash>;
+    struct Entry {
+        std::shared_ptr<const RSInterpolatorTable> table;
+        std::list<EntryMap::iterator>::iterator lruIter;
+    };
+
+    std::mutex mutex_;
+    // most recently used first, entries_ reserves its buckets up front so the iterators are never invalidated
+    std::list<EntryMap::iterator> lru_;
+    EntryMap entries_;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_INTERPOLATOR_CACHE_H
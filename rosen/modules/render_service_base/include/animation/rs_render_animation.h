@@ -25,6 +25,7 @@
 
 namespace OHOS {
 namespace Rosen {
+class RSAnimationScheduler;
 class RSRenderNode;
 
 enum class AnimationState {
@@ -52,6 +53,9 @@ public:
     void SetReversed(bool isReversed);
     bool Marshalling(Parcel& parcel) const override;
     virtual bool Animate(int64_t time);
+    // advances the animation to time and queues its interpolation on the scheduler, the following Animate(time)
+    // applies the evaluated value instead of interpolating again
+    virtual void PrepareAnimate(int64_t time, RSAnimationScheduler& scheduler);
 
     bool IsStarted() const;
     bool IsRunning() const;
@@ -203,6 +207,18 @@ protected:
 
     virtual void OnAnimate(float fraction) {}
 
+    // queues the interpolation OnAnimate(fraction) would do, returns false if nothing is queued
+    virtual bool OnPrepareAnimate(float fraction, RSAnimationScheduler& scheduler, float& value)
+    {
+        return false;
+    }
+
+    // does what OnAnimate(fraction) does, with the value evaluated by the scheduler
+    virtual void OnAnimateWithValue(float fraction, float value)
+    {
+        OnAnimate(fraction);
+    }
+
     virtual void DumpFraction(float fraction, int64_t time) {}
 
     virtual void OnRemoveOnCompletion() {}
@@ -231,6 +247,12 @@ private:
 
     void ProcessOnRepeatFinish();
 
+    // the first part of Animate(), up to the fraction of this frame
+    void BeginFrame(int64_t time);
+
+    // the second part of Animate(), applies the fraction of this frame
+    bool EndFrame();
+
     void SetRepeatCallbackEnable(bool isEnable)
     {
         animationFraction_.SetRepeatCallbackEnable(isEnable);
@@ -250,6 +272,22 @@ private:
     RSRenderNode* target_ { nullptr };
     float lastValueFraction_ { 0.0f };
 
+    struct PreparedFrame {
+        int64_t time = 0;
+        float fraction = 0.0f;
+        float frameInterval = 0.0f;
+        // written by RSAnimationScheduler::Evaluate()
+        float value = 0.0f;
+        bool isPrepared = false;
+        bool needApply = false;
+        // the fill of the start delay is applied by Animate(), the prepare pass writes no property
+        bool isInStartDelay = false;
+        bool hasValue = false;
+        bool isFinished = false;
+        bool isRepeatFinished = false;
+    };
+    PreparedFrame preparedFrame_;
+
     friend class RSAnimation;
     friend class RSModifierManager;
 #ifdef RS_PROFILER_ENABLED
@@ -48,6 +48,10 @@ protected:
 
     void OnAnimate(float fraction) override;
 
+    bool OnPrepareAnimate(float fraction, RSAnimationScheduler& scheduler, float& value) override;
+
+    void OnAnimateWithValue(float fraction, float value) override;
+
     void InitValueEstimator() override;
 
 private:
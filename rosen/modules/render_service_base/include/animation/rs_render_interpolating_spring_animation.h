@@ -16,6 +16,7 @@
 #ifndef RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_RENDER_INTERPOLATING_SPRING_ANIMATION_H
 #define RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_RENDER_INTERPOLATING_SPRING_ANIMATION_H
 
+#include "animation/rs_interpolator_cache.h"
 #include "animation/rs_render_property_animation.h"
 #include "animation/rs_spring_model.h"
 #include "common/rs_macros.h"
@@ -44,6 +45,8 @@ protected:
     void OnSetFraction(float fraction) override;
     void UpdateFractionAfterContinue() override;
     void OnAnimate(float fraction) override;
+    bool OnPrepareAnimate(float fraction, RSAnimationScheduler& scheduler, float& value) override;
+    void OnAnimateWithValue(float fraction, float value) override;
     void InitValueEstimator() override;
     void OnInitialize(int64_t time) override;
 
@@ -56,6 +59,8 @@ private:
     bool GetNeedLogicallyFinishCallback() const;
     void CallLogicallyFinishCallback() const;
     float CalculateTimeFraction(float targetFraction);
+    void OnAnimateDisplacement(float mappedTime, float displacement);
+    bool IsSpringTableValid() const;
 
     std::shared_ptr<RSRenderPropertyBase> startValue_;
     std::shared_ptr<RSRenderPropertyBase> endValue_;
@@ -64,6 +69,8 @@ private:
 
     // used to determine whether the animation is near finish
     float zeroThreshold_ = 0.0f;
+    // 1 + displacement over the fraction, shared by all animations of the same spring
+    std::shared_ptr<const RSInterpolatorTable> springTable_;
 
     friend class RSInterpolatingSpringAnimation;
 };
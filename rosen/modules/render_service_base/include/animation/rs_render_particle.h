@@ -31,6 +31,8 @@
 
 namespace OHOS {
 namespace Rosen {
+class RSRenderParticleStore;
+
 enum class ParticleUpdator: uint32_t {NONE = 0, RANDOM, CURVE};
 
 enum class ShapeType: uint32_t {RECT = 0, CIRCLE, ELLIPSE};
@@ -354,6 +356,7 @@ public:
     const Vector2f& GetImageSize();
     const ParticleType& GetParticleType();
     int64_t GetActiveTime();
+    int64_t GetLifeTime();
     const std::shared_ptr<ParticleRenderParams>& GetParticleRenderParams();
 
     size_t GetImageIndex() const;
@@ -428,13 +431,15 @@ public:
     RSRenderParticleVector() = default;
     ~RSRenderParticleVector() = default;
     RSRenderParticleVector(const RSRenderParticleVector& other)
-        : renderParticleVector_(other.renderParticleVector_), imageVector_(other.imageVector_)
+        : renderParticleVector_(other.renderParticleVector_), particleStores_(other.particleStores_),
+          imageVector_(other.imageVector_)
     {}
 
     RSRenderParticleVector& operator=(const RSRenderParticleVector& other)
     {
         if (this != &other) {
             renderParticleVector_ = other.renderParticleVector_;
+            particleStores_ = other.particleStores_;
             imageVector_ = other.imageVector_;
         }
         return *this;
@@ -442,7 +447,7 @@ public:
 
     int GetParticleSize() const
     {
-        return renderParticleVector_.size();
+        return renderParticleVector_.size() + GetParticleStoreSize();
     }
 
     const std::vector<std::shared_ptr<RSRenderParticle>>& GetParticleVector() const
@@ -450,6 +455,15 @@ public:
         return renderParticleVector_;
     }
 
+    // particles of the running particle animation, one store per emitter
+    const std::vector<std::shared_ptr<RSRenderParticleStore>>& GetParticleStores() const
+    {
+        return particleStores_;
+    }
+
+    // number of particles in all stores
+    size_t GetParticleStoreSize() const;
+
     const std::vector<std::shared_ptr<RSImage>>& GetParticleImageVector() const
     {
         return imageVector_;
@@ -462,6 +476,10 @@ public:
 
     bool operator==(const RSRenderParticleVector& rhs) const
     {
+        // stores are updated in place every frame, so sharing them does not mean the particles are unchanged
+        if (this->GetParticleStoreSize() != 0 || rhs.GetParticleStoreSize() != 0) {
+            return false;
+        }
         bool equal = false;
         if (this->renderParticleVector_.size() != rhs.renderParticleVector_.size() ||
             this->imageVector_.size() != rhs.imageVector_.size()) {
@@ -485,6 +503,7 @@ public:
 
 private:
     std::vector<std::shared_ptr<RSRenderParticle>> renderParticleVector_;
+    std::vector<std::shared_ptr<RSRenderParticleStore>> particleStores_;
     std::vector<std::shared_ptr<RSImage>> imageVector_;
 };
 } // namespace Rosen
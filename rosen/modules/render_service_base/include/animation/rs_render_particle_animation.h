@@ -45,6 +45,8 @@ public:
         return renderParticleVector_;
     }
     bool Animate(int64_t time) override;
+    // particles are emitted and updated in Animate(), there is nothing to interpolate ahead
+    void PrepareAnimate(int64_t time, RSAnimationScheduler& scheduler) override {}
     void UpdateEmitter(const std::vector<std::shared_ptr<EmitterUpdater>>& emitterUpdater);
     void UpdateNoiseField(const std::shared_ptr<ParticleNoiseFields>& particleNoiseFields);
     const std::shared_ptr<RSRenderParticleSystem>& GetParticleSystem()
@@ -17,6 +17,7 @@
 #define RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_RENDER_PARTICLE_EFFECTOR_H
 
 #include "rs_render_particle.h"
+#include "rs_render_particle_store.h"
 #include "rs_particle_noise_field.h"
 namespace OHOS {
 namespace Rosen {
@@ -53,6 +54,25 @@ public:
 
     void Update(const std::shared_ptr<RSRenderParticle>& particle,
         const std::shared_ptr<ParticleNoiseFields>& particleNoiseFields, int64_t deltaTime);
+
+    // Same updates as above, applied field by field to all particles of a store.
+    void UpdateAcceleration(RSRenderParticleStore& store, float deltaTime);
+
+    void UpdateColor(RSRenderParticleStore& store, float deltaTime);
+
+    void UpdateOpacity(RSRenderParticleStore& store, float deltaTime);
+
+    void UpdateScale(RSRenderParticleStore& store, float deltaTime);
+
+    void UpdateSpin(RSRenderParticleStore& store, float deltaTime);
+
+    void UpdatePosition(RSRenderParticleStore& store,
+        const std::shared_ptr<ParticleNoiseFields>& particleNoiseFields, float deltaTime);
+
+    void UpdateActiveTime(RSRenderParticleStore& store, int64_t deltaTime);
+
+    void Update(RSRenderParticleStore& store, const std::shared_ptr<ParticleNoiseFields>& particleNoiseFields,
+        int64_t deltaTime);
 };
 
 } // namespace Rosen
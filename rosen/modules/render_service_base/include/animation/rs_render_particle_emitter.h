@@ -28,6 +28,8 @@ public:
     RSRenderParticleEmitter(std::shared_ptr<ParticleRenderParams> particleParams);
     void PreEmit();
     void EmitParticle(int64_t deltaTime);
+    // adds the particles spawned in this frame to the store instead of GetParticles(), numbering them from emitOrder
+    void EmitParticle(int64_t deltaTime, RSRenderParticleStore& store, uint64_t& emitOrder);
     const std::vector<std::shared_ptr<RSRenderParticle>>& GetParticles();
     bool IsEmitterFinish();
     const std::shared_ptr<ParticleRenderParams>& GetParticleParams()
@@ -36,6 +38,8 @@ public:
     }
 
 private:
+    int32_t CalculateSpawnCount(int64_t deltaTime);
+
     std::vector<std::shared_ptr<RSRenderParticle>> particles_ = {};
     std::shared_ptr<ParticleRenderParams> particleParams_ = {};
     float particleCount_ = 0.f;
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_RENDER_PARTICLE_STORE_H
+#define RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_RENDER_PARTICLE_STORE_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "animation/rs_render_particle.h"
+#include "common/rs_macros.h"
+
+namespace OHOS {
+namespace Rosen {
+class RSRenderParticleEffector;
+
+/**
+ * The particles of one emitter, kept as a structure of arrays. Every field lives in its own contiguous array, so the
+ * effector updates a field for all particles in one tight loop, and RSParticlesDrawable builds its atlas arrays from
+ * the positions, scales and colors without touching a heap object per particle. All particles of a store share the
+ * render params of their emitter, so the updater of each field is chosen once per frame instead of once per particle.
+ */
+class RSB_EXPORT RSRenderParticleStore {
+public:
+    explicit RSRenderParticleStore(const std::shared_ptr<ParticleRenderParams>& particleParams);
+    ~RSRenderParticleStore() = default;
+    RSRenderParticleStore(const RSRenderParticleStore&) = delete;
+    RSRenderParticleStore& operator=(const RSRenderParticleStore&) = delete;
+
+    // copies the initial state of a particle created from the render params of this store, emitOrder tells when it
+    // was emitted relative to the particles of the other stores of the same particle system
+    void Add(RSRenderParticle& particle, uint64_t emitOrder = 0);
+    void Reserve(size_t count);
+    void Clear();
+    // drops the particles which are not alive anymore, the alive ones keep their order
+    void RemoveDeadParticles();
+
+    bool IsAlive(size_t index) const
+    {
+        return dead_[index] == 0 && (infiniteLifeTime_ || activeTime_[index] < lifeTime_[index]);
+    }
+    size_t GetSize() const
+    {
+        return positionX_.size();
+    }
+    const std::shared_ptr<ParticleRenderParams>& GetParticleRenderParams() const
+    {
+        return particleParams_;
+    }
+    ParticleType GetParticleType() const
+    {
+        return particleType_;
+    }
+    float GetRadius() const
+    {
+        return radius_;
+    }
+
+    const std::vector<float>& GetPositionX() const
+    {
+        return positionX_;
+    }
+    const std::vector<float>& GetPositionY() const
+    {
+        return positionY_;
+    }
+    const std::vector<float>& GetVelocityX() const
+    {
+        return velocityX_;
+    }
+    const std::vector<float>& GetVelocityY() const
+    {
+        return velocityY_;
+    }
+    const std::vector<float>& GetSpin() const
+    {
+        return spin_;
+    }
+    const std::vector<float>& GetOpacity() const
+    {
+        return opacity_;
+    }
+    const std::vector<float>& GetScale() const
+    {
+        return scale_;
+    }
+    const std::vector<int16_t>& GetRed() const
+    {
+        return red_;
+    }
+    const std::vector<int16_t>& GetGreen() const
+    {
+        return green_;
+    }
+    const std::vector<int16_t>& GetBlue() const
+    {
+        return blue_;
+    }
+    const std::vector<int16_t>& GetAlpha() const
+    {
+        return alpha_;
+    }
+    const std::vector<int64_t>& GetActiveTime() const
+    {
+        return activeTime_;
+    }
+    // ascending, as the particles are added in emission order and keep it when dead ones are dropped
+    const std::vector<uint64_t>& GetEmitOrder() const
+    {
+        return emitOrder_;
+    }
+
+private:
+    std::shared_ptr<ParticleRenderParams> particleParams_;
+    ParticleType particleType_ = ParticleType::POINTS;
+    float radius_ = 0.f;
+    bool infiniteLifeTime_ = false;
+
+    std::vector<float> positionX_;
+    std::vector<float> positionY_;
+    std::vector<float> velocityX_;
+    std::vector<float> velocityY_;
+    // acceleration in x and y, derived from its value and angle
+    std::vector<float> accelerationX_;
+    std::vector<float> accelerationY_;
+    std::vector<float> accelerationValue_;
+    std::vector<float> accelerationAngle_;
+    std::vector<float> accelerationValueSpeed_;
+    std::vector<float> accelerationAngleSpeed_;
+    std::vector<float> spin_;
+    std::vector<float> spinSpeed_;
+    std::vector<float> opacity_;
+    std::vector<float> opacitySpeed_;
+    std::vector<float> scale_;
+    std::vector<float> scaleSpeed_;
+    std::vector<int16_t> red_;
+    std::vector<int16_t> green_;
+    std::vector<int16_t> blue_;
+    std::vector<int16_t> alpha_;
+    // fractional part of the color channels, carried over between frames
+    std::vector<float> redF_;
+    std::vector<float> greenF_;
+    std::vector<float> blueF_;
+    std::vector<float> alphaF_;
+    std::vector<float> redSpeed_;
+    std::vector<float> greenSpeed_;
+    std::vector<float> blueSpeed_;
+    std::vector<float> alphaSpeed_;
+    std::vector<int64_t> activeTime_;
+    std::vector<int64_t> lifeTime_;
+    std::vector<uint8_t> dead_;
+    std::vector<uint64_t> emitOrder_;
+
+    friend class RSRenderParticleEffector;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_RENDER_PARTICLE_STORE_H
@@ -31,6 +31,11 @@ public:
         std::vector<std::shared_ptr<RSImage>>& imageVector);
     void UpdateParticle(int64_t deltaTime, std::vector<std::shared_ptr<RSRenderParticle>>& activeParticles);
     bool IsFinish(const std::vector<std::shared_ptr<RSRenderParticle>>& activeParticles);
+    // store based variants, activeParticles holds one store per emitter
+    void Emit(int64_t deltaTime, std::vector<std::shared_ptr<RSRenderParticleStore>>& activeParticles,
+        std::vector<std::shared_ptr<RSImage>>& imageVector);
+    void UpdateParticle(int64_t deltaTime, std::vector<std::shared_ptr<RSRenderParticleStore>>& activeParticles);
+    bool IsFinish(const std::vector<std::shared_ptr<RSRenderParticleStore>>& activeParticles);
     void UpdateEmitter(const std::vector<std::shared_ptr<ParticleRenderParams>>& particlesRenderParams);
     void UpdateNoiseField(const std::shared_ptr<ParticleNoiseFields>& particleNoiseFields);
     const std::vector<std::shared_ptr<RSRenderParticleEmitter>>& GetParticleEmitter() const
@@ -47,6 +52,8 @@ private:
     std::vector<std::shared_ptr<RSRenderParticleEmitter>> emitters_ = {};
     std::shared_ptr<ParticleNoiseFields> particleNoiseFields_;
     std::vector<std::shared_ptr<RSImage>> imageVector_;
+    // numbers the particles added to the stores across all emitters, so they can be drawn in emission order
+    uint64_t emitOrder_ = 0;
 };
 } // namespace Rosen
 } // namespace OHOS
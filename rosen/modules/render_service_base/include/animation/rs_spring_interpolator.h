@@ -16,7 +16,10 @@
 #ifndef ROSEN_ENGINE_CORE_ANIMATION_RS_SPRING_INTERPOLATOR_H
 #define ROSEN_ENGINE_CORE_ANIMATION_RS_SPRING_INTERPOLATOR_H
 
+#include <memory>
+
 #include "animation/rs_interpolator.h"
+#include "animation/rs_interpolator_cache.h"
 #include "animation/rs_spring_model.h"
 #include "common/rs_macros.h"
 
@@ -35,7 +38,12 @@ public:
     InterpolatorType GetType() override { return InterpolatorType::SPRING; }
 private:
     RSSpringInterpolator(uint64_t id, float response, float dampingRatio, float initialVelocity);
+    void InitTable();
+    float CalculateValue(float fraction) const;
+
     float estimatedDuration_ = 0.0f;
+    // shared by all interpolators of the same spring, also keeps the estimated duration of the spring
+    std::shared_ptr<const RSInterpolatorTable> table_;
 };
 } // namespace Rosen
 } // namespace OHOS
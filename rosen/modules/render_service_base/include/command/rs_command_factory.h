@@ -16,6 +16,7 @@
 #ifndef ROSEN_RENDER_SERVICE_BASE_COMMAND_RS_COMMAND_FACTORY_H
 #define ROSEN_RENDER_SERVICE_BASE_COMMAND_RS_COMMAND_FACTORY_H
 
+#include <array>
 #include <parcel.h>
 #include <unordered_map>
 
@@ -34,10 +35,17 @@ public:
     void Register(uint16_t type, uint16_t subtype, UnmarshallingFunc func);
     UnmarshallingFunc GetUnmarshallingFunc(uint16_t type, uint16_t subtype);
 
+    // command types and subtypes are small and dense, so most commands are found by direct indexing
+    static constexpr uint16_t MAX_COMMAND_TYPE_COUNT = 32;
+    static constexpr uint16_t MAX_COMMAND_SUBTYPE_COUNT = 256;
+
 private:
     RSCommandFactory() = default;
     ~RSCommandFactory() = default;
 
+    std::array<std::array<UnmarshallingFunc, MAX_COMMAND_SUBTYPE_COUNT>, MAX_COMMAND_TYPE_COUNT>
+        unmarshallingFuncTable_ = {};
+    // fallback for the commands out of the range of unmarshallingFuncTable_
     std::unordered_map<uint32_t, UnmarshallingFunc> unmarshallingFuncLUT_;
 };
 
@@ -17,6 +17,7 @@
 #define ROSEN_RENDER_SERVICE_BASE_COMMAND_RS_COMMAND_TEMPLATES_H
 
 #include <cinttypes>
+#include <type_traits>
 #include "command/rs_command.h"
 #include "command/rs_command_factory.h"
 #include "transaction/rs_marshalling_helper.h"
@@ -92,6 +93,15 @@ public:
 
     static inline RSCommandRegister<commandType, commandSubType, Unmarshalling> registry;
 
+    const std::tuple<Params...>& GetParams() const
+    {
+        return params_;
+    }
+    std::tuple<Params...>& GetParams()
+    {
+        return params_;
+    }
+
 private:
     std::tuple<Params...> params_;
 
@@ -107,10 +117,19 @@ private:
         (PatchParameter(function, std::get<Index>(params)), ...);
     }
 
+    template<typename T, typename = void>
+    struct HasPatch : std::false_type {};
+    template<typename T>
+    struct HasPatch<T, std::void_t<decltype(std::declval<T&>().Patch(std::declval<PatchFunction>()))>>
+        : std::true_type {};
+
     template<typename T>
     static void PatchParameter(PatchFunction function, T& value)
     {
-        if (std::is_same<NodeId, T>::value || std::is_same<AnimationId, T>::value ||
+        if constexpr (HasPatch<T>::value) {
+            // parameters holding ids of their own, e.g. RSPropertyDeltaBlock
+            value.Patch(function);
+        } else if (std::is_same<NodeId, T>::value || std::is_same<AnimationId, T>::value ||
             std::is_same<PropertyId, T>::value) {
             auto& id = reinterpret_cast<NodeId&>(value);
             id = function(id);
@@ -21,6 +21,7 @@
 #include "common/rs_macros.h"
 #include "pipeline/rs_render_node.h"
 #include "property/rs_properties.h"
+#include "transaction/rs_property_delta_block.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -73,6 +74,7 @@ enum RSNodeCommandType : uint16_t {
     UPDATE_MODIFIER_WATER_RIPPLE,
     UPDATE_MODIFIER_FLY_OUT,
     REMOVE_ALL_MODIFIERS,
+    UPDATE_MODIFIER_DELTA_BLOCK,
 };
 
 class RSB_EXPORT RSNodeCommandHelper {
@@ -84,31 +86,14 @@ public:
     template<typename T>
     static void UpdateModifier(RSContext& context, NodeId nodeId, T value, PropertyId id, PropertyUpdateType type)
     {
-        std::shared_ptr<RSRenderPropertyBase> prop = std::make_shared<RSRenderProperty<T>>(value, id);
         auto& nodeMap = context.GetNodeMap();
         auto node = nodeMap.GetRenderNode<RSRenderNode>(nodeId);
         if (!node) {
             return;
         }
-        auto modifier = node->GetModifier(id);
-        if (!modifier) {
-            return;
-        }
-        switch (type) {
-            case UPDATE_TYPE_OVERWRITE:
-                modifier->Update(prop, false);
-                break;
-            case UPDATE_TYPE_INCREMENTAL:
-                modifier->Update(prop, true);
-                break;
-            case UPDATE_TYPE_FORCE_OVERWRITE:
-                modifier->Update(prop, false);
-                node->GetAnimationManager().CancelAnimationByPropertyId(id);
-                break;
-            default:
-                break;
-        }
+        UpdateNodeModifier(*node, value, id, type);
     }
+    static void UpdateModifierDeltaBlock(RSContext& context, NodeId nodeId, const RSPropertyDeltaBlock& block);
     static void UpdateModifierDrawCmdList(
         RSContext& context, NodeId nodeId, Drawing::DrawCmdListPtr value, PropertyId id, bool isDelta)
     {
@@ -143,6 +128,38 @@ public:
 
     static void RegisterGeometryTransitionPair(RSContext& context, NodeId inNodeId, NodeId outNodeId);
     static void UnregisterGeometryTransitionPair(RSContext& context, NodeId inNodeId, NodeId outNodeId);
+
+private:
+    template<typename T>
+    static void UpdateNodeModifier(RSRenderNode& node, const T& value, PropertyId id, PropertyUpdateType type)
+    {
+        auto modifier = node.GetModifier(id);
+        if (!modifier) {
+            return;
+        }
+        std::shared_ptr<RSRenderPropertyBase> prop = std::make_shared<RSRenderProperty<T>>(value, id);
+        switch (type) {
+            case UPDATE_TYPE_OVERWRITE:
+                modifier->Update(prop, false);
+                break;
+            case UPDATE_TYPE_INCREMENTAL:
+                modifier->Update(prop, true);
+                break;
+            case UPDATE_TYPE_FORCE_OVERWRITE:
+                modifier->Update(prop, false);
+                node.GetAnimationManager().CancelAnimationByPropertyId(id);
+                break;
+            default:
+                break;
+        }
+    }
+    template<typename T>
+    static void UpdateNodeModifiers(RSRenderNode& node, const RSPropertyDeltaBlock::Column<T>& column)
+    {
+        for (size_t i = 0; i < column.Size(); i++) {
+            UpdateNodeModifier(node, column.values[i], column.ids[i], column.types[i]);
+        }
+    }
 };
 
 ADD_COMMAND(RSAddModifier,
@@ -268,6 +285,9 @@ ADD_COMMAND(RSUnregisterGeometryTransitionNodePair,
     ARG(RS_NODE, UNREGISTER_GEOMETRY_TRANSITION, RSNodeCommandHelper::UnregisterGeometryTransitionPair, NodeId, NodeId))
 ADD_COMMAND(RSRemoveAllModifiers,
     ARG(RS_NODE, REMOVE_ALL_MODIFIERS, RSNodeCommandHelper::RemoveAllModifiers, NodeId))
+ADD_COMMAND(RSUpdatePropertyDeltaBlock,
+    ARG(RS_NODE, UPDATE_MODIFIER_DELTA_BLOCK, RSNodeCommandHelper::UpdateModifierDeltaBlock,
+        NodeId, RSPropertyDeltaBlock))
 } // namespace Rosen
 } // namespace OHOS
 
@@ -389,8 +389,8 @@ inline typename Container::size_type EraseIf(Container& container, Predicate pre
 {
     // erase from container if pred returns true, backport of c++20 std::remove_if
     typename Container::size_type oldSize = container.size();
-    const typename Container::iterator end = container.end();
-    for (typename Container::iterator iter = container.begin(); iter != end;) {
+    // end() is read every time, erasing from contiguous containers invalidates it
+    for (typename Container::iterator iter = container.begin(); iter != container.end();) {
         if (pred(*iter)) {
             iter = container.erase(iter);
         } else {
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RENDER_SERVICE_CLIENT_CORE_COMMON_RS_FLAT_MAP_H
+#define RENDER_SERVICE_CLIENT_CORE_COMMON_RS_FLAT_MAP_H
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * Map kept as a vector of pairs sorted by key, for the small maps that are iterated far more often than they are
+ * modified. Iteration is in key order like std::map, but inserting and erasing invalidate iterators and references.
+ * Keys must not be modified through the iterators.
+ */
+template<typename Key, typename Value>
+class RSFlatMap {
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key, Value>;
+    using size_type = typename std::vector<value_type>::size_type;
+    using iterator = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    iterator begin()
+    {
+        return data_.begin();
+    }
+    iterator end()
+    {
+        return data_.end();
+    }
+    const_iterator begin() const
+    {
+        return data_.begin();
+    }
+    const_iterator end() const
+    {
+        return data_.end();
+    }
+
+    bool empty() const
+    {
+        return data_.empty();
+    }
+    size_type size() const
+    {
+        return data_.size();
+    }
+    void reserve(size_type size)
+    {
+        data_.reserve(size);
+    }
+    void clear()
+    {
+        data_.clear();
+    }
+
+    iterator find(const Key& key)
+    {
+        auto it = LowerBound(key);
+        return (it != data_.end() && it->first == key) ? it : data_.end();
+    }
+    const_iterator find(const Key& key) const
+    {
+        auto it = LowerBound(key);
+        return (it != data_.end() && it->first == key) ? it : data_.end();
+    }
+    size_type count(const Key& key) const
+    {
+        return find(key) != end() ? 1 : 0;
+    }
+
+    // same as std::map, does nothing if key already exists
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(const Key& key, Args&&... args)
+    {
+        auto it = LowerBound(key);
+        if (it != data_.end() && it->first == key) {
+            return { it, false };
+        }
+        it = data_.emplace(it, std::piecewise_construct, std::forward_as_tuple(key),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+        return { it, true };
+    }
+    Value& operator[](const Key& key)
+    {
+        return emplace(key).first->second;
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        return data_.erase(pos);
+    }
+    size_type erase(const Key& key)
+    {
+        auto it = find(key);
+        if (it == data_.end()) {
+            return 0;
+        }
+        data_.erase(it);
+        return 1;
+    }
+
+private:
+    iterator LowerBound(const Key& key)
+    {
+        return std::lower_bound(data_.begin(), data_.end(), key,
+            [](const value_type& item, const Key& target) -> bool { return item.first < target; });
+    }
+    const_iterator LowerBound(const Key& key) const
+    {
+        return std::lower_bound(data_.begin(), data_.end(), key,
+            [](const value_type& item, const Key& target) -> bool { return item.first < target; });
+    }
+
+    std::vector<value_type> data_;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // RENDER_SERVICE_CLIENT_CORE_COMMON_RS_FLAT_MAP_H
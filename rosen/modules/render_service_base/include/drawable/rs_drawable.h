@@ -125,6 +125,32 @@ public:
     using Ptr = std::shared_ptr<RSDrawable>;
     using Vec = std::array<Ptr, static_cast<size_t>(RSDrawableSlot::MAX)>;
     using Generator = std::function<Ptr(const RSRenderNode&)>;
+    // one bit per RSDrawableSlot
+    using DirtySlots = std::bitset<static_cast<size_t>(RSDrawableSlot::MAX)>;
+
+    // index of the lowest set bit, bits must not be 0. The builtin is not available on every previewer toolchain
+    static size_t LowestSetBit(uint64_t bits)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_t>(__builtin_ctzll(bits));
+#else
+        size_t index = 0;
+        for (; (bits & 1) == 0; bits >>= 1) {
+            index++;
+        }
+        return index;
+#endif
+    }
+
+    // calls func for every set slot in ascending order
+    template<typename Func>
+    static void ForEachSlot(const DirtySlots& slots, Func&& func)
+    {
+        static_assert(static_cast<size_t>(RSDrawableSlot::MAX) <= 64, "slots must fit in one word");
+        for (uint64_t bits = slots.to_ullong(); bits != 0; bits &= bits - 1) {
+            func(static_cast<RSDrawableSlot>(LowestSetBit(bits)));
+        }
+    }
 
     // UI methods: OnUpdate and OnGenerate (static method defined in every subclass) can only access the UI (staging)
     // members, else may cause crash.
@@ -144,11 +170,9 @@ public:
 
     // static generate & update helper methods
     // Step 1, calculate dirtySlots based on dirty modifiers
-    static std::unordered_set<RSDrawableSlot> CalculateDirtySlots(
-        const ModifierDirtyTypes& dirtyTypes, const Vec& drawableVec);
+    static DirtySlots CalculateDirtySlots(const ModifierDirtyTypes& dirtyTypes, const Vec& drawableVec);
     // Step 2, for every dirtySlot, update or generate RSDrawable
-    static bool UpdateDirtySlots(
-        const RSRenderNode& node, Vec& drawableVec, std::unordered_set<RSDrawableSlot>& dirtySlots);
+    static bool UpdateDirtySlots(const RSRenderNode& node, Vec& drawableVec, const DirtySlots& dirtySlots);
     // Step 3, insert necessary Clip/Save/Restore into drawableVec
     static void UpdateSaveRestore(RSRenderNode& node, Vec& drawableVec, uint8_t& drawableVecStatus);
 };
@@ -34,6 +34,7 @@
 namespace OHOS::Rosen {
 class RSRenderNode;
 class RSRenderParams;
+class RSSlabAllocator;
 class RSDisplayRenderNode;
 class RSSurfaceRenderNode;
 class RSSurfaceHandler;
@@ -75,6 +76,11 @@ public:
     RSRenderNodeDrawableAdapter& operator=(const RSRenderNodeDrawableAdapter&) = delete;
     RSRenderNodeDrawableAdapter& operator=(const RSRenderNodeDrawableAdapter&&) = delete;
 
+    // instances are carved from a slab allocator, which RSRenderNodeGC frees a bucket at a time
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr, size_t size);
+    static RSSlabAllocator& GetAllocator();
+
     using Ptr = RSRenderNodeDrawableAdapter*;
     using SharedPtr = std::shared_ptr<RSRenderNodeDrawableAdapter>;
     using WeakPtr = std::weak_ptr<RSRenderNodeDrawableAdapter>;
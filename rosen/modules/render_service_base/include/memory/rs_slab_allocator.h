@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RENDER_SERVICE_BASE_MEMORY_RS_SLAB_ALLOCATOR_H
+#define RENDER_SERVICE_BASE_MEMORY_RS_SLAB_ALLOCATOR_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "common/rs_macros.h"
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * Size-class slab allocator for objects that are created and destroyed at a high rate, such as render nodes, their
+ * drawables and render params. Objects of one size class are packed in 128KB slabs, so nodes created together stay
+ * close in memory. A slab whose blocks are all freed can be reused by any size class. Each allocator keeps one empty
+ * slab of its own, so a single object created and destroyed in a loop does not hit the system allocator, and only a
+ * few more empty slabs are kept over all allocators of the process while the others are released. Objects larger than
+ * the biggest size class go to the general heap.
+ */
+class RSB_EXPORT RSSlabAllocator {
+public:
+    static constexpr size_t SLAB_SIZE = 128 * 1024;
+    static constexpr size_t BLOCK_ALIGN = 64;
+    static constexpr size_t MAX_BLOCK_SIZE = 16 * 1024;
+    // empty slabs kept for reuse by all allocators of the process together, besides the spare slab of each allocator
+    static constexpr size_t MAX_CACHED_EMPTY_SLABS = 2;
+
+    RSSlabAllocator() = default;
+    ~RSSlabAllocator();
+    RSSlabAllocator(const RSSlabAllocator&) = delete;
+    RSSlabAllocator& operator=(const RSSlabAllocator&) = delete;
+
+    void* Allocate(size_t size);
+    void Free(void* ptr, size_t size);
+
+    // number of slabs held from the system, including the cached empty ones
+    size_t GetSlabCount();
+    // number of empty slabs cached by this allocator, including its spare slab
+    size_t GetEmptySlabCount();
+    // number of blocks handed out and not freed yet
+    size_t GetLiveBlockCount();
+
+    /**
+     * While a BatchFree is alive, Free() calls of this allocator on the current thread are only collected, and the
+     * blocks are returned together under one lock when it ends. RSRenderNodeGC uses it to free a whole bucket.
+     */
+    class RSB_EXPORT BatchFree {
+    public:
+        explicit BatchFree(RSSlabAllocator& allocator);
+        ~BatchFree();
+        BatchFree(const BatchFree&) = delete;
+        BatchFree& operator=(const BatchFree&) = delete;
+
+    private:
+        RSSlabAllocator& allocator_;
+        RSSlabAllocator* lastOwner_ = nullptr;
+    };
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+    struct Slab {
+        Slab* prev = nullptr;
+        Slab* next = nullptr;
+        FreeBlock* freeList = nullptr;
+        uint8_t* unused = nullptr;
+        uint32_t blockSize = 0;
+        uint32_t capacity = 0;
+        uint32_t liveCount = 0;
+    };
+    struct SizeClass {
+        // slabs which still have free blocks
+        Slab* partial = nullptr;
+    };
+    static constexpr size_t SLAB_HEADER_SIZE = (sizeof(Slab) + BLOCK_ALIGN - 1) / BLOCK_ALIGN * BLOCK_ALIGN;
+    static constexpr size_t CLASS_COUNT = MAX_BLOCK_SIZE / BLOCK_ALIGN;
+
+    static Slab* GetSlab(void* ptr);
+    Slab* CreateSlab(uint32_t blockSize);
+    static void InitSlab(Slab* slab, uint32_t blockSize);
+    static void ResetSlab(Slab* slab);
+    void ReleaseEmptySlabLocked(Slab* slab);
+    void FreeBlockLocked(void* ptr);
+    static void LinkSlab(Slab*& head, Slab* slab);
+    static void UnlinkSlab(Slab*& head, Slab* slab);
+
+    std::mutex mutex_;
+    std::array<SizeClass, CLASS_COUNT> classes_;
+    // empty slabs linked by their next pointer, shared by all size classes
+    Slab* emptySlabs_ = nullptr;
+    size_t emptySlabCount_ = 0;
+    // empty slab kept by this allocator alone, not counted against MAX_CACHED_EMPTY_SLABS
+    Slab* spareSlab_ = nullptr;
+    size_t slabCount_ = 0;
+    size_t liveBlockCount_ = 0;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // RENDER_SERVICE_BASE_MEMORY_RS_SLAB_ALLOCATOR_H
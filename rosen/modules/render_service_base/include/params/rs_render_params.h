@@ -47,11 +47,17 @@ struct DirtyRegionInfoForDFX {
 };
 struct RSLayerInfo;
 struct ScreenInfo;
+class RSSlabAllocator;
 class RSB_EXPORT RSRenderParams {
 public:
     RSRenderParams(NodeId id) : id_(id) {}
     virtual ~RSRenderParams() = default;
 
+    // params are created and destroyed along with their nodes, so they are carved from a slab allocator too
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr, size_t size);
+    static RSSlabAllocator& GetAllocator();
+
     struct SurfaceParam {
         int width = 0;
         int height = 0;
@@ -20,6 +20,7 @@
 
 #include "common/rs_macros.h"
 #include "common/rs_rect.h"
+#include "pipeline/rs_dirty_tile_map.h"
 #include "platform/common/rs_system_properties.h"
 
 namespace OHOS {
@@ -52,6 +53,10 @@ class RSB_EXPORT RSDirtyRegionManager final {
     friend class RSFilterCacheManager;
 public:
     static constexpr int32_t ALIGNED_BITS = 32;
+    // tiles are aligned the same as UpdateDirtyByAligned(), so aligning never grows a tile rect
+    static constexpr int32_t DIRTY_TILE_SIZE = ALIGNED_BITS;
+    // the bound of the dirty tiles is used as the only damage rect if they are split into more rects
+    static constexpr size_t MAX_DIRTY_TILE_RECTS = 16;
     RSDirtyRegionManager();
     RSDirtyRegionManager(bool isDisplayDirtyManager);
     ~RSDirtyRegionManager() = default;
@@ -105,6 +110,14 @@ public:
     const RectI& GetLatestDirtyRegion() const;
     // return merged historical region upside down in left-bottom origin coordinate
     RectI GetRectFlipWithinSurface(const RectI& rect) const;
+    /*  return merged historical region as the rects of the dirty tiles if tile dirty is enabled, otherwise as
+        GetDirtyRegionFlipWithinSurface(), upside down in left-bottom origin coordinate
+    */
+    std::vector<RectI> GetDirtyRegionRectsFlipWithinSurface() const;
+    bool IsTileDirtyEnabled() const
+    {
+        return isTileDirtyEnabled_;
+    }
     // get aligned rect as times of alignedBits
     static RectI GetPixelAlignedRect(const RectI& rect, int32_t alignedBits = ALIGNED_BITS);
     // return true if current frame dirtyregion is not empty
@@ -182,7 +195,10 @@ private:
     void PushHistory(RectI rect);
     // get his rect according to index offset
     RectI GetHistory(unsigned int i) const;
+    unsigned int GetHistoryIndex(unsigned int i) const;
     void AlignHistory();
+    // push currentframe dirty tiles into history, and merge history tiles according to bufferage
+    void UpdateDirtyTiles();
 
     RectI surfaceRect_;             // dirtyregion clipbounds
     RectI dirtyRegion_;             // dirtyregion after merge history
@@ -200,6 +216,8 @@ private:
     std::vector<bool> debugRegionEnabled_;
     bool isDfxTarget_ = false;
     std::vector<RectI> dirtyHistory_;
+    // tiles of dirtyHistory_, only kept if tile dirty is enabled
+    std::vector<RSDirtyTileMap> dirtyTilesHistory_;
     int historyHead_ = -1;
     unsigned int historySize_ = 0;
     const unsigned HISTORY_QUEUE_MAX_SIZE = 10;
@@ -210,6 +228,12 @@ private:
     bool isDisplayDirtyManager_ = false;
     std::atomic<bool> isSync_ = false;
 
+    // Display dirty managers may also keep the dirty region as tiles, which keeps scattered small dirty rects apart
+    // instead of joining them into one bound. dirtyRegion_ and currentFrameDirtyRegion_ are still kept as the bound.
+    bool isTileDirtyEnabled_ = false;
+    RSDirtyTileMap currentFrameDirtyTiles_;
+    RSDirtyTileMap dirtyTiles_;
+
     // Used for coordinate switch, i.e. dirtyRegion = dirtyRegion + offset.
     // For example when dirtymanager is used in cachesurface when surfacenode's
     // shadow and surfacenode are cached in a surface, dirty region's coordinate should start
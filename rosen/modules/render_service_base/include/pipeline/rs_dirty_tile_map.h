@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RENDER_SERVICE_CLIENT_CORE_PIPELINE_RS_DIRTY_TILE_MAP_H
+#define RENDER_SERVICE_CLIENT_CORE_PIPELINE_RS_DIRTY_TILE_MAP_H
+
+#include <cstdint>
+#include <vector>
+
+#include "common/rs_macros.h"
+#include "common/rs_rect.h"
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * Dirty state of a surface as one bit per tileSize x tileSize tile. Unlike joining rects, marking scattered small
+ * rects keeps them apart, and merging the maps of several frames is a word-wise OR.
+ */
+class RSB_EXPORT RSDirtyTileMap final {
+public:
+    RSDirtyTileMap() = default;
+    ~RSDirtyTileMap() = default;
+
+    // resizes the grid to cover [0, width) x [0, height), all tiles are cleared if the grid changes
+    void SetSize(int32_t width, int32_t height, int32_t tileSize);
+    bool IsSameGrid(int32_t width, int32_t height, int32_t tileSize) const
+    {
+        return width_ == width && height_ == height && tileSize_ == tileSize;
+    }
+    bool IsSameGrid(const RSDirtyTileMap& other) const
+    {
+        return IsSameGrid(other.width_, other.height_, other.tileSize_);
+    }
+
+    // marks every tile the rect touches
+    void MarkRect(const RectI& rect);
+    void MarkAll();
+    // clears every tile the rect does not touch
+    void IntersectRect(const RectI& rect);
+    // other must have the same grid
+    void Or(const RSDirtyTileMap& other);
+    void Clear();
+
+    bool IsEmpty() const;
+    int32_t GetDirtyTileCount() const;
+    // non-overlapping rects covering the dirty tiles, clipped to the grid size. Each run of dirty tiles in a row is
+    // merged with the identical runs of the rows below it.
+    std::vector<RectI> GetRects() const;
+
+private:
+    // tiles [colBegin, colEnd) x [rowBegin, rowEnd) touched by rect, false if it is outside of the grid
+    bool GetTileRange(const RectI& rect, int32_t& colBegin, int32_t& rowBegin, int32_t& colEnd, int32_t& rowEnd) const;
+    void SetBits(int32_t row, int32_t begin, int32_t end);
+    void ClearBits(int32_t row, int32_t begin, int32_t end);
+    bool GetBit(int32_t row, int32_t col) const
+    {
+        return (words_[row * wordsPerRow_ + col / WORD_BITS] >> (col % WORD_BITS)) & 1u;
+    }
+
+    static constexpr int32_t WORD_BITS = 64;
+
+    int32_t width_ = 0;
+    int32_t height_ = 0;
+    int32_t tileSize_ = 0;
+    int32_t cols_ = 0;
+    int32_t rows_ = 0;
+    int32_t wordsPerRow_ = 0;
+    // row-major, bit col % WORD_BITS of word col / WORD_BITS of a row is the tile (row, col)
+    std::vector<uint64_t> words_;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // RENDER_SERVICE_CLIENT_CORE_PIPELINE_RS_DIRTY_TILE_MAP_H
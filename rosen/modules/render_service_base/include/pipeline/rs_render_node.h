@@ -30,6 +30,7 @@
 #include "animation/rs_animation_manager.h"
 #include "animation/rs_frame_rate_range.h"
 #include "common/rs_common_def.h"
+#include "common/rs_flat_map.h"
 #include "common/rs_macros.h"
 #include "common/rs_rect.h"
 #include "draw/surface.h"
@@ -54,6 +55,7 @@ class RSRenderNodeDrawableAdapter;
 class RSRenderNodeShadowDrawable;
 }
 class RSRenderParams;
+class RSAnimationScheduler;
 class RSContext;
 class RSNodeVisitor;
 class RSCommand;
@@ -61,6 +63,7 @@ namespace NativeBufferUtils {
 class VulkanCleanupHelper;
 }
 struct SharedTransitionParam;
+class RSSlabAllocator;
 
 class RSB_EXPORT RSRenderNode : public std::enable_shared_from_this<RSRenderNode>  {
 public:
@@ -80,6 +83,12 @@ public:
     RSRenderNode(const RSRenderNode&&) = delete;
     RSRenderNode& operator=(const RSRenderNode&) = delete;
     RSRenderNode& operator=(const RSRenderNode&&) = delete;
+
+    // instances are carved from a slab allocator, which RSRenderNodeGC frees a bucket at a time
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr, size_t size);
+    static RSSlabAllocator& GetAllocator();
+
     virtual ~RSRenderNode();
 
     void AddChild(SharedPtr child, int index = -1);
@@ -266,6 +275,8 @@ public:
     }
 
     std::tuple<bool, bool, bool> Animate(int64_t timestamp, int64_t period = 0, bool isDisplaySyncEnabled = false);
+    // queues the interpolations of the following Animate(timestamp) on the scheduler
+    void PrepareAnimate(int64_t timestamp, RSAnimationScheduler& scheduler);
 
     bool IsClipBound() const;
     // clipRect has value in UniRender when calling PrepareCanvasRenderNode, else it is nullopt
@@ -683,6 +694,9 @@ public:
     {
         OnSync();
     }
+    // Copy the staging render params to the render params only. It touches nothing but this node's own params and
+    // the params of its drawable, so nodes can run it in parallel before their serial Sync().
+    void SyncRenderParams();
     void AddToPendingSyncList();
     const std::weak_ptr<RSContext> GetContext() const
     {
@@ -816,7 +830,11 @@ private:
     bool IsUifirstArkTsCardNode();
     virtual void OnResetParent() {}
 
-    std::list<WeakPtr> children_;
+    // contiguous, so visiting the children does not chase list nodes
+    std::vector<WeakPtr> children_;
+    // children added at the end of children_ since fullChildrenList_ was generated, ApplyModifiers() inserts them
+    // into fullChildrenList_ instead of generating it again if nothing else changed
+    std::vector<WeakPtr> appendedChildren_;
     std::list<std::pair<SharedPtr, uint32_t>> disappearingChildren_;
 
     // Note: Make sure that fullChildrenList_ is never nullptr. Otherwise, the caller using
@@ -827,6 +845,7 @@ private:
     bool isChildrenSorted_ = true;
 
     void GenerateFullChildrenList();
+    void AppendFullChildrenList();
     void ResortChildren();
     bool ShouldClearSurface();
 
@@ -893,7 +912,7 @@ private:
     RectI oldDirty_;
     RectI oldDirtyInSurface_;
     RSAnimationManager animationManager_;
-    std::map<PropertyId, std::shared_ptr<RSRenderModifier>> modifiers_;
+    RSFlatMap<PropertyId, std::shared_ptr<RSRenderModifier>> modifiers_;
     // bounds and frame modifiers must be unique
     std::shared_ptr<RSRenderModifier> boundsModifier_;
     std::shared_ptr<RSRenderModifier> frameModifier_;
@@ -1028,7 +1047,7 @@ private:
     DrawCmdIndex stagingDrawCmdIndex_;
     std::vector<Drawing::RecordingCanvas::DrawFunc> stagingDrawCmdList_;
 
-    std::unordered_set<RSDrawableSlot> dirtySlots_;
+    RSDrawable::DirtySlots dirtySlots_;
     RSDrawable::Vec drawableVec_;
 
     // for blur cache
@@ -139,6 +139,7 @@ public:
     static PartialRenderType GetPartialRenderEnabled();
     static PartialRenderType GetUniPartialRenderEnabled();
     static float GetClipRectThreshold();
+    static bool GetTileDirtyEnabled();
     static bool GetAllSurfaceVisibleDebugEnabled();
     static bool GetVirtualDirtyDebugEnabled();
     static bool GetVirtualDirtyEnabled();
@@ -238,6 +239,11 @@ public:
     static bool IsForceClient();
     static bool GetUnmarshParallelFlag();
     static uint32_t GetUnMarshParallelSize();
+    static bool GetParallelSyncFlag();
+    static uint32_t GetParallelSyncSize();
+    static bool GetAnimationSchedulerFlag();
+    static uint32_t GetAnimationParallelSize();
+    static uint32_t GetImageCacheBudget();
     static bool GetGpuOverDrawBufferOptimizeEnabled();
 
     static DdgrOpincType GetDdgrOpincType();
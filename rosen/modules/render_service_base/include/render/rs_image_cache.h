@@ -16,8 +16,12 @@
 #ifndef RENDER_SERVICE_CLIENT_CORE_RENDER_RS_IMAGE_CACHE_H
 #define RENDER_SERVICE_CLIENT_CORE_RENDER_RS_IMAGE_CACHE_H
 
+#include <array>
+#include <atomic>
 #include <list>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 #include "image/image.h"
 
 #include "memory/rs_dfx_string.h"
@@ -46,26 +50,67 @@ public:
     void CacheRenderDrawingImageByPixelMapId(uint64_t uniqueId, std::shared_ptr<Drawing::Image> img, pid_t tid = -1);
     std::shared_ptr<Drawing::Image> GetRenderDrawingImageCacheByPixelMapId(uint64_t uniqueId, pid_t tid = -1) const;
 
-    RSImageCache() = default;
+    RSImageCache();
     ~RSImageCache() = default;
     void CollectUniqueId(uint64_t uniqueId);
     void ReleaseUniqueIdList();
+
+    // bytes of released images kept for reuse over all shards, 0 releases images as soon as no RSImage holds them.
+    // the budget is shared by all shards, the least recently released image of any shard is evicted first
+    void SetRetainedBudget(size_t budget);
+    void DumpStatistics(DfxString& log) const;
+
 private:
     RSImageCache(const RSImageCache&) = delete;
     RSImageCache(const RSImageCache&&) = delete;
     RSImageCache& operator=(const RSImageCache&) = delete;
     RSImageCache& operator=(const RSImageCache&&) = delete;
+
+    struct RetainedEntry {
+        uint64_t uniqueId = 0;
+        size_t size = 0;
+        bool isPixelMap = false;
+        // orders the releases of all shards, the smallest one is evicted first
+        uint64_t sequence = 0;
+    };
+    using RetainedList = std::list<RetainedEntry>;
+
+    // the cache is split by uniqueId so threads working on different images do not contend for one lock
+    struct Shard {
+        mutable std::mutex mutex_;
+        // the second element of pair indicates ref count of skImage/pixelMap by RSImage
+        // ref count +1 in RSImage Unmarshalling func and -1 in RSImage destruction func
+        // skImage/pixelMap will be removed from cache if ref count decreases to 0 and it is not retained
+        std::unordered_map<uint64_t, std::pair<std::shared_ptr<Drawing::Image>, uint64_t>> drawingImageCache_;
+        std::unordered_map<uint64_t, std::pair<std::shared_ptr<Media::PixelMap>, uint64_t>> pixelMapCache_;
+        std::unordered_map<uint64_t, std::unordered_map<pid_t, std::shared_ptr<Drawing::Image>>>
+            pixelMapIdRelatedDrawingImageCache_;
+        // entries whose ref count dropped to 0, the most recently released one at the front
+        RetainedList retainedList_;
+        std::unordered_map<uint64_t, RetainedList::iterator> retainedDrawingImages_;
+        std::unordered_map<uint64_t, RetainedList::iterator> retainedPixelMaps_;
+        size_t retainedBytes_ = 0;
+    };
+    static constexpr size_t SHARD_COUNT = 16;
+
+    Shard& GetShard(uint64_t uniqueId) const;
+    bool RetainLocked(Shard& shard, uint64_t uniqueId, size_t size, bool isPixelMap);
+    void ForgetRetainedLocked(Shard& shard, uint64_t uniqueId, bool isPixelMap);
+    // evicts the least recently released entries of all shards until the retained bytes fit the budget,
+    // it locks one shard at a time, so it is called without holding any shard lock
+    void EvictOverBudget();
+    void EvictOldestLocked(Shard& shard, std::vector<std::shared_ptr<void>>& evicted);
     void ReleaseDrawingImageCacheByPixelMapId(uint64_t uniqueId);
+    static void ReleaseDrawingImageCacheByPixelMapIdLocked(Shard& shard, uint64_t uniqueId,
+        std::vector<std::shared_ptr<void>>& released);
 
-    mutable std::mutex mutex_;
-    // the second element of pair indicates ref count of skImage/pixelMap by RSImage
-    // ref count +1 in RSImage Unmarshalling func and -1 in RSImage destruction func
-    // skImage/pixelMap will be removed from cache if ref count decreases to 0
-    std::unordered_map<uint64_t, std::pair<std::shared_ptr<Drawing::Image>, uint64_t>> drawingImageCache_;
-    std::unordered_map<uint64_t, std::pair<std::shared_ptr<Media::PixelMap>, uint64_t>> pixelMapCache_;
-    mutable std::mutex mapMutex_;
-    std::unordered_map<uint64_t, std::unordered_map<pid_t, std::shared_ptr<Drawing::Image>>>
-        pixelMapIdRelatedDrawingImageCache_;
+    mutable std::array<Shard, SHARD_COUNT> shards_;
+    std::atomic<size_t> retainedBudget_ = 0;
+    std::atomic<size_t> retainedBytes_ = 0;
+    std::atomic<uint64_t> releaseSequence_ = 0;
+    mutable std::atomic<uint64_t> hitCount_ = 0;
+    mutable std::atomic<uint64_t> missCount_ = 0;
+    std::atomic<uint64_t> evictionCount_ = 0;
     std::mutex uniqueIdListMutex_;
     std::list<uint64_t> uniqueIdList_;
 };
@@ -17,6 +17,7 @@
 #define RENDER_SERVICE_CLIENT_CORE_RENDER_RS_PARTICLE_DRAWABLE_H
 
 #include "animation/rs_render_particle.h"
+#include "animation/rs_render_particle_store.h"
 #include "draw/canvas.h"
 #include "image/image.h"
 #include "render/rs_image.h"
@@ -26,6 +27,9 @@ class RSB_EXPORT RSParticlesDrawable {
 public:
     explicit RSParticlesDrawable(const std::vector<std::shared_ptr<RSRenderParticle>>& particles,
         std::vector<std::shared_ptr<RSImage>>& imageVector, size_t imageCount);
+    RSParticlesDrawable(const std::vector<std::shared_ptr<RSRenderParticle>>& particles,
+        const std::vector<std::shared_ptr<RSRenderParticleStore>>& particleStores,
+        std::vector<std::shared_ptr<RSImage>>& imageVector, size_t imageCount);
     RSParticlesDrawable() = default;
     ~RSParticlesDrawable() = default;
     void Draw(Drawing::Canvas& canvas, std::shared_ptr<RectF> bounds);
@@ -39,11 +43,23 @@ private:
         Vector2f position, float opacity, float scale);
     void DrawImageFill(Drawing::Canvas& canvas, const std::shared_ptr<RSRenderParticle>& particle,
         Vector2f position, float opacity, float scale);
+    void DrawImageFill(Drawing::Canvas& canvas, const std::shared_ptr<RSImage>& image, const Vector2f& imageSize,
+        float spin, Vector2f position, float opacity, float scale);
+    // builds the atlas arrays straight from the arrays of a store, for the particles in [begin, end)
+    void CaculatePointAtlsArry(Drawing::Canvas& canvas, const RSRenderParticleStore& store, const RectF& bounds,
+        size_t begin, size_t end);
+    void CaculateImageAtlsArry(Drawing::Canvas& canvas, const RSRenderParticleStore& store, const RectF& bounds,
+        size_t begin, size_t end);
+    // walks the stores in the order their particles were emitted, which is the order they are drawn in
+    void CaculateStoreAtlsArry(Drawing::Canvas& canvas, const RectF& bounds);
+    void ClipBounds(Drawing::Canvas& canvas, const RectF& bounds);
     void DrawParticles(Drawing::Canvas& canvas);
     void DrawCircle(Drawing::Canvas& canvas);
     void DrawImages(Drawing::Canvas& canvas);
 
     std::vector<std::shared_ptr<RSRenderParticle>> particles_;
+    std::vector<std::shared_ptr<RSRenderParticleStore>> particleStores_;
+    bool clipped_ = false;
     std::shared_ptr<Drawing::Image> circleImage_;
     std::vector<std::shared_ptr<RSImage>> imageVector_;
     size_t imageCount_;
@@ -71,6 +71,7 @@ class RSRenderTransition;
 class RSRenderTransitionEffect;
 class RSRenderModifier;
 class RSRenderPropertyBase;
+class RSPropertyDeltaBlock;
 template<typename T>
 class RSRenderProperty;
 template<typename T>
@@ -264,6 +265,7 @@ public:
     DECLARE_FUNCTION_OVERLOAD(std::shared_ptr<RSRenderTransitionEffect>)
 
     DECLARE_FUNCTION_OVERLOAD(std::shared_ptr<RSRenderModifier>)
+    DECLARE_FUNCTION_OVERLOAD(RSPropertyDeltaBlock)
 #undef DECLARE_FUNCTION_OVERLOAD
 
     // reloaded marshalling & unmarshalling function for animation
@@ -414,6 +416,9 @@ private:
     static const void* ReadFromParcel(Parcel& parcel, size_t size, bool& isMalloc);
     static bool SkipFromParcel(Parcel& parcel, size_t size);
     static const void* ReadFromAshmem(Parcel& parcel, size_t size, bool& isMalloc);
+    // Data in ashmem is read from the mapping kept by holder instead of copied, so the caller copies it only once.
+    static const void* ReadFromParcelMapped(Parcel& parcel, size_t size, std::shared_ptr<void>& holder);
+    static const void* ReadFromAshmemMapped(Parcel& parcel, size_t size, std::shared_ptr<void>& holder);
 
     static constexpr size_t MAX_DATA_SIZE = 128 * 1024 * 1024; // 128M
     static constexpr size_t MIN_DATA_SIZE = 8 * 1024;          // 8k
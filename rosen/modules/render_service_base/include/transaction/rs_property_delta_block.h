@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RENDER_SERVICE_BASE_TRANSACTION_RS_PROPERTY_DELTA_BLOCK_H
+#define RENDER_SERVICE_BASE_TRANSACTION_RS_PROPERTY_DELTA_BLOCK_H
+
+#include <type_traits>
+#include <vector>
+
+#include <parcel.h>
+
+#include "common/rs_color.h"
+#include "common/rs_common_def.h"
+#include "common/rs_macros.h"
+#include "common/rs_vector2.h"
+#include "common/rs_vector4.h"
+#include "modifier/rs_render_property.h"
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * Property updates of one node packed by value type. Each type is stored in columns of ids, update types and
+ * values, so a block is marshalled as a few plain arrays instead of one command per property.
+ */
+class RSB_EXPORT RSPropertyDeltaBlock {
+public:
+    template<typename T>
+    struct Column {
+        std::vector<PropertyId> ids;
+        std::vector<PropertyUpdateType> types;
+        std::vector<T> values;
+
+        void Add(PropertyId id, const T& value, PropertyUpdateType type)
+        {
+            ids.push_back(id);
+            types.push_back(type);
+            values.push_back(value);
+        }
+        size_t Size() const
+        {
+            return ids.size();
+        }
+    };
+
+    template<typename T>
+    static constexpr bool IsSupportedType()
+    {
+        return std::is_same_v<T, float> || std::is_same_v<T, Vector2f> || std::is_same_v<T, Vector4f> ||
+               std::is_same_v<T, Color>;
+    }
+
+    template<typename T>
+    void Add(PropertyId id, const T& value, PropertyUpdateType type)
+    {
+        GetColumn<T>().Add(id, value, type);
+    }
+
+    template<typename T>
+    Column<T>& GetColumn()
+    {
+        static_assert(IsSupportedType<T>(), "unsupported type of RSPropertyDeltaBlock");
+        if constexpr (std::is_same_v<T, float>) {
+            return floatColumn_;
+        } else if constexpr (std::is_same_v<T, Vector2f>) {
+            return vector2fColumn_;
+        } else if constexpr (std::is_same_v<T, Vector4f>) {
+            return vector4fColumn_;
+        } else {
+            return colorColumn_;
+        }
+    }
+
+    template<typename T>
+    const Column<T>& GetColumn() const
+    {
+        return const_cast<RSPropertyDeltaBlock*>(this)->GetColumn<T>();
+    }
+
+    size_t GetSize() const;
+    bool IsEmpty() const
+    {
+        return GetSize() == 0;
+    }
+
+    bool Marshalling(Parcel& parcel) const;
+    bool Unmarshalling(Parcel& parcel);
+
+#ifdef RS_PROFILER_ENABLED
+    using PatchFunction = NodeId (*)(NodeId);
+    void Patch(PatchFunction function);
+#endif
+
+private:
+    Column<float> floatColumn_;
+    Column<Vector2f> vector2fColumn_;
+    Column<Vector4f> vector4fColumn_;
+    Column<Color> colorColumn_;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // RENDER_SERVICE_BASE_TRANSACTION_RS_PROPERTY_DELTA_BLOCK_H
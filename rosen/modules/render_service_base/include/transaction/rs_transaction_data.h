@@ -173,6 +173,8 @@ public:
 private:
     void AddCommand(std::unique_ptr<RSCommand>& command, NodeId nodeId, FollowType followType);
     void AddCommand(std::unique_ptr<RSCommand>&& command, NodeId nodeId, FollowType followType);
+    // merges consecutive property updates of the same node into one RSUpdatePropertyDeltaBlock command
+    bool MergePropertyUpdate(std::unique_ptr<RSCommand>& command, NodeId nodeId, FollowType followType);
 
     bool UnmarshallingCommand(Parcel& parcel);
     std::vector<std::tuple<NodeId, FollowType, std::unique_ptr<RSCommand>>> payload_ = {};
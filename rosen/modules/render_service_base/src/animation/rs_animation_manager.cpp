@@ -183,6 +183,16 @@ std::tuple<bool, bool, bool> RSAnimationManager::Animate(int64_t time, bool node
     return { hasRunningAnimation, needRequestNextVsync, isCalculateAnimationValue };
 }
 
+void RSAnimationManager::PrepareAnimate(int64_t time, bool nodeIsOnTheTree, RSAnimationScheduler& scheduler)
+{
+    for (auto& [id, animation] : animations_) {
+        if (!nodeIsOnTheTree && animation->GetRepeatCount() == -1) {
+            continue;
+        }
+        animation->PrepareAnimate(time, scheduler);
+    }
+}
+
 void RSAnimationManager::SetRateDeciderEnable(bool enabled, const FrameRateGetFunc& func)
 {
     rateDecider_.SetEnable(enabled);
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "animation/rs_animation_scheduler.h"
+
+#include <algorithm>
+
+#include "animation/rs_cubic_bezier_interpolator.h"
+#include "animation/rs_interpolator.h"
+#include "animation/rs_interpolator_cache.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+// runs function on the jobs whose index, counted from offset, is in [begin, end)
+template<typename Job, typename Function>
+void EvaluateJobs(const std::vector<Job>& jobs, size_t offset, size_t begin, size_t end, Function&& function)
+{
+    size_t last = std::min(end, offset + jobs.size());
+    for (size_t i = std::max(begin, offset); i < last; i++) {
+        function(jobs[i - offset]);
+    }
+}
+} // namespace
+
+void RSAnimationScheduler::AddInterpolation(RSInterpolator& interpolator, float input, float& output)
+{
+    if (interpolator.GetType() == InterpolatorType::CUBIC_BEZIER) {
+        cubicBezierJobs_.push_back({ &interpolator, input, &output });
+    } else {
+        interpolatorJobs_.push_back({ &interpolator, input, &output });
+    }
+}
+
+void RSAnimationScheduler::AddSpring(const RSSpringModel<float>& model, double time, float& output)
+{
+    springJobs_.push_back({ &model, time, &output });
+}
+
+void RSAnimationScheduler::AddTable(const RSInterpolatorTable& table, float input, float& output)
+{
+    tableJobs_.push_back({ &table, input, &output });
+}
+
+void RSAnimationScheduler::Evaluate(size_t begin, size_t end)
+{
+    size_t offset = 0;
+    // Interpolate() caches the last value in the interpolator, which is shared between animations, so the jobs call
+    // InterpolateImpl() which only reads it
+    EvaluateJobs(cubicBezierJobs_, offset, begin, end, [](const InterpolatorJob& job) {
+        *job.output = static_cast<const RSCubicBezierInterpolator*>(job.interpolator)
+                          ->RSCubicBezierInterpolator::InterpolateImpl(job.input);
+    });
+    offset += cubicBezierJobs_.size();
+    EvaluateJobs(interpolatorJobs_, offset, begin, end, [](const InterpolatorJob& job) {
+        *job.output = job.interpolator->InterpolateImpl(job.input);
+    });
+    offset += interpolatorJobs_.size();
+    EvaluateJobs(springJobs_, offset, begin, end, [](const SpringJob& job) {
+        *job.output = 1.0f + job.model->CalculateDisplacement(job.time);
+    });
+    offset += springJobs_.size();
+    EvaluateJobs(tableJobs_, offset, begin, end, [](const TableJob& job) {
+        *job.output = job.table->Sample(job.input);
+    });
+}
+
+void RSAnimationScheduler::Clear()
+{
+    cubicBezierJobs_.clear();
+    interpolatorJobs_.clear();
+    springJobs_.clear();
+    tableJobs_.clear();
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -15,6 +15,8 @@
 
 #include "animation/rs_cubic_bezier_interpolator.h"
 
+#include <cmath>
+
 namespace OHOS {
 namespace Rosen {
 namespace {
@@ -31,18 +33,42 @@ inline float GetCubicBezierValue(const float time, const float ctl1, const float
     return three * oneMinusTime * oneMinusTime * time * ctl1 + three * oneMinusTime * time * time * ctl2 +
            time * time * time;
 }
+
+inline double GetPreciseCubicBezierValue(const double time, const double ctl1, const double ctl2)
+{
+    constexpr double three = 3.0;
+    const double oneMinusTime = 1.0 - time;
+    return three * oneMinusTime * oneMinusTime * time * ctl1 + three * oneMinusTime * time * time * ctl2 +
+           time * time * time;
+}
 } // namespace
 
 RSCubicBezierInterpolator::RSCubicBezierInterpolator(float ctlX1, float ctlY1, float ctlX2, float ctlY2)
     : controlX1_(ctlX1), controlY1_(ctlY1), controlX2_(ctlX2), controlY2_(ctlY2)
-{}
+{
+    InitTable();
+}
 
 RSCubicBezierInterpolator::RSCubicBezierInterpolator(uint64_t id, float ctlX1, float ctlY1, float ctlX2, float ctlY2)
     : RSInterpolator(id), controlX1_(ctlX1), controlY1_(ctlY1), controlX2_(ctlX2), controlY2_(ctlY2)
-{}
+{
+    InitTable();
+}
+
+void RSCubicBezierInterpolator::InitTable()
+{
+    RSInterpolatorTableKey key = { RSInterpolatorTableType::CUBIC_BEZIER,
+        { controlX1_, controlY1_, controlX2_, controlY2_ } };
+    table_ = RSInterpolatorCache::Instance().GetTable(key, [this]() {
+        return std::make_shared<RSInterpolatorTable>([this](float input) { return CalculatePreciseValue(input); });
+    });
+}
 
 float RSCubicBezierInterpolator::InterpolateImpl(float input) const
 {
+    if (table_ != nullptr && table_->IsSampled()) {
+        return table_->Sample(input);
+    }
     constexpr float ONE = 1.0f;
     if (ROSEN_EQ(input, ONE, 1e-6f)) {
         return ONE;
@@ -78,9 +104,35 @@ RSCubicBezierInterpolator* RSCubicBezierInterpolator::Unmarshalling(Parcel& parc
     if (!(parcel.ReadFloat(x1) && parcel.ReadFloat(y1) && parcel.ReadFloat(x2) && parcel.ReadFloat(y2))) {
         return nullptr;
     }
+    if (!(std::isfinite(x1) && std::isfinite(y1) && std::isfinite(x2) && std::isfinite(y2))) {
+        return nullptr;
+    }
     return new RSCubicBezierInterpolator(id, x1, y1, x2, y2);
 }
 
+float RSCubicBezierInterpolator::CalculatePreciseValue(float input) const
+{
+    if (input <= 0.0f) {
+        return 0.0f;
+    }
+    if (input >= 1.0f) {
+        return 1.0f;
+    }
+    // x of the curve grows with time for control points in [0, 1], find the time of input by bisection
+    constexpr int iterations = 50;
+    double low = 0.0;
+    double high = 1.0;
+    for (int i = 0; i < iterations; i++) {
+        double middle = (low + high) * 0.5;
+        if (GetPreciseCubicBezierValue(middle, controlX1_, controlX2_) < input) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    return static_cast<float>(GetPreciseCubicBezierValue((low + high) * 0.5, controlY1_, controlY2_));
+}
+
 int RSCubicBezierInterpolator::BinarySearch(float key) const
 {
     int low = 0;
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "animation/rs_interpolator_cache.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace OHOS {
+namespace Rosen {
+RSInterpolatorTable::RSInterpolatorTable(const std::function<float(float)>& curve, float duration)
+    : duration_(duration)
+{
+    std::vector<float> values(SEGMENT_COUNT + 1);
+    for (int i = 0; i <= SEGMENT_COUNT; i++) {
+        values[i] = curve(static_cast<float>(i) / SEGMENT_COUNT);
+        if (!std::isfinite(values[i])) {
+            return;
+        }
+    }
+    for (int i = 0; i < SEGMENT_COUNT; i++) {
+        float middle = curve((i + 0.5f) / SEGMENT_COUNT);
+        if (!(std::fabs(middle - (values[i] + values[i + 1]) * 0.5f) <= MAX_ERROR)) {
+            return;
+        }
+    }
+    values_ = std::move(values);
+}
+
+float RSInterpolatorTable::Sample(float input) const
+{
+    if (!(input > 0.0f)) {
+        return values_.front();
+    }
+    if (input >= 1.0f) {
+        return values_.back();
+    }
+    float position = input * SEGMENT_COUNT;
+    int index = std::min(static_cast<int>(position), SEGMENT_COUNT - 1);
+    float weight = position - index;
+    return values_[index] + (values_[index + 1] - values_[index]) * weight;
+}
+
+RSInterpolatorCache::RSInterpolatorCache()
+{
+    // one more than CAPACITY, the newest entry is inserted before the oldest one is evicted
+    entries_.reserve(CAPACITY + 1);
+}
+
+RSInterpolatorCache& RSInterpolatorCache::Instance()
+{
+    static RSInterpolatorCache instance;
+    return instance;
+}
+
+size_t RSInterpolatorCache::KeyHash::operator()(const RSInterpolatorTableKey& key) const
+{
+    size_t hash = std::hash<uint8_t>()(static_cast<uint8_t>(key.type));
+    for (float param : key.params) {
+        hash = hash * 31 + std::hash<float>()(param); // 31 is a common prime for hash combination
+    }
+    return hash;
+}
+
+std::shared_ptr<const RSInterpolatorTable> RSInterpolatorCache::GetTable(const RSInterpolatorTableKey& key,
+    const std::function<std::shared_ptr<const RSInterpolatorTable>()>& build)
+{
+    // NaN never compares equal to itself, such keys could not be found or evicted again
+    if (!std::all_of(key.params.begin(), key.params.end(), [](float param) { return std::isfinite(param); })) {
+        return nullptr;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            lru_.splice(lru_.begin(), lru_, it->second.lruIter);
+            return it->second.table;
+        }
+    }
+    auto table = build();
+    if (table == nullptr) {
+        return nullptr;
+    }
+    std::shared_ptr<const RSInterpolatorTable> evicted;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto [it, inserted] = entries_.try_emplace(key);
+    if (!inserted) {
+        // built by another thread in the meantime
+        lru_.splice(lru_.begin(), lru_, it->second.lruIter);
+        return it->second.table;
+    }
+    lru_.push_front(it);
+    it->second = { table, lru_.begin() };
+    if (entries_.size() > CAPACITY) {
+        auto last = lru_.back();
+        evicted = std::move(last->second.table);
+        lru_.pop_back();
+        entries_.erase(last);
+    }
+    return table;
+}
+
+size_t RSInterpolatorCache::GetSize()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+void RSInterpolatorCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    lru_.clear();
+    entries_.clear();
+}
+} // namespace Rosen
+} // namespace OHOS
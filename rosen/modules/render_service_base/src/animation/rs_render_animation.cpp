@@ -314,22 +314,49 @@ void RSRenderAnimation::ProcessOnRepeatFinish()
 
 bool RSRenderAnimation::Animate(int64_t time)
 {
+    if (!preparedFrame_.isPrepared || preparedFrame_.time != time) {
+        BeginFrame(time);
+    }
+    preparedFrame_.isPrepared = false;
+    if (preparedFrame_.isInStartDelay) {
+        ProcessFillModeOnStart(preparedFrame_.fraction);
+        return false;
+    }
+    if (!preparedFrame_.needApply) {
+        return state_ == AnimationState::FINISHED;
+    }
+    return EndFrame();
+}
+
+void RSRenderAnimation::PrepareAnimate(int64_t time, RSAnimationScheduler& scheduler)
+{
+    BeginFrame(time);
+    preparedFrame_.isPrepared = true;
+    preparedFrame_.hasValue = preparedFrame_.needApply &&
+        OnPrepareAnimate(preparedFrame_.fraction, scheduler, preparedFrame_.value);
+}
+
+void RSRenderAnimation::BeginFrame(int64_t time)
+{
+    preparedFrame_ = PreparedFrame();
+    preparedFrame_.time = time;
+
     // calculateAnimationValue_ is embedded modify for stat animate frame drop
     calculateAnimationValue_ = true;
 
     if (!IsRunning()) {
-        return state_ == AnimationState::FINISHED;
+        return;
     }
 
     // set start time and return
     if (needUpdateStartTime_) {
         SetStartTime(time);
-        return state_ == AnimationState::FINISHED;
+        return;
     }
 
     // if time not changed since last frame, return
     if (time <= animationFraction_.GetLastFrameTime()) {
-        return state_ == AnimationState::FINISHED;
+        return;
     }
 
     if (needInitialize_) {
@@ -344,25 +371,39 @@ bool RSRenderAnimation::Animate(int64_t time)
     auto [fraction, isInStartDelay, isFinished, isRepeatFinished] = animationFraction_.GetAnimationFraction(time);
     if (isInStartDelay) {
         calculateAnimationValue_ = false;
-        ProcessFillModeOnStart(fraction);
+        preparedFrame_.fraction = fraction;
+        preparedFrame_.isInStartDelay = true;
         ROSEN_LOGD("RSRenderAnimation::Animate, isInStartDelay is true");
-        return false;
+        return;
     }
+    preparedFrame_.fraction = fraction;
+    preparedFrame_.frameInterval = frameInterval;
+    preparedFrame_.needApply = true;
+    preparedFrame_.isFinished = isFinished;
+    preparedFrame_.isRepeatFinished = isRepeatFinished;
+}
 
+bool RSRenderAnimation::EndFrame()
+{
+    float fraction = preparedFrame_.fraction;
     RecordLastAnimateValue();
-    OnAnimate(fraction);
-    DumpFraction(fraction, time);
-    UpdateAnimateVelocity(frameInterval);
+    if (preparedFrame_.hasValue) {
+        OnAnimateWithValue(fraction, preparedFrame_.value);
+    } else {
+        OnAnimate(fraction);
+    }
+    DumpFraction(fraction, preparedFrame_.time);
+    UpdateAnimateVelocity(preparedFrame_.frameInterval);
 
-    if (isRepeatFinished) {
+    if (preparedFrame_.isRepeatFinished) {
         ProcessOnRepeatFinish();
     }
-    if (isFinished) {
+    if (preparedFrame_.isFinished) {
         ProcessFillModeOnFinish(fraction);
         ROSEN_LOGD("RSRenderAnimation::Animate, isFinished is true");
         return true;
     }
-    return isFinished;
+    return false;
 }
 
 void RSRenderAnimation::SetStartTime(int64_t time)
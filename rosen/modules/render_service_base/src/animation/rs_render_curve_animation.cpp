@@ -15,6 +15,7 @@
 
 #include "animation/rs_render_curve_animation.h"
 
+#include "animation/rs_animation_scheduler.h"
 #include "animation/rs_value_estimator.h"
 #include "platform/common/rs_log.h"
 #include "transaction/rs_marshalling_helper.h"
@@ -127,6 +128,21 @@ void RSRenderCurveAnimation::OnAnimateInner(float fraction, const std::shared_pt
     valueEstimator_->UpdateAnimationValue(interpolatorValue, GetAdditive());
 }
 
+bool RSRenderCurveAnimation::OnPrepareAnimate(float fraction, RSAnimationScheduler& scheduler, float& value)
+{
+    if (GetPropertyId() == 0 || valueEstimator_ == nullptr || interpolator_ == nullptr) {
+        return false;
+    }
+    scheduler.AddInterpolation(*interpolator_, fraction, value);
+    return true;
+}
+
+void RSRenderCurveAnimation::OnAnimateWithValue(float fraction, float value)
+{
+    SetValueFraction(value);
+    valueEstimator_->UpdateAnimationValue(value, GetAdditive());
+}
+
 void RSRenderCurveAnimation::InitValueEstimator()
 {
     if (valueEstimator_ == nullptr) {
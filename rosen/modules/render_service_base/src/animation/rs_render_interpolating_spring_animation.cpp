@@ -15,6 +15,7 @@
 
 #include "animation/rs_render_interpolating_spring_animation.h"
 
+#include "animation/rs_animation_scheduler.h"
 #include "animation/rs_value_estimator.h"
 #include "command/rs_animation_command.h"
 #include "command/rs_message_processor.h"
@@ -182,7 +183,38 @@ void RSRenderInterpolatingSpringAnimation::OnAnimate(float fraction)
         return;
     }
     auto mappedTime = fraction * GetDuration() * MILLISECOND_TO_SECOND;
-    float displacement = 1.0f + CalculateDisplacement(mappedTime);
+    OnAnimateDisplacement(mappedTime,
+        IsSpringTableValid() ? springTable_->Sample(fraction) : 1.0f + CalculateDisplacement(mappedTime));
+}
+
+bool RSRenderInterpolatingSpringAnimation::IsSpringTableValid() const
+{
+    // the table maps the fraction with the estimated duration, which may have been replaced since
+    return springTable_ != nullptr && springTable_->IsSampled() &&
+        GetDuration() == std::lroundf(springTable_->GetDuration() * SECOND_TO_MILLISECOND);
+}
+
+bool RSRenderInterpolatingSpringAnimation::OnPrepareAnimate(
+    float fraction, RSAnimationScheduler& scheduler, float& value)
+{
+    if (valueEstimator_ == nullptr || GetPropertyId() == 0 || ROSEN_EQ(fraction, 1.0f)) {
+        return false;
+    }
+    if (IsSpringTableValid()) {
+        scheduler.AddTable(*springTable_, fraction, value);
+    } else {
+        scheduler.AddSpring(*this, fraction * GetDuration() * MILLISECOND_TO_SECOND, value);
+    }
+    return true;
+}
+
+void RSRenderInterpolatingSpringAnimation::OnAnimateWithValue(float fraction, float value)
+{
+    OnAnimateDisplacement(fraction * GetDuration() * MILLISECOND_TO_SECOND, value);
+}
+
+void RSRenderInterpolatingSpringAnimation::OnAnimateDisplacement(float mappedTime, float displacement)
+{
     SetValueFraction(displacement);
     valueEstimator_->UpdateAnimationValue(displacement, GetAdditive());
     if (GetNeedLogicallyFinishCallback() && (animationFraction_.GetRemainingRepeatCount() == 1)) {
@@ -206,8 +238,25 @@ void RSRenderInterpolatingSpringAnimation::OnInitialize(int64_t time)
     initialOffset_ = -1.0f;
     initialVelocity_ = initialOffset_ * (-normalizedInitialVelocity_);
     CalculateSpringParameters();
+    // the velocity of a gesture differs on every fling, only springs starting at rest share a table
+    springTable_ = nullptr;
+    if (normalizedInitialVelocity_ == 0.0f) {
+        RSInterpolatorTableKey key = { RSInterpolatorTableType::INTERPOLATING_SPRING,
+            { response_, dampingRatio_, minimumAmplitudeRatio_, 0.0f } };
+        springTable_ = RSInterpolatorCache::Instance().GetTable(key, [this]() {
+            float duration = EstimateDuration();
+            // the displacement below maps the fraction with the animation duration
+            SetDuration(std::lroundf(duration * SECOND_TO_MILLISECOND));
+            return std::make_shared<RSInterpolatorTable>(
+                [this](float fraction) {
+                    return 1.0f + CalculateDisplacement(fraction * GetDuration() * MILLISECOND_TO_SECOND);
+                },
+                duration);
+        });
+    }
     // use duration calculated by spring model as animation duration
-    SetDuration(std::lroundf(EstimateDuration() * SECOND_TO_MILLISECOND));
+    float duration = springTable_ != nullptr ? springTable_->GetDuration() : EstimateDuration();
+    SetDuration(std::lroundf(duration * SECOND_TO_MILLISECOND));
     // this will set needInitialize_ to false
     RSRenderPropertyAnimation::OnInitialize(time);
 }
@@ -19,6 +19,7 @@
 #include <random>
 
 #include "animation/rs_interpolator.h"
+#include "animation/rs_render_particle_store.h"
 #include "animation/rs_render_particle_system.h"
 #include "common/rs_color.h"
 namespace OHOS {
@@ -603,6 +604,11 @@ int64_t RSRenderParticle::GetActiveTime()
     return activeTime_;
 }
 
+int64_t RSRenderParticle::GetLifeTime()
+{
+    return lifeTime_;
+}
+
 const std::shared_ptr<ParticleRenderParams>& RSRenderParticle::GetParticleRenderParams()
 {
     return particleParams_;
@@ -775,5 +781,16 @@ Vector2f RSRenderParticle::CalculateParticlePosition(
     return Vector2f { positionX, positionY };
 }
 
+size_t RSRenderParticleVector::GetParticleStoreSize() const
+{
+    size_t size = 0;
+    for (const auto& store : particleStores_) {
+        if (store != nullptr) {
+            size += store->GetSize();
+        }
+    }
+    return size;
+}
+
 } // namespace Rosen
 } // namespace OHOS
@@ -52,16 +52,15 @@ bool RSRenderParticleAnimation::Animate(int64_t time)
     int64_t deltaTime = time - animationFraction_.GetLastFrameTime();
     animationFraction_.SetLastFrameTime(time);
     if (particleSystem_ != nullptr) {
-        particleSystem_->Emit(
-            deltaTime, renderParticleVector_.renderParticleVector_, renderParticleVector_.imageVector_);
-        particleSystem_->UpdateParticle(deltaTime, renderParticleVector_.renderParticleVector_);
+        particleSystem_->Emit(deltaTime, renderParticleVector_.particleStores_, renderParticleVector_.imageVector_);
+        particleSystem_->UpdateParticle(deltaTime, renderParticleVector_.particleStores_);
     }
     auto property = std::static_pointer_cast<RSRenderProperty<RSRenderParticleVector>>(property_);
     if (property) {
         property->Set(renderParticleVector_);
     }
 
-    if (particleSystem_ == nullptr || particleSystem_->IsFinish(renderParticleVector_.renderParticleVector_)) {
+    if (particleSystem_ == nullptr || particleSystem_->IsFinish(renderParticleVector_.particleStores_)) {
         if (target) {
             target->RemoveModifier(property_->GetId());
         }
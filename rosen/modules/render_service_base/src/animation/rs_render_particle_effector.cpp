@@ -27,6 +27,24 @@
 namespace OHOS {
 namespace Rosen {
 constexpr float DEGREE_TO_RADIAN = M_PI / 180;
+namespace {
+void UpdateColorChannel(int16_t* color, float* colorF, const float* colorSpeed, size_t size, float deltaTime)
+{
+    for (size_t i = 0; i < size; i++) {
+        if ((color[i] <= 0 && colorSpeed[i] <= 0.f) || (color[i] >= UINT8_MAX && colorSpeed[i] >= 0.f)) {
+            continue;
+        }
+        float channelF = colorF[i] + colorSpeed[i] * deltaTime;
+        if (std::abs(channelF) >= 1.f) {
+            color[i] += static_cast<int16_t>(channelF);
+            channelF -= std::floor(channelF);
+        }
+        colorF[i] = channelF;
+        color[i] = std::clamp<int16_t>(color[i], 0, UINT8_MAX);
+    }
+}
+} // namespace
+
 RSRenderParticleEffector::RSRenderParticleEffector() {}
 
 Vector4<int16_t> RSRenderParticleEffector::CalculateColorInt(const std::shared_ptr<RSRenderParticle>& particle,
@@ -40,12 +58,16 @@ Vector4<int16_t> RSRenderParticleEffector::CalculateColorInt(const std::shared_p
                 colorInt.data_[i] += static_cast<int16_t>(colorF.data_[i]);
                 colorF.data_[i] -= std::floor(colorF.data_[i]);
             }
-            if (particle != nullptr) {
-                particle->SetRedF(colorF.data_[i]);
-            }
             colorInt.data_[i] = std::clamp<int16_t>(colorInt.data_[i], 0, UINT8_MAX);
         }
     }
+    // each channel keeps its own carry, the channels which were not updated write back what they read
+    if (particle != nullptr) {
+        particle->SetRedF(colorF.x_);
+        particle->SetGreenF(colorF.y_);
+        particle->SetBlueF(colorF.z_);
+        particle->SetAlphaF(colorF.w_);
+    }
     return colorInt;
 }
 
@@ -309,5 +331,200 @@ void RSRenderParticleEffector::Update(const std::shared_ptr<RSRenderParticle>& p
     UpdateActiveTime(particle, deltaTime);
 }
 
+void RSRenderParticleEffector::UpdateAcceleration(RSRenderParticleStore& store, float deltaTime)
+{
+    auto& particleRenderParams = store.particleParams_;
+    if (particleRenderParams == nullptr) {
+        return;
+    }
+    size_t size = store.GetSize();
+    const int64_t* activeTime = store.activeTime_.data();
+    float* accelerationValue = store.accelerationValue_.data();
+    float* accelerationAngle = store.accelerationAngle_.data();
+    auto acceValueUpdator = particleRenderParams->GetAccelerationValueUpdator();
+    if (acceValueUpdator == ParticleUpdator::RANDOM) {
+        const float* acceValueSpeed = store.accelerationValueSpeed_.data();
+        for (size_t i = 0; i < size; i++) {
+            accelerationValue[i] += acceValueSpeed[i] * deltaTime;
+        }
+    } else if (acceValueUpdator == ParticleUpdator::CURVE) {
+        auto& valChangeOverLife = particleRenderParams->GetAcceValChangeOverLife();
+        for (size_t i = 0; i < size; i++) {
+            UpdateCurveValue(accelerationValue[i], valChangeOverLife, activeTime[i] / NS_PER_MS);
+        }
+    }
+    auto acceAngleUpdator = particleRenderParams->GetAccelerationAngleUpdator();
+    if (acceAngleUpdator == ParticleUpdator::RANDOM) {
+        const float* acceAngleSpeed = store.accelerationAngleSpeed_.data();
+        for (size_t i = 0; i < size; i++) {
+            accelerationAngle[i] += acceAngleSpeed[i] * deltaTime;
+        }
+    } else if (acceAngleUpdator == ParticleUpdator::CURVE) {
+        auto& valChangeOverLife = particleRenderParams->GetAcceAngChangeOverLife();
+        for (size_t i = 0; i < size; i++) {
+            UpdateCurveValue(accelerationAngle[i], valChangeOverLife, activeTime[i] / NS_PER_MS);
+        }
+    }
+    // the x and y parts were computed when the particles were added and only change with the value or angle
+    if (acceValueUpdator == ParticleUpdator::NONE && acceAngleUpdator == ParticleUpdator::NONE) {
+        return;
+    }
+    float* accelerationX = store.accelerationX_.data();
+    float* accelerationY = store.accelerationY_.data();
+    for (size_t i = 0; i < size; i++) {
+        float angle = accelerationAngle[i] * DEGREE_TO_RADIAN;
+        accelerationX[i] = accelerationValue[i] * std::cos(angle);
+        accelerationY[i] = accelerationValue[i] * std::sin(angle);
+    }
+}
+
+void RSRenderParticleEffector::UpdateColor(RSRenderParticleStore& store, float deltaTime)
+{
+    auto& particleRenderParams = store.particleParams_;
+    if (particleRenderParams == nullptr || store.GetParticleType() == ParticleType::IMAGES) {
+        return;
+    }
+    size_t size = store.GetSize();
+    auto colorUpdator = particleRenderParams->GetColorUpdator();
+    if (colorUpdator == ParticleUpdator::RANDOM) {
+        UpdateColorChannel(store.red_.data(), store.redF_.data(), store.redSpeed_.data(), size, deltaTime);
+        UpdateColorChannel(store.green_.data(), store.greenF_.data(), store.greenSpeed_.data(), size, deltaTime);
+        UpdateColorChannel(store.blue_.data(), store.blueF_.data(), store.blueSpeed_.data(), size, deltaTime);
+        UpdateColorChannel(store.alpha_.data(), store.alphaF_.data(), store.alphaSpeed_.data(), size, deltaTime);
+    } else if (colorUpdator == ParticleUpdator::CURVE) {
+        auto& valChangeOverLife = particleRenderParams->GetColorChangeOverLife();
+        for (size_t i = 0; i < size; i++) {
+            Color color(store.red_[i], store.green_[i], store.blue_[i], store.alpha_[i]);
+            UpdateColorCurveValue(color, valChangeOverLife, store.activeTime_[i] / NS_PER_MS);
+            store.red_[i] = color.GetRed();
+            store.green_[i] = color.GetGreen();
+            store.blue_[i] = color.GetBlue();
+            store.alpha_[i] = color.GetAlpha();
+        }
+    }
+}
+
+void RSRenderParticleEffector::UpdateOpacity(RSRenderParticleStore& store, float deltaTime)
+{
+    auto& particleRenderParams = store.particleParams_;
+    if (particleRenderParams == nullptr) {
+        return;
+    }
+    size_t size = store.GetSize();
+    float* opacity = store.opacity_.data();
+    auto opacityUpdator = particleRenderParams->GetOpacityUpdator();
+    if (opacityUpdator == ParticleUpdator::RANDOM) {
+        const float* opacitySpeed = store.opacitySpeed_.data();
+        uint8_t* dead = store.dead_.data();
+        for (size_t i = 0; i < size; i++) {
+            bool fadedOut = opacity[i] <= 0.f && opacitySpeed[i] <= 0.f;
+            bool saturated = opacity[i] >= 1.f && opacitySpeed[i] >= 0.f;
+            dead[i] |= static_cast<uint8_t>(fadedOut);
+            float updated = std::clamp<float>(opacity[i] + opacitySpeed[i] * deltaTime, 0.f, 1.f);
+            opacity[i] = (fadedOut || saturated) ? opacity[i] : updated;
+        }
+    } else if (opacityUpdator == ParticleUpdator::CURVE) {
+        auto& valChangeOverLife = particleRenderParams->GetOpacityChangeOverLife();
+        for (size_t i = 0; i < size; i++) {
+            UpdateCurveValue(opacity[i], valChangeOverLife, store.activeTime_[i] / NS_PER_MS);
+        }
+    }
+}
+
+void RSRenderParticleEffector::UpdateScale(RSRenderParticleStore& store, float deltaTime)
+{
+    auto& particleRenderParams = store.particleParams_;
+    if (particleRenderParams == nullptr) {
+        return;
+    }
+    size_t size = store.GetSize();
+    float* scale = store.scale_.data();
+    auto scaleUpdator = particleRenderParams->GetScaleUpdator();
+    if (scaleUpdator == ParticleUpdator::RANDOM) {
+        const float* scaleSpeed = store.scaleSpeed_.data();
+        uint8_t* dead = store.dead_.data();
+        for (size_t i = 0; i < size; i++) {
+            bool shrunk = scale[i] <= 0.f && scaleSpeed[i] <= 0.f;
+            dead[i] |= static_cast<uint8_t>(shrunk);
+            scale[i] = shrunk ? scale[i] : scale[i] + scaleSpeed[i] * deltaTime;
+        }
+    } else if (scaleUpdator == ParticleUpdator::CURVE) {
+        auto& valChangeOverLife = particleRenderParams->GetScaleChangeOverLife();
+        for (size_t i = 0; i < size; i++) {
+            UpdateCurveValue(scale[i], valChangeOverLife, store.activeTime_[i] / NS_PER_MS);
+        }
+    }
+}
+
+void RSRenderParticleEffector::UpdateSpin(RSRenderParticleStore& store, float deltaTime)
+{
+    auto& particleRenderParams = store.particleParams_;
+    if (particleRenderParams == nullptr) {
+        return;
+    }
+    size_t size = store.GetSize();
+    float* spin = store.spin_.data();
+    auto spinUpdator = particleRenderParams->GetSpinUpdator();
+    if (spinUpdator == ParticleUpdator::RANDOM) {
+        const float* spinSpeed = store.spinSpeed_.data();
+        for (size_t i = 0; i < size; i++) {
+            spin[i] += spinSpeed[i] * deltaTime;
+        }
+    } else if (spinUpdator == ParticleUpdator::CURVE) {
+        auto& valChangeOverLife = particleRenderParams->GetSpinChangeOverLife();
+        for (size_t i = 0; i < size; i++) {
+            UpdateCurveValue(spin[i], valChangeOverLife, store.activeTime_[i] / NS_PER_MS);
+        }
+    }
+}
+
+void RSRenderParticleEffector::UpdatePosition(RSRenderParticleStore& store,
+    const std::shared_ptr<ParticleNoiseFields>& particleNoiseFields, float deltaTime)
+{
+    size_t size = store.GetSize();
+    float* positionX = store.positionX_.data();
+    float* positionY = store.positionY_.data();
+    float* velocityX = store.velocityX_.data();
+    float* velocityY = store.velocityY_.data();
+    const float* accelerationX = store.accelerationX_.data();
+    const float* accelerationY = store.accelerationY_.data();
+    if (particleNoiseFields == nullptr) {
+        for (size_t i = 0; i < size; i++) {
+            velocityX[i] += accelerationX[i] * deltaTime;
+            velocityY[i] += accelerationY[i] * deltaTime;
+            positionX[i] += velocityX[i] * deltaTime;
+            positionY[i] += velocityY[i] * deltaTime;
+        }
+        return;
+    }
+    for (size_t i = 0; i < size; i++) {
+        auto fieldForce = particleNoiseFields->ApplyAllFields(Vector2f(positionX[i], positionY[i]), deltaTime);
+        velocityX[i] += accelerationX[i] * deltaTime;
+        velocityY[i] += accelerationY[i] * deltaTime;
+        positionX[i] += (velocityX[i] + fieldForce.x_) * deltaTime;
+        positionY[i] += (velocityY[i] + fieldForce.y_) * deltaTime;
+    }
+}
+
+void RSRenderParticleEffector::UpdateActiveTime(RSRenderParticleStore& store, int64_t deltaTime)
+{
+    for (auto& activeTime : store.activeTime_) {
+        activeTime += deltaTime;
+    }
+}
+
+void RSRenderParticleEffector::Update(RSRenderParticleStore& store,
+    const std::shared_ptr<ParticleNoiseFields>& particleNoiseFields, int64_t deltaTime)
+{
+    float dt = static_cast<float>(deltaTime) / NS_TO_S;
+    UpdateAcceleration(store, dt);
+    UpdateColor(store, dt);
+    UpdateOpacity(store, dt);
+    UpdateScale(store, dt);
+    UpdateSpin(store, dt);
+    UpdatePosition(store, particleNoiseFields, dt);
+    UpdateActiveTime(store, deltaTime);
+}
+
 } // namespace Rosen
 } // namespace OHOS
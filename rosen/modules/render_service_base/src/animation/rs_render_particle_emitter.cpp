@@ -68,47 +68,69 @@ void RSRenderParticleEmitter::PreEmit()
     }
 }
 
-void RSRenderParticleEmitter::EmitParticle(int64_t deltaTime)
+int32_t RSRenderParticleEmitter::CalculateSpawnCount(int64_t deltaTime)
 {
-    PreEmit();
-    if (particleParams_ == nullptr || emitFinish_ == true) {
-        return;
-    }
     auto emitRate = std::min(particleParams_->GetEmitRate(), MAX_EMIT_RATE);
     auto maxParticle = particleParams_->GetParticleCount();
     auto lifeTimeStart = particleParams_->GetLifeTimeStartValue();
     auto lifeTimeEnd = particleParams_->GetLifeTimeEndValue();
     float last = particleCount_;
-    particles_.clear();
     if (maxParticle == -1) {
         maxParticle = INT32_MAX;
     }
     if (maxParticle <= 0 || (lifeTimeStart == 0 && lifeTimeEnd == 0) || last > static_cast<float>(maxParticle)) {
         emitFinish_ = true;
-        return;
+        return 0;
     }
     particleCount_ += static_cast<float>(emitRate * deltaTime) / NS_TO_S;
     spawnNum_ += particleCount_ - last;
 
     if (ROSEN_EQ(spawnNum_, 0.f)) {
-        return;
+        return 0;
     }
+    int32_t spawnCount = 0;
     if (ROSEN_EQ(last, 0.f)) {
         for (int32_t i = 0; i < std::min(static_cast<int32_t>(spawnNum_), maxParticle); i++) {
-            auto particle = std::make_shared<RSRenderParticle>(particleParams_);
-            particles_.push_back(particle);
+            spawnCount++;
             spawnNum_ -= 1.f;
         }
         if (particleCount_ > static_cast<float>(maxParticle)) {
-            return;
+            return spawnCount;
         }
     }
     while (spawnNum_ >= 1.f && std::ceil(last) <= static_cast<float>(maxParticle)) {
-        auto particle = std::make_shared<RSRenderParticle>(particleParams_);
-        particles_.push_back(particle);
+        spawnCount++;
         spawnNum_ -= 1.f;
         last += 1.f;
     }
+    return spawnCount;
+}
+
+void RSRenderParticleEmitter::EmitParticle(int64_t deltaTime)
+{
+    PreEmit();
+    if (particleParams_ == nullptr || emitFinish_ == true) {
+        return;
+    }
+    particles_.clear();
+    int32_t spawnCount = CalculateSpawnCount(deltaTime);
+    for (int32_t i = 0; i < spawnCount; i++) {
+        auto particle = std::make_shared<RSRenderParticle>(particleParams_);
+        particles_.push_back(particle);
+    }
+}
+
+void RSRenderParticleEmitter::EmitParticle(int64_t deltaTime, RSRenderParticleStore& store, uint64_t& emitOrder)
+{
+    PreEmit();
+    if (particleParams_ == nullptr || emitFinish_ == true) {
+        return;
+    }
+    int32_t spawnCount = CalculateSpawnCount(deltaTime);
+    for (int32_t i = 0; i < spawnCount; i++) {
+        RSRenderParticle particle(particleParams_);
+        store.Add(particle, emitOrder++);
+    }
 }
 
 bool RSRenderParticleEmitter::IsEmitterFinish()
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "animation/rs_render_particle_store.h"
+
+#include <cmath>
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr float DEGREE_TO_RADIAN = M_PI / 180;
+
+template<typename T>
+void CompactArray(std::vector<T>& values, const std::vector<uint8_t>& alive, size_t aliveCount)
+{
+    size_t dst = 0;
+    for (size_t src = 0; src < values.size(); src++) {
+        if (alive[src]) {
+            values[dst++] = values[src];
+        }
+    }
+    values.resize(aliveCount);
+}
+} // namespace
+
+RSRenderParticleStore::RSRenderParticleStore(const std::shared_ptr<ParticleRenderParams>& particleParams)
+    : particleParams_(particleParams)
+{
+    if (particleParams_ == nullptr) {
+        return;
+    }
+    particleType_ = particleParams_->GetParticleType();
+    radius_ = particleParams_->GetParticleRadius();
+    infiniteLifeTime_ = particleParams_->GetLifeTimeStartValue() == (-1 * NS_PER_MS) &&
+        particleParams_->GetLifeTimeEndValue() == (-1 * NS_PER_MS);
+}
+
+void RSRenderParticleStore::Add(RSRenderParticle& particle, uint64_t emitOrder)
+{
+    const auto& position = particle.GetPosition();
+    positionX_.push_back(position.x_);
+    positionY_.push_back(position.y_);
+    const auto& velocity = particle.GetVelocity();
+    velocityX_.push_back(velocity.x_);
+    velocityY_.push_back(velocity.y_);
+    float accelerationValue = particle.GetAccelerationValue();
+    float accelerationAngle = particle.GetAccelerationAngle() * DEGREE_TO_RADIAN;
+    accelerationX_.push_back(accelerationValue * std::cos(accelerationAngle));
+    accelerationY_.push_back(accelerationValue * std::sin(accelerationAngle));
+    accelerationValue_.push_back(accelerationValue);
+    accelerationAngle_.push_back(particle.GetAccelerationAngle());
+    accelerationValueSpeed_.push_back(particle.GetAccelerationValueSpeed());
+    accelerationAngleSpeed_.push_back(particle.GetAccelerationAngleSpeed());
+    spin_.push_back(particle.GetSpin());
+    spinSpeed_.push_back(particle.GetSpinSpeed());
+    opacity_.push_back(particle.GetOpacity());
+    opacitySpeed_.push_back(particle.GetOpacitySpeed());
+    scale_.push_back(particle.GetScale());
+    scaleSpeed_.push_back(particle.GetScaleSpeed());
+    const auto& color = particle.GetColor();
+    red_.push_back(color.GetRed());
+    green_.push_back(color.GetGreen());
+    blue_.push_back(color.GetBlue());
+    alpha_.push_back(color.GetAlpha());
+    redF_.push_back(particle.GetRedF());
+    greenF_.push_back(particle.GetGreenF());
+    blueF_.push_back(particle.GetBlueF());
+    alphaF_.push_back(particle.GetAlphaF());
+    redSpeed_.push_back(particle.GetRedSpeed());
+    greenSpeed_.push_back(particle.GetGreenSpeed());
+    blueSpeed_.push_back(particle.GetBlueSpeed());
+    alphaSpeed_.push_back(particle.GetAlphaSpeed());
+    activeTime_.push_back(particle.GetActiveTime());
+    lifeTime_.push_back(particle.GetLifeTime());
+    dead_.push_back(particle.IsAlive() ? 0 : 1);
+    emitOrder_.push_back(emitOrder);
+}
+
+void RSRenderParticleStore::Reserve(size_t count)
+{
+    positionX_.reserve(count);
+    positionY_.reserve(count);
+    velocityX_.reserve(count);
+    velocityY_.reserve(count);
+    accelerationX_.reserve(count);
+    accelerationY_.reserve(count);
+    accelerationValue_.reserve(count);
+    accelerationAngle_.reserve(count);
+    accelerationValueSpeed_.reserve(count);
+    accelerationAngleSpeed_.reserve(count);
+    spin_.reserve(count);
+    spinSpeed_.reserve(count);
+    opacity_.reserve(count);
+    opacitySpeed_.reserve(count);
+    scale_.reserve(count);
+    scaleSpeed_.reserve(count);
+    red_.reserve(count);
+    green_.reserve(count);
+    blue_.reserve(count);
+    alpha_.reserve(count);
+    redF_.reserve(count);
+    greenF_.reserve(count);
+    blueF_.reserve(count);
+    alphaF_.reserve(count);
+    redSpeed_.reserve(count);
+    greenSpeed_.reserve(count);
+    blueSpeed_.reserve(count);
+    alphaSpeed_.reserve(count);
+    activeTime_.reserve(count);
+    lifeTime_.reserve(count);
+    dead_.reserve(count);
+    emitOrder_.reserve(count);
+}
+
+void RSRenderParticleStore::Clear()
+{
+    positionX_.clear();
+    positionY_.clear();
+    velocityX_.clear();
+    velocityY_.clear();
+    accelerationX_.clear();
+    accelerationY_.clear();
+    accelerationValue_.clear();
+    accelerationAngle_.clear();
+    accelerationValueSpeed_.clear();
+    accelerationAngleSpeed_.clear();
+    spin_.clear();
+    spinSpeed_.clear();
+    opacity_.clear();
+    opacitySpeed_.clear();
+    scale_.clear();
+    scaleSpeed_.clear();
+    red_.clear();
+    green_.clear();
+    blue_.clear();
+    alpha_.clear();
+    redF_.clear();
+    greenF_.clear();
+    blueF_.clear();
+    alphaF_.clear();
+    redSpeed_.clear();
+    greenSpeed_.clear();
+    blueSpeed_.clear();
+    alphaSpeed_.clear();
+    activeTime_.clear();
+    lifeTime_.clear();
+    dead_.clear();
+    emitOrder_.clear();
+}
+
+void RSRenderParticleStore::RemoveDeadParticles()
+{
+    size_t size = GetSize();
+    std::vector<uint8_t> alive(size);
+    size_t aliveCount = 0;
+    for (size_t i = 0; i < size; i++) {
+        alive[i] = IsAlive(i) ? 1 : 0;
+        aliveCount += alive[i];
+    }
+    if (aliveCount == size) {
+        return;
+    }
+    CompactArray(positionX_, alive, aliveCount);
+    CompactArray(positionY_, alive, aliveCount);
+    CompactArray(velocityX_, alive, aliveCount);
+    CompactArray(velocityY_, alive, aliveCount);
+    CompactArray(accelerationX_, alive, aliveCount);
+    CompactArray(accelerationY_, alive, aliveCount);
+    CompactArray(accelerationValue_, alive, aliveCount);
+    CompactArray(accelerationAngle_, alive, aliveCount);
+    CompactArray(accelerationValueSpeed_, alive, aliveCount);
+    CompactArray(accelerationAngleSpeed_, alive, aliveCount);
+    CompactArray(spin_, alive, aliveCount);
+    CompactArray(spinSpeed_, alive, aliveCount);
+    CompactArray(opacity_, alive, aliveCount);
+    CompactArray(opacitySpeed_, alive, aliveCount);
+    CompactArray(scale_, alive, aliveCount);
+    CompactArray(scaleSpeed_, alive, aliveCount);
+    CompactArray(red_, alive, aliveCount);
+    CompactArray(green_, alive, aliveCount);
+    CompactArray(blue_, alive, aliveCount);
+    CompactArray(alpha_, alive, aliveCount);
+    CompactArray(redF_, alive, aliveCount);
+    CompactArray(greenF_, alive, aliveCount);
+    CompactArray(blueF_, alive, aliveCount);
+    CompactArray(alphaF_, alive, aliveCount);
+    CompactArray(redSpeed_, alive, aliveCount);
+    CompactArray(greenSpeed_, alive, aliveCount);
+    CompactArray(blueSpeed_, alive, aliveCount);
+    CompactArray(alphaSpeed_, alive, aliveCount);
+    CompactArray(activeTime_, alive, aliveCount);
+    CompactArray(lifeTime_, alive, aliveCount);
+    CompactArray(dead_, alive, aliveCount);
+    CompactArray(emitOrder_, alive, aliveCount);
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -90,6 +90,52 @@ bool RSRenderParticleSystem::IsFinish(const std::vector<std::shared_ptr<RSRender
     return finish;
 }
 
+void RSRenderParticleSystem::Emit(int64_t deltaTime,
+    std::vector<std::shared_ptr<RSRenderParticleStore>>& activeParticles,
+    std::vector<std::shared_ptr<RSImage>>& imageVector)
+{
+    activeParticles.resize(emitters_.size());
+    for (size_t iter = 0; iter < emitters_.size(); iter++) {
+        if (emitters_[iter] == nullptr) {
+            continue;
+        }
+        auto& store = activeParticles[iter];
+        if (store == nullptr || store->GetParticleRenderParams() != emitters_[iter]->GetParticleParams()) {
+            store = std::make_shared<RSRenderParticleStore>(emitters_[iter]->GetParticleParams());
+        }
+        emitters_[iter]->EmitParticle(deltaTime, *store, emitOrder_);
+    }
+    imageVector = imageVector_;
+}
+
+void RSRenderParticleSystem::UpdateParticle(
+    int64_t deltaTime, std::vector<std::shared_ptr<RSRenderParticleStore>>& activeParticles)
+{
+    for (auto& store : activeParticles) {
+        if (store == nullptr || store->GetSize() == 0) {
+            continue;
+        }
+        store->RemoveDeadParticles();
+        Update(*store, particleNoiseFields_, deltaTime);
+    }
+}
+
+bool RSRenderParticleSystem::IsFinish(const std::vector<std::shared_ptr<RSRenderParticleStore>>& activeParticles)
+{
+    for (const auto& store : activeParticles) {
+        if (store != nullptr && store->GetSize() != 0) {
+            return false;
+        }
+    }
+    bool finish = true;
+    for (size_t iter = 0; iter < emitters_.size(); iter++) {
+        if (emitters_[iter] != nullptr) {
+            finish = finish && emitters_[iter]->IsEmitterFinish();
+        }
+    }
+    return finish;
+}
+
 void RSRenderParticleSystem::UpdateEmitter(
     const std::vector<std::shared_ptr<ParticleRenderParams>>& particlesRenderParams)
 {
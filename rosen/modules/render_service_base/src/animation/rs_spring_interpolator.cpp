@@ -27,14 +27,14 @@ RSSpringInterpolator::RSSpringInterpolator(float response, float dampingRatio, f
     // initialOffset: 1, minimumAmplitude: 0.0001
     : RSSpringModel<float>(response, dampingRatio, -1, initialVelocity, 0.0001)
 {
-    estimatedDuration_ = EstimateDuration();
+    InitTable();
 }
 
 RSSpringInterpolator::RSSpringInterpolator(uint64_t id, float response, float dampingRatio, float initialVelocity)
     // initialOffset: 1, minimumAmplitude: 0.0001
     : RSSpringModel<float>(response, dampingRatio, -1, initialVelocity, 0.0001), RSInterpolator(id)
 {
-    estimatedDuration_ = EstimateDuration();
+    InitTable();
 }
 
 bool RSSpringInterpolator::Marshalling(Parcel& parcel) const
@@ -62,11 +62,36 @@ RSSpringInterpolator* RSSpringInterpolator::Unmarshalling(Parcel& parcel)
         ROSEN_LOGE("RSSpringInterpolator::Unmarshalling, SpringInterpolator failed");
         return nullptr;
     }
+    if (!(std::isfinite(response) && std::isfinite(dampingRatio) && std::isfinite(initialVelocity))) {
+        ROSEN_LOGE("RSSpringInterpolator::Unmarshalling, invalid spring parameters");
+        return nullptr;
+    }
     auto ret = new RSSpringInterpolator(id, response, dampingRatio, initialVelocity);
     return ret;
 }
 
+void RSSpringInterpolator::InitTable()
+{
+    RSInterpolatorTableKey key = { RSInterpolatorTableType::SPRING_INTERPOLATOR,
+        { response_, dampingRatio_, initialVelocity_, 0.0f } };
+    table_ = RSInterpolatorCache::Instance().GetTable(key, [this]() {
+        // CalculateValue() maps the fractions with the estimated duration
+        estimatedDuration_ = EstimateDuration();
+        return std::make_shared<RSInterpolatorTable>(
+            [this](float fraction) { return CalculateValue(fraction); }, estimatedDuration_);
+    });
+    estimatedDuration_ = table_ != nullptr ? table_->GetDuration() : EstimateDuration();
+}
+
 float RSSpringInterpolator::InterpolateImpl(float fraction) const
+{
+    if (table_ != nullptr && table_->IsSampled()) {
+        return table_->Sample(fraction);
+    }
+    return CalculateValue(fraction);
+}
+
+float RSSpringInterpolator::CalculateValue(float fraction) const
 {
     if (fraction <= 0) {
         return 0;
@@ -59,6 +59,16 @@ RSCommandFactory& RSCommandFactory::Instance()
 
 void RSCommandFactory::Register(uint16_t type, uint16_t subtype, UnmarshallingFunc func)
 {
+    if (type < MAX_COMMAND_TYPE_COUNT && subtype < MAX_COMMAND_SUBTYPE_COUNT) {
+        auto& entry = unmarshallingFuncTable_[type][subtype];
+        if (entry != nullptr) {
+            ROSEN_LOGD("RSCommandFactory::Register, Duplicate command & sub_command detected!"
+                " type: %{public}d subtype: %{public}d", type, subtype);
+            return;
+        }
+        entry = func;
+        return;
+    }
     auto result = unmarshallingFuncLUT_.try_emplace(MakeKey(type, subtype), func);
     if (!result.second) {
         ROSEN_LOGD("RSCommandFactory::Register, Duplicate command & sub_command detected!"
@@ -68,6 +78,14 @@ void RSCommandFactory::Register(uint16_t type, uint16_t subtype, UnmarshallingFu
 
 UnmarshallingFunc RSCommandFactory::GetUnmarshallingFunc(uint16_t type, uint16_t subtype)
 {
+    if (type < MAX_COMMAND_TYPE_COUNT && subtype < MAX_COMMAND_SUBTYPE_COUNT) {
+        auto func = unmarshallingFuncTable_[type][subtype];
+        if (func == nullptr) {
+            ROSEN_LOGE("RSCommandFactory::GetUnmarshallingFunc, Func is not found,"
+                " type=%{public}d subtype=%{public}d", type, subtype);
+        }
+        return func;
+    }
     auto it = unmarshallingFuncLUT_.find(MakeKey(type, subtype));
     if (it == unmarshallingFuncLUT_.end()) {
         ROSEN_LOGE("RSCommandFactory::GetUnmarshallingFunc, Func is not found,"
@@ -45,6 +45,20 @@ void RSNodeCommandHelper::RemoveAllModifiers(RSContext& context, NodeId nodeId)
     }
 }
 
+void RSNodeCommandHelper::UpdateModifierDeltaBlock(
+    RSContext& context, NodeId nodeId, const RSPropertyDeltaBlock& block)
+{
+    auto& nodeMap = context.GetNodeMap();
+    auto node = nodeMap.GetRenderNode<RSRenderNode>(nodeId);
+    if (!node) {
+        return;
+    }
+    UpdateNodeModifiers(*node, block.GetColumn<float>());
+    UpdateNodeModifiers(*node, block.GetColumn<Vector2f>());
+    UpdateNodeModifiers(*node, block.GetColumn<Vector4f>());
+    UpdateNodeModifiers(*node, block.GetColumn<Color>());
+}
+
 void RSNodeCommandHelper::SetFreeze(RSContext& context, NodeId nodeId, bool isFreeze)
 {
     auto& nodeMap = context.GetNodeMap();
@@ -483,29 +483,50 @@ constexpr std::array borderDirtyTypes = {
     RSDrawableSlot::BACKGROUND_IMAGE,
 };
 template<std::size_t SIZE>
-inline void MarkAffectedSlots(const std::array<RSDrawableSlot, SIZE>& affectedSlots, const RSDrawable::Vec& drawableVec,
-    std::unordered_set<RSDrawableSlot>& dirtySlots)
+constexpr RSDrawable::DirtySlots MakeSlotsMask(const std::array<RSDrawableSlot, SIZE>& slots)
 {
-    for (auto slot : affectedSlots) {
+    uint64_t mask = 0;
+    for (auto slot : slots) {
+        mask |= 1ULL << static_cast<size_t>(slot);
+    }
+    return RSDrawable::DirtySlots(mask);
+}
+constexpr RSDrawable::DirtySlots boundsDirtyMask = MakeSlotsMask(boundsDirtyTypes);
+constexpr RSDrawable::DirtySlots frameDirtyMask = MakeSlotsMask(frameDirtyTypes);
+constexpr RSDrawable::DirtySlots borderDirtyMask = MakeSlotsMask(borderDirtyTypes);
+constexpr RSDrawable::DirtySlots shadowDirtyMask =
+    MakeSlotsMask(std::array { RSDrawableSlot::SHADOW, RSDrawableSlot::FOREGROUND_FILTER });
+constexpr RSDrawable::DirtySlots frameGravityDirtyMask =
+    MakeSlotsMask(std::array { RSDrawableSlot::CONTENT_STYLE, RSDrawableSlot::FOREGROUND_STYLE });
+
+constexpr size_t WORD_BITS = 64;
+constexpr ModifierDirtyTypes MODIFIER_WORD_MASK(std::numeric_limits<uint64_t>::max());
+
+inline void MarkAffectedSlots(
+    const RSDrawable::DirtySlots& affectedSlots, const RSDrawable::Vec& drawableVec, RSDrawable::DirtySlots& dirtySlots)
+{
+    RSDrawable::ForEachSlot(affectedSlots, [&drawableVec, &dirtySlots](RSDrawableSlot slot) {
         if (drawableVec[static_cast<size_t>(slot)]) {
-            dirtySlots.emplace(slot);
+            dirtySlots.set(static_cast<size_t>(slot));
         }
-    }
+    });
 }
 } // namespace
 
-std::unordered_set<RSDrawableSlot> RSDrawable::CalculateDirtySlots(
-    const ModifierDirtyTypes& dirtyTypes, const Vec& drawableVec)
+RSDrawable::DirtySlots RSDrawable::CalculateDirtySlots(const ModifierDirtyTypes& dirtyTypes, const Vec& drawableVec)
 {
-    // Step 1.1: calculate dirty slots by looking up g_propertyToDrawableLut
-    std::unordered_set<RSDrawableSlot> dirtySlots;
-    for (size_t type = 0; type < static_cast<size_t>(RSModifierType::MAX_RS_MODIFIER_TYPE); type++) {
-        if (!dirtyTypes.test(type)) {
-            continue;
-        }
-        auto dirtySlot = g_propertyToDrawableLut[type];
-        if (dirtySlot != RSDrawableSlot::INVALID) {
-            dirtySlots.emplace(dirtySlot);
+    // Step 1.1: calculate dirty slots by looking up g_propertyToDrawableLut, only the set bits of every 64 dirty
+    // types are visited
+    DirtySlots dirtySlots;
+    if (dirtyTypes.none()) {
+        return dirtySlots;
+    }
+    for (size_t base = 0; base < dirtyTypes.size(); base += WORD_BITS) {
+        for (uint64_t bits = ((dirtyTypes >> base) & MODIFIER_WORD_MASK).to_ullong(); bits != 0; bits &= bits - 1) {
+            auto dirtySlot = g_propertyToDrawableLut[base + LowestSetBit(bits)];
+            if (dirtySlot != RSDrawableSlot::INVALID) {
+                dirtySlots.set(static_cast<size_t>(dirtySlot));
+            }
         }
     }
 
@@ -514,42 +535,40 @@ std::unordered_set<RSDrawableSlot> RSDrawable::CalculateDirtySlots(
     if (dirtyTypes.test(static_cast<size_t>(RSModifierType::BOUNDS)) ||
         dirtyTypes.test(static_cast<size_t>(RSModifierType::CORNER_RADIUS)) ||
         dirtyTypes.test(static_cast<size_t>(RSModifierType::CLIP_BOUNDS))) {
-        MarkAffectedSlots(boundsDirtyTypes, drawableVec, dirtySlots);
+        MarkAffectedSlots(boundsDirtyMask, drawableVec, dirtySlots);
     }
 
-    if (dirtyTypes.test(static_cast<size_t>(RSModifierType::SHADOW_MASK)) || dirtySlots.count(RSDrawableSlot::SHADOW)) {
-        dirtySlots.emplace(RSDrawableSlot::SHADOW);
-        dirtySlots.emplace(RSDrawableSlot::FOREGROUND_FILTER);
+    if (dirtyTypes.test(static_cast<size_t>(RSModifierType::SHADOW_MASK)) ||
+        dirtySlots.test(static_cast<size_t>(RSDrawableSlot::SHADOW))) {
+        dirtySlots |= shadowDirtyMask;
     }
 
     if (dirtyTypes.test(static_cast<size_t>(RSModifierType::FRAME_GRAVITY))) {
-        dirtySlots.emplace(RSDrawableSlot::CONTENT_STYLE);
-        dirtySlots.emplace(RSDrawableSlot::FOREGROUND_STYLE);
+        dirtySlots |= frameGravityDirtyMask;
     }
 
     // if frame changed, mark affected drawables as dirty
-    if (dirtySlots.count(RSDrawableSlot::FRAME_OFFSET)) {
-        MarkAffectedSlots(frameDirtyTypes, drawableVec, dirtySlots);
+    if (dirtySlots.test(static_cast<size_t>(RSDrawableSlot::FRAME_OFFSET))) {
+        MarkAffectedSlots(frameDirtyMask, drawableVec, dirtySlots);
     }
 
     // if border changed, mark affected drawables as dirty
-    if (dirtySlots.count(RSDrawableSlot::BORDER)) {
-        MarkAffectedSlots(borderDirtyTypes, drawableVec, dirtySlots);
+    if (dirtySlots.test(static_cast<size_t>(RSDrawableSlot::BORDER))) {
+        MarkAffectedSlots(borderDirtyMask, drawableVec, dirtySlots);
     }
 
     // PLANNING: merge these restore operations with RESTORE_ALL drawable
-    if (dirtySlots.count(RSDrawableSlot::FOREGROUND_FILTER)) {
-        dirtySlots.emplace(RSDrawableSlot::RESTORE_FOREGROUND_FILTER);
+    if (dirtySlots.test(static_cast<size_t>(RSDrawableSlot::FOREGROUND_FILTER))) {
+        dirtySlots.set(static_cast<size_t>(RSDrawableSlot::RESTORE_FOREGROUND_FILTER));
     }
     return dirtySlots;
 }
 
-bool RSDrawable::UpdateDirtySlots(
-    const RSRenderNode& node, Vec& drawableVec, std::unordered_set<RSDrawableSlot>& dirtySlots)
+bool RSDrawable::UpdateDirtySlots(const RSRenderNode& node, Vec& drawableVec, const DirtySlots& dirtySlots)
 {
     // Step 2: Update or generate all dirty slots
     bool drawableAddedOrRemoved = false;
-    for (const auto& slot : dirtySlots) {
+    ForEachSlot(dirtySlots, [&node, &drawableVec, &drawableAddedOrRemoved](RSDrawableSlot slot) {
         if (auto& drawable = drawableVec[static_cast<size_t>(slot)]) {
             // If the slot is already created, call OnUpdate
             if (!drawable->OnUpdate(node)) {
@@ -564,7 +583,7 @@ bool RSDrawable::UpdateDirtySlots(
                 drawableAddedOrRemoved = true;
             }
         }
-    }
+    });
 
     return drawableAddedOrRemoved;
 }
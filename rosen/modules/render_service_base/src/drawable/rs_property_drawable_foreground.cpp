@@ -676,7 +676,8 @@ bool RSParticleDrawable::OnUpdate(const RSRenderNode& node)
     auto bounds = properties.GetDrawRegion();
     auto imageCount = particleVector.GetParticleImageCount();
     auto imageVector = particleVector.GetParticleImageVector();
-    auto particleDrawable = std::make_shared<RSParticlesDrawable>(particles, imageVector, imageCount);
+    auto particleDrawable = std::make_shared<RSParticlesDrawable>(
+        particles, particleVector.GetParticleStores(), imageVector, imageCount);
     if (particleDrawable != nullptr) {
         particleDrawable->Draw(canvas, bounds);
     }
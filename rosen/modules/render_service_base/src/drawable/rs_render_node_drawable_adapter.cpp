@@ -21,6 +21,7 @@
 #include "common/rs_optional_trace.h"
 #include "drawable/rs_misc_drawable.h"
 #include "drawable/rs_render_node_shadow_drawable.h"
+#include "memory/rs_slab_allocator.h"
 #include "params/rs_canvas_drawing_render_params.h"
 #include "params/rs_display_render_params.h"
 #include "params/rs_effect_render_params.h"
@@ -43,6 +44,23 @@ RSRenderNodeDrawableAdapter::RSRenderNodeDrawableAdapter(std::shared_ptr<const R
 
 RSRenderNodeDrawableAdapter::~RSRenderNodeDrawableAdapter() = default;
 
+void* RSRenderNodeDrawableAdapter::operator new(size_t size)
+{
+    return GetAllocator().Allocate(size);
+}
+
+void RSRenderNodeDrawableAdapter::operator delete(void* ptr, size_t size)
+{
+    GetAllocator().Free(ptr, size);
+}
+
+RSSlabAllocator& RSRenderNodeDrawableAdapter::GetAllocator()
+{
+    // never destroyed, instances may outlive static destructors
+    static auto* allocator = new RSSlabAllocator();
+    return *allocator;
+}
+
 RSRenderNodeDrawableAdapter::SharedPtr RSRenderNodeDrawableAdapter::GetDrawableById(NodeId id)
 {
     std::lock_guard<std::mutex> lock(cacheMapMutex_);
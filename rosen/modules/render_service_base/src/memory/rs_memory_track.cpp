@@ -15,6 +15,7 @@
 #include "memory/rs_memory_track.h"
 
 #include "platform/common/rs_log.h"
+#include "render/rs_image_cache.h"
 namespace OHOS {
 namespace Rosen {
 namespace {
@@ -245,6 +246,7 @@ void MemoryTrack::DumpMemoryPicStatistics(DfxString& log,
         log.AppendFormat("  %s:Size = %d KB (%d entries)\n", MemoryType2String(type), arrTotal[i], arrCount[i]);
     }
     log.AppendFormat("Total Size = %d KB (%d entries)\n", totalSize, count);
+    RSImageCache::Instance().DumpStatistics(log);
 }
 
 void MemoryTrack::AddPictureRecord(const void* addr, MemoryInfo info)
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "memory/rs_slab_allocator.h"
+
+#include <atomic>
+#include <new>
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+thread_local RSSlabAllocator* g_batchOwner = nullptr;
+thread_local std::vector<void*> g_batchBlocks;
+// empty slabs cached by all allocators, bounded by MAX_CACHED_EMPTY_SLABS
+std::atomic<size_t> g_cachedEmptySlabs = 0;
+
+inline size_t GetClassIndex(size_t size)
+{
+    return size == 0 ? 0 : (size - 1) / RSSlabAllocator::BLOCK_ALIGN;
+}
+} // namespace
+
+RSSlabAllocator::~RSSlabAllocator()
+{
+    // slabs with live blocks are left alone, their objects may still be in use
+    while (emptySlabs_ != nullptr) {
+        Slab* slab = emptySlabs_;
+        emptySlabs_ = slab->next;
+        ::operator delete(slab, std::align_val_t(SLAB_SIZE));
+    }
+    g_cachedEmptySlabs.fetch_sub(emptySlabCount_, std::memory_order_relaxed);
+    emptySlabCount_ = 0;
+    if (spareSlab_ != nullptr) {
+        ::operator delete(spareSlab_, std::align_val_t(SLAB_SIZE));
+        spareSlab_ = nullptr;
+    }
+}
+
+void* RSSlabAllocator::Allocate(size_t size)
+{
+    if (size > MAX_BLOCK_SIZE) {
+        return ::operator new(size);
+    }
+    auto& sizeClass = classes_[GetClassIndex(size)];
+    std::lock_guard<std::mutex> lock(mutex_);
+    Slab* slab = sizeClass.partial;
+    if (slab == nullptr) {
+        auto blockSize = static_cast<uint32_t>((GetClassIndex(size) + 1) * BLOCK_ALIGN);
+        if (emptySlabs_ != nullptr) {
+            // an empty slab is carved again for the size class which needs it
+            slab = emptySlabs_;
+            emptySlabs_ = slab->next;
+            --emptySlabCount_;
+            g_cachedEmptySlabs.fetch_sub(1, std::memory_order_relaxed);
+            InitSlab(slab, blockSize);
+        } else if (spareSlab_ != nullptr) {
+            // the spare slab goes last, so the slabs counted by the process are given back first
+            slab = spareSlab_;
+            spareSlab_ = nullptr;
+            InitSlab(slab, blockSize);
+        } else {
+            slab = CreateSlab(blockSize);
+        }
+        LinkSlab(sizeClass.partial, slab);
+    }
+    void* block = nullptr;
+    if (slab->freeList != nullptr) {
+        block = slab->freeList;
+        slab->freeList = slab->freeList->next;
+    } else {
+        block = slab->unused;
+        slab->unused += slab->blockSize;
+    }
+    if (++slab->liveCount == slab->capacity) {
+        UnlinkSlab(sizeClass.partial, slab);
+    }
+    ++liveBlockCount_;
+    return block;
+}
+
+void RSSlabAllocator::Free(void* ptr, size_t size)
+{
+    if (ptr == nullptr) {
+        return;
+    }
+    if (size > MAX_BLOCK_SIZE) {
+        ::operator delete(ptr);
+        return;
+    }
+    if (g_batchOwner == this) {
+        g_batchBlocks.push_back(ptr);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    FreeBlockLocked(ptr);
+}
+
+void RSSlabAllocator::FreeBlockLocked(void* ptr)
+{
+    Slab* slab = GetSlab(ptr);
+    auto& sizeClass = classes_[GetClassIndex(slab->blockSize)];
+    auto block = static_cast<FreeBlock*>(ptr);
+    block->next = slab->freeList;
+    slab->freeList = block;
+    if (slab->liveCount == slab->capacity) {
+        LinkSlab(sizeClass.partial, slab);
+    }
+    --liveBlockCount_;
+    if (--slab->liveCount > 0) {
+        return;
+    }
+    UnlinkSlab(sizeClass.partial, slab);
+    ReleaseEmptySlabLocked(slab);
+}
+
+void RSSlabAllocator::ReleaseEmptySlabLocked(Slab* slab)
+{
+    if (spareSlab_ == nullptr) {
+        spareSlab_ = slab;
+        return;
+    }
+    size_t cachedCount = g_cachedEmptySlabs.load(std::memory_order_relaxed);
+    while (cachedCount < MAX_CACHED_EMPTY_SLABS) {
+        if (g_cachedEmptySlabs.compare_exchange_weak(cachedCount, cachedCount + 1, std::memory_order_relaxed)) {
+            slab->next = emptySlabs_;
+            emptySlabs_ = slab;
+            ++emptySlabCount_;
+            return;
+        }
+    }
+    ::operator delete(slab, std::align_val_t(SLAB_SIZE));
+    --slabCount_;
+}
+
+size_t RSSlabAllocator::GetSlabCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return slabCount_;
+}
+
+size_t RSSlabAllocator::GetEmptySlabCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return spareSlab_ != nullptr ? emptySlabCount_ + 1 : emptySlabCount_;
+}
+
+size_t RSSlabAllocator::GetLiveBlockCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return liveBlockCount_;
+}
+
+RSSlabAllocator::Slab* RSSlabAllocator::GetSlab(void* ptr)
+{
+    return reinterpret_cast<Slab*>(reinterpret_cast<uintptr_t>(ptr) & ~(static_cast<uintptr_t>(SLAB_SIZE) - 1));
+}
+
+RSSlabAllocator::Slab* RSSlabAllocator::CreateSlab(uint32_t blockSize)
+{
+    void* memory = ::operator new(SLAB_SIZE, std::align_val_t(SLAB_SIZE));
+    Slab* slab = new (memory) Slab();
+    InitSlab(slab, blockSize);
+    ++slabCount_;
+    return slab;
+}
+
+void RSSlabAllocator::InitSlab(Slab* slab, uint32_t blockSize)
+{
+    slab->blockSize = blockSize;
+    slab->capacity = static_cast<uint32_t>((SLAB_SIZE - SLAB_HEADER_SIZE) / blockSize);
+    ResetSlab(slab);
+}
+
+void RSSlabAllocator::ResetSlab(Slab* slab)
+{
+    slab->prev = nullptr;
+    slab->next = nullptr;
+    slab->freeList = nullptr;
+    slab->unused = reinterpret_cast<uint8_t*>(slab) + SLAB_HEADER_SIZE;
+    slab->liveCount = 0;
+}
+
+void RSSlabAllocator::LinkSlab(Slab*& head, Slab* slab)
+{
+    slab->prev = nullptr;
+    slab->next = head;
+    if (head != nullptr) {
+        head->prev = slab;
+    }
+    head = slab;
+}
+
+void RSSlabAllocator::UnlinkSlab(Slab*& head, Slab* slab)
+{
+    if (slab->prev != nullptr) {
+        slab->prev->next = slab->next;
+    } else if (head == slab) {
+        head = slab->next;
+    }
+    if (slab->next != nullptr) {
+        slab->next->prev = slab->prev;
+    }
+    slab->prev = nullptr;
+    slab->next = nullptr;
+}
+
+RSSlabAllocator::BatchFree::BatchFree(RSSlabAllocator& allocator) : allocator_(allocator), lastOwner_(g_batchOwner)
+{
+    if (lastOwner_ != nullptr && lastOwner_ != &allocator_ && !g_batchBlocks.empty()) {
+        std::lock_guard<std::mutex> lock(lastOwner_->mutex_);
+        for (auto ptr : g_batchBlocks) {
+            lastOwner_->FreeBlockLocked(ptr);
+        }
+        g_batchBlocks.clear();
+    }
+    g_batchOwner = &allocator_;
+}
+
+RSSlabAllocator::BatchFree::~BatchFree()
+{
+    if (!g_batchBlocks.empty()) {
+        std::lock_guard<std::mutex> lock(allocator_.mutex_);
+        for (auto ptr : g_batchBlocks) {
+            allocator_.FreeBlockLocked(ptr);
+        }
+        g_batchBlocks.clear();
+    }
+    g_batchOwner = lastOwner_;
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -16,6 +16,7 @@
 #include "params/rs_render_params.h"
 #include <string>
 
+#include "memory/rs_slab_allocator.h"
 #include "params/rs_surface_render_params.h"
 #include "pipeline/rs_render_node.h"
 #include "property/rs_properties.h"
@@ -25,6 +26,23 @@ namespace OHOS::Rosen {
 namespace {
 thread_local Drawing::Matrix parentSurfaceMatrix_;
 }
+void* RSRenderParams::operator new(size_t size)
+{
+    return GetAllocator().Allocate(size);
+}
+
+void RSRenderParams::operator delete(void* ptr, size_t size)
+{
+    GetAllocator().Free(ptr, size);
+}
+
+RSSlabAllocator& RSRenderParams::GetAllocator()
+{
+    // never destroyed, instances may outlive static destructors
+    static auto* allocator = new RSSlabAllocator();
+    return *allocator;
+}
+
 void RSRenderParams::SetDirtyType(RSRenderParamsDirtyType dirtyType)
 {
     dirtyType_.set(dirtyType);
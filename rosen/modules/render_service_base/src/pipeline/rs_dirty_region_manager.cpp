@@ -33,6 +33,10 @@ RSDirtyRegionManager::RSDirtyRegionManager(bool isDisplayDirtyManager)
     dirtyHistory_.resize(HISTORY_QUEUE_MAX_SIZE);
     debugRegionEnabled_.resize(DebugRegionType::TYPE_MAX);
     isDisplayDirtyManager_ = isDisplayDirtyManager;
+    isTileDirtyEnabled_ = isDisplayDirtyManager && RSSystemProperties::GetTileDirtyEnabled();
+    if (isTileDirtyEnabled_) {
+        dirtyTilesHistory_.resize(HISTORY_QUEUE_MAX_SIZE);
+    }
 }
 
 void RSDirtyRegionManager::MergeDirtyRect(const RectI& rect, bool isDebugRect)
@@ -48,6 +52,9 @@ void RSDirtyRegionManager::MergeDirtyRect(const RectI& rect, bool isDebugRect)
     if (isDisplayDirtyManager_) {
         mergedDirtyRegions_.emplace_back(rect);
     }
+    if (isTileDirtyEnabled_) {
+        currentFrameDirtyTiles_.MarkRect(rect);
+    }
     if (isDebugRect) {
         debugRect_ = rect;
     }
@@ -74,6 +81,9 @@ bool RSDirtyRegionManager::MergeDirtyRectIfIntersect(const RectI& rect)
     if (isDisplayDirtyManager_) {
         mergedDirtyRegions_.emplace_back(rect);
     }
+    if (isTileDirtyEnabled_) {
+        currentFrameDirtyTiles_.MarkRect(rect);
+    }
     return true;
 }
 
@@ -87,6 +97,9 @@ void RSDirtyRegionManager::MergeDirtyRectAfterMergeHistory(const RectI& rect)
     } else {
         dirtyRegion_ = dirtyRegion_.JoinRect(rect);
     }
+    if (isTileDirtyEnabled_) {
+        dirtyTiles_.MarkRect(rect);
+    }
 }
 
 void RSDirtyRegionManager::UpdateVisitedDirtyRects(const std::vector<RectI>& rects)
@@ -156,6 +169,10 @@ const RectI& RSDirtyRegionManager::GetDirtyRegion() const
 void RSDirtyRegionManager::SetCurrentFrameDirtyRect(const RectI& dirtyRect)
 {
     currentFrameDirtyRegion_ = dirtyRect;
+    if (isTileDirtyEnabled_) {
+        currentFrameDirtyTiles_.Clear();
+        currentFrameDirtyTiles_.MarkRect(dirtyRect);
+    }
 }
 
 void RSDirtyRegionManager::OnSync(std::shared_ptr<RSDirtyRegionManager> targetManager)
@@ -168,6 +185,10 @@ void RSDirtyRegionManager::OnSync(std::shared_ptr<RSDirtyRegionManager> targetMa
     targetManager->hwcDirtyRegion_ = hwcDirtyRegion_;
     targetManager->currentFrameDirtyRegion_ = currentFrameDirtyRegion_;
     targetManager->debugRect_ = debugRect_;
+    if (isTileDirtyEnabled_ && targetManager->isTileDirtyEnabled_) {
+        targetManager->currentFrameDirtyTiles_ = currentFrameDirtyTiles_;
+        targetManager->dirtyTiles_ = dirtyTiles_;
+    }
     if (RSSystemProperties::GetDirtyRegionDebugType() != DirtyRegionDebugType::DISABLED) {
         targetManager->dirtySurfaceNodeInfo_ = dirtySurfaceNodeInfo_;
         targetManager->dirtyCanvasNodeInfo_ = dirtyCanvasNodeInfo_;
@@ -204,6 +225,26 @@ RectI RSDirtyRegionManager::GetRectFlipWithinSurface(const RectI& rect) const
     return glRect;
 }
 
+std::vector<RectI> RSDirtyRegionManager::GetDirtyRegionRectsFlipWithinSurface() const
+{
+    RectI bound = GetDirtyRegionFlipWithinSurface();
+    if (bound.IsEmpty()) {
+        return {};
+    }
+    if (!isTileDirtyEnabled_ ||
+        !dirtyTiles_.IsSameGrid(surfaceRect_.GetRight(), surfaceRect_.GetBottom(), DIRTY_TILE_SIZE)) {
+        return { bound };
+    }
+    std::vector<RectI> rects = dirtyTiles_.GetRects();
+    if (rects.empty() || rects.size() > MAX_DIRTY_TILE_RECTS) {
+        return { bound };
+    }
+    for (auto& rect : rects) {
+        rect = GetRectFlipWithinSurface(rect);
+    }
+    return rects;
+}
+
 const RectI& RSDirtyRegionManager::GetLatestDirtyRegion() const
 {
     if (historyHead_ < 0) {
@@ -229,6 +270,8 @@ void RSDirtyRegionManager::Clear()
 {
     dirtyRegion_.Clear();
     currentFrameDirtyRegion_.Clear();
+    currentFrameDirtyTiles_.Clear();
+    dirtyTiles_.Clear();
     hwcDirtyRegion_.Clear();
     visitedDirtyRegions_.clear();
     mergedDirtyRegions_.clear();
@@ -263,6 +306,9 @@ void RSDirtyRegionManager::UpdateDirty(bool enableAligned)
     isDirtyRegionAlignedEnable_ = enableAligned;
     PushHistory(currentFrameDirtyRegion_);
     dirtyRegion_ = MergeHistory(bufferAge_, currentFrameDirtyRegion_);
+    if (isTileDirtyEnabled_) {
+        UpdateDirtyTiles();
+    }
 }
 
 void RSDirtyRegionManager::UpdateDirtyByAligned(int32_t alignedBits)
@@ -329,6 +375,11 @@ bool RSDirtyRegionManager::SetSurfaceSize(const int32_t width, const int32_t hei
         return false;
     }
     surfaceRect_ = RectI(0, 0, width, height);
+    if (isTileDirtyEnabled_ && !currentFrameDirtyTiles_.IsSameGrid(width, height, DIRTY_TILE_SIZE)) {
+        // resizing clears the tiles, keep the rects merged so far as their bound
+        currentFrameDirtyTiles_.SetSize(width, height, DIRTY_TILE_SIZE);
+        currentFrameDirtyTiles_.MarkRect(currentFrameDirtyRegion_);
+    }
     return true;
 }
 
@@ -341,6 +392,10 @@ void RSDirtyRegionManager::ResetDirtyAsSurfaceSize()
 {
     dirtyRegion_ = surfaceRect_;
     currentFrameDirtyRegion_ = surfaceRect_;
+    if (isTileDirtyEnabled_) {
+        currentFrameDirtyTiles_.MarkAll();
+        dirtyTiles_.MarkAll();
+    }
 }
 
 void RSDirtyRegionManager::UpdateDebugRegionTypeEnable(DirtyRegionDebugType dirtyDebugType)
@@ -407,6 +462,11 @@ void RSDirtyRegionManager::PushHistory(RectI rect)
 }
 
 RectI RSDirtyRegionManager::GetHistory(unsigned int i) const
+{
+    return dirtyHistory_[GetHistoryIndex(i)];
+}
+
+unsigned int RSDirtyRegionManager::GetHistoryIndex(unsigned int i) const
 {
     if (i >= HISTORY_QUEUE_MAX_SIZE) {
         i %= HISTORY_QUEUE_MAX_SIZE;
@@ -414,7 +474,7 @@ RectI RSDirtyRegionManager::GetHistory(unsigned int i) const
     if (historySize_ > 0) {
         i = (i + historyHead_) % historySize_;
     }
-    return dirtyHistory_[i];
+    return i;
 }
 
 void RSDirtyRegionManager::AlignHistory()
@@ -424,5 +484,35 @@ void RSDirtyRegionManager::AlignHistory()
     }
 }
 
+void RSDirtyRegionManager::UpdateDirtyTiles()
+{
+    int32_t width = surfaceRect_.GetRight();
+    int32_t height = surfaceRect_.GetBottom();
+    if (currentFrameDirtyTiles_.IsSameGrid(width, height, DIRTY_TILE_SIZE)) {
+        // currentFrameDirtyRegion_ may have been clipped since the rects were marked
+        currentFrameDirtyTiles_.IntersectRect(currentFrameDirtyRegion_);
+    } else {
+        currentFrameDirtyTiles_.SetSize(width, height, DIRTY_TILE_SIZE);
+        currentFrameDirtyTiles_.MarkRect(currentFrameDirtyRegion_);
+    }
+    for (unsigned int i = 0; i < dirtyTilesHistory_.size(); i++) {
+        if (!dirtyTilesHistory_[i].IsSameGrid(width, height, DIRTY_TILE_SIZE)) {
+            // tiles from before the surface was resized, fall back to their bound
+            dirtyTilesHistory_[i].SetSize(width, height, DIRTY_TILE_SIZE);
+            dirtyTilesHistory_[i].MarkRect(dirtyHistory_[i]);
+        }
+    }
+    // same as PushHistory() and MergeHistory() for the rects
+    dirtyTilesHistory_[historyHead_] = currentFrameDirtyTiles_;
+    dirtyTiles_ = currentFrameDirtyTiles_;
+    if (bufferAge_ == 0 || bufferAge_ > historySize_) {
+        dirtyTiles_.MarkAll();
+        return;
+    }
+    for (unsigned int i = historySize_; i > historySize_ - bufferAge_; --i) {
+        dirtyTiles_.Or(dirtyTilesHistory_[GetHistoryIndex(i - 1)]);
+    }
+}
+
 } // namespace Rosen
 } // namespace OHOS
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pipeline/rs_dirty_tile_map.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace Rosen {
+void RSDirtyTileMap::SetSize(int32_t width, int32_t height, int32_t tileSize)
+{
+    if (width <= 0 || height <= 0 || tileSize <= 0) {
+        width = 0;
+        height = 0;
+        tileSize = 0;
+    }
+    if (IsSameGrid(width, height, tileSize)) {
+        return;
+    }
+    width_ = width;
+    height_ = height;
+    tileSize_ = tileSize;
+    cols_ = tileSize > 0 ? (width + tileSize - 1) / tileSize : 0;
+    rows_ = tileSize > 0 ? (height + tileSize - 1) / tileSize : 0;
+    wordsPerRow_ = (cols_ + WORD_BITS - 1) / WORD_BITS;
+    words_.assign(static_cast<size_t>(wordsPerRow_) * rows_, 0);
+}
+
+bool RSDirtyTileMap::GetTileRange(
+    const RectI& rect, int32_t& colBegin, int32_t& rowBegin, int32_t& colEnd, int32_t& rowEnd) const
+{
+    int32_t left = std::max(rect.left_, 0);
+    int32_t top = std::max(rect.top_, 0);
+    int32_t right = std::min(rect.GetRight(), width_);
+    int32_t bottom = std::min(rect.GetBottom(), height_);
+    if (left >= right || top >= bottom) {
+        return false;
+    }
+    colBegin = left / tileSize_;
+    rowBegin = top / tileSize_;
+    colEnd = (right - 1) / tileSize_ + 1;
+    rowEnd = (bottom - 1) / tileSize_ + 1;
+    return true;
+}
+
+void RSDirtyTileMap::SetBits(int32_t row, int32_t begin, int32_t end)
+{
+    uint64_t* words = words_.data() + row * wordsPerRow_;
+    while (begin < end) {
+        int32_t word = begin / WORD_BITS;
+        int32_t last = std::min(end - word * WORD_BITS, WORD_BITS);
+        uint64_t mask = last == WORD_BITS ? ~0ull : (1ull << last) - 1;
+        words[word] |= mask & (~0ull << (begin % WORD_BITS));
+        begin = (word + 1) * WORD_BITS;
+    }
+}
+
+void RSDirtyTileMap::ClearBits(int32_t row, int32_t begin, int32_t end)
+{
+    uint64_t* words = words_.data() + row * wordsPerRow_;
+    while (begin < end) {
+        int32_t word = begin / WORD_BITS;
+        int32_t last = std::min(end - word * WORD_BITS, WORD_BITS);
+        uint64_t mask = last == WORD_BITS ? ~0ull : (1ull << last) - 1;
+        words[word] &= ~(mask & (~0ull << (begin % WORD_BITS)));
+        begin = (word + 1) * WORD_BITS;
+    }
+}
+
+void RSDirtyTileMap::MarkRect(const RectI& rect)
+{
+    int32_t colBegin = 0;
+    int32_t rowBegin = 0;
+    int32_t colEnd = 0;
+    int32_t rowEnd = 0;
+    if (!GetTileRange(rect, colBegin, rowBegin, colEnd, rowEnd)) {
+        return;
+    }
+    for (int32_t row = rowBegin; row < rowEnd; row++) {
+        SetBits(row, colBegin, colEnd);
+    }
+}
+
+void RSDirtyTileMap::MarkAll()
+{
+    for (int32_t row = 0; row < rows_; row++) {
+        SetBits(row, 0, cols_);
+    }
+}
+
+void RSDirtyTileMap::IntersectRect(const RectI& rect)
+{
+    int32_t colBegin = 0;
+    int32_t rowBegin = 0;
+    int32_t colEnd = 0;
+    int32_t rowEnd = 0;
+    if (!GetTileRange(rect, colBegin, rowBegin, colEnd, rowEnd)) {
+        Clear();
+        return;
+    }
+    for (int32_t row = 0; row < rows_; row++) {
+        if (row < rowBegin || row >= rowEnd) {
+            ClearBits(row, 0, cols_);
+        } else {
+            ClearBits(row, 0, colBegin);
+            ClearBits(row, colEnd, cols_);
+        }
+    }
+}
+
+void RSDirtyTileMap::Or(const RSDirtyTileMap& other)
+{
+    if (!IsSameGrid(other)) {
+        return;
+    }
+    for (size_t i = 0; i < words_.size(); i++) {
+        words_[i] |= other.words_[i];
+    }
+}
+
+void RSDirtyTileMap::Clear()
+{
+    std::fill(words_.begin(), words_.end(), 0);
+}
+
+bool RSDirtyTileMap::IsEmpty() const
+{
+    return std::all_of(words_.begin(), words_.end(), [](uint64_t word) { return word == 0; });
+}
+
+int32_t RSDirtyTileMap::GetDirtyTileCount() const
+{
+    int32_t count = 0;
+    for (uint64_t word : words_) {
+        for (; word != 0; word &= word - 1) {
+            count++;
+        }
+    }
+    return count;
+}
+
+std::vector<RectI> RSDirtyTileMap::GetRects() const
+{
+    // a run of dirty tiles [begin, end) in the rows from top to the current one
+    struct Run {
+        int32_t begin;
+        int32_t end;
+        int32_t top;
+    };
+    std::vector<RectI> rects;
+    std::vector<Run> openRuns;
+    std::vector<Run> nextRuns;
+    auto closeRun = [this, &rects](const Run& run, int32_t bottom) {
+        int32_t left = run.begin * tileSize_;
+        int32_t top = run.top * tileSize_;
+        rects.emplace_back(left, top, std::min(run.end * tileSize_, width_) - left,
+            std::min(bottom * tileSize_, height_) - top);
+    };
+    for (int32_t row = 0; row < rows_; row++) {
+        nextRuns.clear();
+        size_t openIndex = 0;
+        int32_t col = 0;
+        while (col < cols_) {
+            if ((words_[row * wordsPerRow_ + col / WORD_BITS] >> (col % WORD_BITS)) == 0) {
+                col = (col / WORD_BITS + 1) * WORD_BITS;
+                continue;
+            }
+            while (!GetBit(row, col)) {
+                col++;
+            }
+            int32_t begin = col;
+            while (col < cols_ && GetBit(row, col)) {
+                col++;
+            }
+            // runs are sorted by begin, the open runs starting before this one can not be continued any more
+            while (openIndex < openRuns.size() && openRuns[openIndex].begin < begin) {
+                closeRun(openRuns[openIndex++], row);
+            }
+            if (openIndex < openRuns.size() && openRuns[openIndex].begin == begin &&
+                openRuns[openIndex].end == col) {
+                nextRuns.push_back(openRuns[openIndex++]);
+            } else {
+                nextRuns.push_back({ begin, col, row });
+            }
+        }
+        while (openIndex < openRuns.size()) {
+            closeRun(openRuns[openIndex++], row);
+        }
+        openRuns.swap(nextRuns);
+    }
+    for (const auto& run : openRuns) {
+        closeRun(run, rows_);
+    }
+    return rects;
+}
+} // namespace Rosen
+} // namespace OHOS
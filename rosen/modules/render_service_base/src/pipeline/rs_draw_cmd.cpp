@@ -460,7 +460,7 @@ DrawImageWithParmOpItem::DrawImageWithParmOpItem(const std::shared_ptr<Image>& i
 
 std::shared_ptr<DrawOpItem> DrawImageWithParmOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawImageWithParmOpItem>(
+    return cmdList.MakeDrawOp<DrawImageWithParmOpItem>(
         cmdList, static_cast<DrawImageWithParmOpItem::ConstructorHandle*>(handle));
 }
 
@@ -511,7 +511,7 @@ DrawPixelMapWithParmOpItem::DrawPixelMapWithParmOpItem(const std::shared_ptr<Med
 
 std::shared_ptr<DrawOpItem> DrawPixelMapWithParmOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawPixelMapWithParmOpItem>(
+    return cmdList.MakeDrawOp<DrawPixelMapWithParmOpItem>(
         cmdList, static_cast<DrawPixelMapWithParmOpItem::ConstructorHandle*>(handle));
 }
 
@@ -562,7 +562,7 @@ DrawPixelMapRectOpItem::DrawPixelMapRectOpItem(const std::shared_ptr<Media::Pixe
 
 std::shared_ptr<DrawOpItem> DrawPixelMapRectOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawPixelMapRectOpItem>(
+    return cmdList.MakeDrawOp<DrawPixelMapRectOpItem>(
         cmdList, static_cast<DrawPixelMapRectOpItem::ConstructorHandle*>(handle));
 }
 
@@ -609,7 +609,7 @@ DrawFuncOpItem::DrawFuncOpItem(RecordingCanvas::DrawFunc&& drawFunc) : DrawOpIte
 
 std::shared_ptr<DrawOpItem> DrawFuncOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawFuncOpItem>(cmdList, static_cast<DrawFuncOpItem::ConstructorHandle*>(handle));
+    return cmdList.MakeDrawOp<DrawFuncOpItem>(cmdList, static_cast<DrawFuncOpItem::ConstructorHandle*>(handle));
 }
 
 void DrawFuncOpItem::Marshalling(DrawCmdList& cmdList)
@@ -646,7 +646,7 @@ DrawSurfaceBufferOpItem::~DrawSurfaceBufferOpItem()
 
 std::shared_ptr<DrawOpItem> DrawSurfaceBufferOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
 {
-    return std::make_shared<DrawSurfaceBufferOpItem>(cmdList,
+    return cmdList.MakeDrawOp<DrawSurfaceBufferOpItem>(cmdList,
         static_cast<DrawSurfaceBufferOpItem::ConstructorHandle*>(handle));
 }
 
@@ -31,6 +31,7 @@
 #include "common/rs_optional_trace.h"
 #include "drawable/rs_misc_drawable.h"
 #include "drawable/rs_render_node_drawable_adapter.h"
+#include "memory/rs_slab_allocator.h"
 #include "modifier/rs_modifier_type.h"
 #include "offscreen_render/rs_offscreen_render_thread.h"
 #include "params/rs_render_params.h"
@@ -236,12 +237,15 @@ void RSRenderNode::AddChild(SharedPtr child, int index)
 
     // Set parent-child relationship
     child->SetParent(weak_from_this());
-    if (index < 0 || index >= static_cast<int>(children_.size())) {
+    bool isAppended = index < 0 || index >= static_cast<int>(children_.size());
+    if (isAppended) {
         children_.emplace_back(child);
     } else {
         children_.emplace(std::next(children_.begin(), index), child);
     }
 
+    // a disappearing child is already in fullChildrenList_
+    isAppended = isAppended && disappearingChildren_.empty() && !isContainBootAnimation_;
     disappearingChildren_.remove_if([&child](const auto& pair) -> bool { return pair.first == child; });
     // A child is not on the tree until its parent is on the tree
     if (isOnTheTree_) {
@@ -249,7 +253,11 @@ void RSRenderNode::AddChild(SharedPtr child, int index)
     }
     ROSEN_LOGD("Node id %{public}" PRIu64 " set dirty, render node add child", GetId());
     SetContentDirty();
-    isFullChildrenListValid_ = false;
+    if (isAppended) {
+        appendedChildren_.emplace_back(child);
+    } else {
+        isFullChildrenListValid_ = false;
+    }
 }
 
 void RSRenderNode::SetContainBootAnimation(bool isContainBootAnimation)
@@ -269,13 +277,14 @@ void RSRenderNode::MoveChild(SharedPtr child, int index)
         return;
     }
 
-    // Reset parent-child relationship
-    if (index < 0 || index >= static_cast<int>(children_.size())) {
+    // Reset parent-child relationship, index counts the child at its old position
+    int oldIndex = static_cast<int>(std::distance(children_.begin(), it));
+    children_.erase(it);
+    if (index < 0 || index > static_cast<int>(children_.size())) {
         children_.emplace_back(child);
     } else {
-        children_.emplace(std::next(children_.begin(), index), child);
+        children_.emplace(std::next(children_.begin(), index > oldIndex ? index - 1 : index), child);
     }
-    children_.erase(it);
     ROSEN_LOGD("Node id %{public}" PRIu64 " set dirty, render node move child", GetId());
     SetContentDirty();
     isFullChildrenListValid_ = false;
@@ -657,7 +666,7 @@ void RSRenderNode::DumpTree(int32_t depth, std::string& out) const
     DumpModifiers(out);
     animationManager_.DumpAnimations(out);
 
-    if (!isFullChildrenListValid_) {
+    if (!isFullChildrenListValid_ || !appendedChildren_.empty()) {
         out += ", Children list needs update, current count: " + std::to_string(fullChildrenList_->size()) +
                " expected count: " + std::to_string(GetSortedChildren()->size());
         if (!disappearingChildren_.empty()) {
@@ -1047,6 +1056,23 @@ void RSRenderNode::InternalRemoveSelfFromDisappearingChildren()
     ResetParent();
 }
 
+void* RSRenderNode::operator new(size_t size)
+{
+    return GetAllocator().Allocate(size);
+}
+
+void RSRenderNode::operator delete(void* ptr, size_t size)
+{
+    GetAllocator().Free(ptr, size);
+}
+
+RSSlabAllocator& RSRenderNode::GetAllocator()
+{
+    // never destroyed, instances may outlive static destructors
+    static auto* allocator = new RSSlabAllocator();
+    return *allocator;
+}
+
 RSRenderNode::~RSRenderNode()
 {
     if (appPid_ != 0) {
@@ -1126,6 +1152,15 @@ std::tuple<bool, bool, bool> RSRenderNode::Animate(int64_t timestamp, int64_t pe
     return animateResult;
 }
 
+void RSRenderNode::PrepareAnimate(int64_t timestamp, RSAnimationScheduler& scheduler)
+{
+    // whether display sync skips this frame is only decided in Animate(), so these nodes interpolate there
+    if (displaySync_) {
+        return;
+    }
+    animationManager_.PrepareAnimate(timestamp, IsOnTheTree(), scheduler);
+}
+
 bool RSRenderNode::IsClipBound() const
 {
     return GetRenderProperties().GetClipToBounds() || GetRenderProperties().GetClipToFrame();
@@ -1163,7 +1198,7 @@ const std::unique_ptr<RSRenderParams>& RSRenderNode::GetRenderParams() const
 void RSRenderNode::CollectAndUpdateLocalShadowRect()
 {
     // update shadow if shadow changes
-    if (dirtySlots_.find(RSDrawableSlot::SHADOW) != dirtySlots_.end()) {
+    if (dirtySlots_.test(static_cast<size_t>(RSDrawableSlot::SHADOW))) {
         auto& properties = GetRenderProperties();
         if (properties.IsShadowValid()) {
             SetShadowValidLastFrame(true);
@@ -1181,7 +1216,7 @@ void RSRenderNode::CollectAndUpdateLocalShadowRect()
 void RSRenderNode::CollectAndUpdateLocalOutlineRect()
 {
     // update outline if oueline changes
-    if (dirtySlots_.find(RSDrawableSlot::OUTLINE) != dirtySlots_.end()) {
+    if (dirtySlots_.test(static_cast<size_t>(RSDrawableSlot::OUTLINE))) {
         RSPropertiesPainter::GetOutlineDirtyRect(localOutlineRect_, GetRenderProperties(), false);
     }
     selfDrawRect_ = selfDrawRect_.JoinRect(localOutlineRect_.ConvertTo<float>());
@@ -1190,7 +1225,7 @@ void RSRenderNode::CollectAndUpdateLocalOutlineRect()
 void RSRenderNode::CollectAndUpdateLocalPixelStretchRect()
 {
     // update outline if oueline changes
-    if (dirtySlots_.find(RSDrawableSlot::PIXEL_STRETCH) != dirtySlots_.end()) {
+    if (dirtySlots_.test(static_cast<size_t>(RSDrawableSlot::PIXEL_STRETCH))) {
         RSPropertiesPainter::GetPixelStretchDirtyRect(localPixelStretchRect_, GetRenderProperties(), false);
     }
     selfDrawRect_ = selfDrawRect_.JoinRect(localPixelStretchRect_.ConvertTo<float>());
@@ -1800,9 +1835,9 @@ void RSRenderNode::CheckBlurFilterCacheNeedForceClearOrSave(bool rotationChanged
     if (properties.GetBackgroundFilter()) {
         auto filterDrawable = GetFilterDrawable(false);
         if (filterDrawable != nullptr) {
-            auto bgDirty = dirtySlots_.count(RSDrawableSlot::BACKGROUND_COLOR) ||
-                dirtySlots_.count(RSDrawableSlot::BACKGROUND_SHADER) ||
-                dirtySlots_.count(RSDrawableSlot::BACKGROUND_IMAGE);
+            auto bgDirty = dirtySlots_.test(static_cast<size_t>(RSDrawableSlot::BACKGROUND_COLOR)) ||
+                dirtySlots_.test(static_cast<size_t>(RSDrawableSlot::BACKGROUND_SHADER)) ||
+                dirtySlots_.test(static_cast<size_t>(RSDrawableSlot::BACKGROUND_IMAGE));
             if (!(filterDrawable->IsForceClearFilterCache()) && (rotationClear || bgDirty)) {
                 RS_OPTIONAL_TRACE_NAME_FMT("RSRenderNode[%llu] background color or shader or image is dirty", GetId());
                 filterDrawable->MarkFilterForceClearCache();
@@ -1815,7 +1850,7 @@ void RSRenderNode::CheckBlurFilterCacheNeedForceClearOrSave(bool rotationChanged
     if (properties.GetFilter()) {
         auto filterDrawable = GetFilterDrawable(true);
         if (filterDrawable != nullptr) {
-            if (!(filterDrawable->IsForceClearFilterCache()) && (rotationStatusChanged || !dirtySlots_.empty())) {
+            if (!(filterDrawable->IsForceClearFilterCache()) && (rotationStatusChanged || dirtySlots_.any())) {
                 RS_OPTIONAL_TRACE_NAME_FMT("RSRenderNode[%llu] foreground is dirty", GetId());
                 filterDrawable->MarkFilterForceClearCache();
             }
@@ -1932,7 +1967,7 @@ bool RSRenderNode::IsBackgroundInAppOrNodeSelfDirty() const
 
 void RSRenderNode::UpdateDirtySlotsAndPendingNodes(RSDrawableSlot slot)
 {
-    dirtySlots_.emplace(slot);
+    dirtySlots_.set(static_cast<size_t>(slot));
     AddToPendingSyncList();
 }
 
@@ -2285,6 +2320,9 @@ void RSRenderNode::ApplyModifiers()
     if (UNLIKELY(!isFullChildrenListValid_)) {
         GenerateFullChildrenList();
         AddDirtyType(RSModifierType::CHILDREN);
+    } else if (UNLIKELY(!appendedChildren_.empty())) {
+        AppendFullChildrenList();
+        AddDirtyType(RSModifierType::CHILDREN);
     } else if (UNLIKELY(!isChildrenSorted_)) {
         ResortChildren();
         AddDirtyType(RSModifierType::CHILDREN);
@@ -2378,31 +2416,27 @@ void RSRenderNode::UpdateDrawableVecV2()
 {
     // Step 1: Collect dirty slots
     auto dirtySlots = RSDrawable::CalculateDirtySlots(dirtyTypes_, drawableVec_);
-    if (dirtySlots.empty()) {
+    if (dirtySlots.none()) {
         return;
     }
     // Step 2: Update or regenerate drawable if needed
     bool drawableChanged = RSDrawable::UpdateDirtySlots(*this, drawableVec_, dirtySlots);
     // If any drawable has changed, or the CLIP_TO_BOUNDS slot has changed, then we need to recalculate
     // save/clip/restore.
-    if (drawableChanged || dirtySlots.count(RSDrawableSlot::CLIP_TO_BOUNDS)) {
+    if (drawableChanged || dirtySlots.test(static_cast<size_t>(RSDrawableSlot::CLIP_TO_BOUNDS))) {
         // Step 3: Recalculate save/clip/restore on demands
         RSDrawable::UpdateSaveRestore(*this, drawableVec_, drawableVecStatus_);
         // if shadow changed, update shadow rect
         UpdateShadowRect();
         UpdateDirtySlotsAndPendingNodes(RSDrawableSlot::SHADOW);
-        std::unordered_set<RSDrawableSlot> dirtySlotShadow;
-        dirtySlotShadow.emplace(RSDrawableSlot::SHADOW);
+        RSDrawable::DirtySlots dirtySlotShadow;
+        dirtySlotShadow.set(static_cast<size_t>(RSDrawableSlot::SHADOW));
         RSDrawable::UpdateDirtySlots(*this, drawableVec_, dirtySlotShadow);
         // Step 4: Generate drawCmdList from drawables
         UpdateDisplayList();
     }
     // Merge dirty slots
-    if (dirtySlots_.empty()) {
-        dirtySlots_ = std::move(dirtySlots);
-    } else {
-        dirtySlots_.insert(dirtySlots.begin(), dirtySlots.end());
-    }
+    dirtySlots_ |= dirtySlots;
 }
 
 void RSRenderNode::UpdateDrawableVecInternal(std::unordered_set<RSPropertyDrawableSlot> dirtySlots)
@@ -3274,6 +3308,7 @@ void RSRenderNode::GenerateFullChildrenList()
 {
     // both children_ and disappearingChildren_ are empty, no need to generate fullChildrenList_
     if (children_.empty() && disappearingChildren_.empty()) {
+        appendedChildren_.clear();
         auto prevFullChildrenList = fullChildrenList_;
         isFullChildrenListValid_ = true;
         isChildrenSorted_ = true;
@@ -3283,9 +3318,11 @@ void RSRenderNode::GenerateFullChildrenList()
 
     // Step 0: Initialize
     auto fullChildrenList = std::make_shared<std::vector<std::shared_ptr<RSRenderNode>>>();
+    fullChildrenList->reserve(children_.size() + disappearingChildren_.size());
+    appendedChildren_.clear();
 
     // Step 1: Copy all children into sortedChildren while checking and removing expired children.
-    children_.remove_if([&](const auto& child) -> bool {
+    auto expiredChildren = std::remove_if(children_.begin(), children_.end(), [&](const auto& child) -> bool {
         auto existingChild = child.lock();
         if (existingChild == nullptr) {
             ROSEN_LOGI("RSRenderNode::GenerateSortedChildren removing expired child, this is rare but possible.");
@@ -3300,6 +3337,7 @@ void RSRenderNode::GenerateFullChildrenList()
         fullChildrenList->emplace_back(std::move(existingChild));
         return false;
     });
+    children_.erase(expiredChildren, children_.end());
 
     // Step 2: Insert disappearing children into sortedChildren at their original position.
     // Note:
@@ -3341,6 +3379,39 @@ void RSRenderNode::GenerateFullChildrenList()
     std::atomic_store_explicit(&fullChildrenList_, constFullChildrenList, std::memory_order_release);
 }
 
+void RSRenderNode::AppendFullChildrenList()
+{
+    // the new children have to be sorted together with the others
+    if (!isChildrenSorted_) {
+        GenerateFullChildrenList();
+        return;
+    }
+    auto fullChildrenList = std::make_shared<std::vector<std::shared_ptr<RSRenderNode>>>();
+    fullChildrenList->reserve(fullChildrenList_->size() + appendedChildren_.size());
+    fullChildrenList->assign(fullChildrenList_->begin(), fullChildrenList_->end());
+    for (auto& weakChild : appendedChildren_) {
+        auto child = weakChild.lock();
+        if (child == nullptr) {
+            continue;
+        }
+        // temporary fix for wrong z-order
+        child->ApplyPositionZModifier();
+        // same position as the stable sort in GenerateFullChildrenList(), after the children with the same z-order
+        auto positionZ = child->GetRenderProperties().GetPositionZ();
+        auto it = std::upper_bound(fullChildrenList->begin(), fullChildrenList->end(), positionZ,
+            [](float z, const auto& node) -> bool { return z < node->GetRenderProperties().GetPositionZ(); });
+        fullChildrenList->emplace(it, std::move(child));
+    }
+    appendedChildren_.clear();
+
+    // Keep a reference to fullChildrenList_ to prevent its deletion when swapping it
+    auto prevFullChildrenList = fullChildrenList_;
+
+    // Move the fullChildrenList to fullChildrenList_ atomically
+    ChildrenListSharedPtr constFullChildrenList = std::move(fullChildrenList);
+    std::atomic_store_explicit(&fullChildrenList_, constFullChildrenList, std::memory_order_release);
+}
+
 void RSRenderNode::ResortChildren()
 {
     // Make a copy of the fullChildrenList for sorting
@@ -3929,30 +4000,24 @@ void RSRenderNode::OnSync()
     }
 
     if (!uifirstSkipPartialSync_) {
-        if (!dirtySlots_.empty()) {
-            for (const auto& slot : dirtySlots_) {
-                if (auto& drawable = drawableVec_[static_cast<uint32_t>(slot)]) {
-                    drawable->OnSync();
-                }
+        RSDrawable::ForEachSlot(dirtySlots_, [this](RSDrawableSlot slot) {
+            if (auto& drawable = drawableVec_[static_cast<uint32_t>(slot)]) {
+                drawable->OnSync();
             }
-            dirtySlots_.clear();
-        }
+        });
+        dirtySlots_.reset();
     } else {
         RS_TRACE_NAME_FMT("partial_sync %lld", GetId());
-        std::vector<RSDrawableSlot> todele;
-        if (!dirtySlots_.empty()) {
-            for (const auto& slot : dirtySlots_) {
-                if (slot != RSDrawableSlot::CONTENT_STYLE && slot != RSDrawableSlot::CHILDREN) { // SAVE_FRAME
-                    if (auto& drawable = drawableVec_[static_cast<uint32_t>(slot)]) {
-                        drawable->OnSync();
-                    }
-                    todele.push_back(slot);
-                }
-            }
-            for (const auto& slot : todele) {
-                dirtySlots_.erase(slot);
+        // SAVE_FRAME
+        RSDrawable::DirtySlots skippedSlots;
+        skippedSlots.set(static_cast<size_t>(RSDrawableSlot::CONTENT_STYLE));
+        skippedSlots.set(static_cast<size_t>(RSDrawableSlot::CHILDREN));
+        RSDrawable::ForEachSlot(dirtySlots_ & ~skippedSlots, [this](RSDrawableSlot slot) {
+            if (auto& drawable = drawableVec_[static_cast<uint32_t>(slot)]) {
+                drawable->OnSync();
             }
-        }
+        });
+        dirtySlots_ &= skippedSlots;
         uifirstSkipPartialSync_ = false;
         isLeashWindowPartialSkip = true;
     }
@@ -3969,6 +4034,14 @@ void RSRenderNode::OnSync()
     lastFrameSynced_ = !isLeashWindowPartialSkip;
 }
 
+void RSRenderNode::SyncRenderParams()
+{
+    if (renderDrawable_ == nullptr || stagingRenderParams_ == nullptr || !stagingRenderParams_->NeedSync()) {
+        return;
+    }
+    stagingRenderParams_->OnSync(renderDrawable_->renderParams_);
+}
+
 bool RSRenderNode::ShouldClearSurface()
 {
     bool renderGroupFlag = GetDrawingCacheType() != RSDrawingCacheType::DISABLED_CACHE || isOpincRootFlag_;
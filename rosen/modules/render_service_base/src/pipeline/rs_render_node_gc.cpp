@@ -15,6 +15,7 @@
 
 #include "pipeline/rs_render_node_gc.h"
 
+#include "memory/rs_slab_allocator.h"
 #include "params/rs_render_params.h"
 #include "pipeline/rs_render_node.h"
 #include "rs_trace.h"
@@ -59,6 +60,8 @@ void RSRenderNodeGC::ReleaseNodeBucket()
         nodeBucket_.pop();
     }
     RS_TRACE_NAME_FMT("ReleaseNodeMemory %d", toDele.size());
+    // the slab blocks of the whole bucket go back under one lock
+    RSSlabAllocator::BatchFree batchFree(RSRenderNode::GetAllocator());
     for (auto ptr : toDele) {
         if (ptr) {
             delete ptr;
@@ -118,6 +121,7 @@ void RSRenderNodeGC::ReleaseDrawableBucket()
         drawableBucket_.pop();
     }
     RS_TRACE_NAME_FMT("ReleaseDrawableMemory %d", toDele.size());
+    RSSlabAllocator::BatchFree batchFree(DrawableV2::RSRenderNodeDrawableAdapter::GetAllocator());
     for (auto ptr : toDele) {
         if (ptr) {
             delete ptr;
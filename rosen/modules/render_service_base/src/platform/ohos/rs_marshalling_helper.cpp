@@ -55,6 +55,7 @@
 #include "render/rs_pixel_map_shader.h"
 #include "render/rs_shader.h"
 #include "transaction/rs_ashmem_helper.h"
+#include "transaction/rs_property_delta_block.h"
 
 #ifdef ROSEN_OHOS
 #include "buffer_utils.h"
@@ -1446,6 +1447,8 @@ bool RSMarshallingHelper::Marshalling(Parcel& parcel, const std::shared_ptr<Draw
     if (!val) {
         return parcel.WriteInt32(-1);
     }
+    // no-op for a list flattened by FinishRecording, the op data may still be chunked for other recordings
+    val->FlattenOpData();
     auto cmdListData = val->GetData();
     bool ret = parcel.WriteInt32(cmdListData.second);
     parcel.WriteInt32(val->GetWidth());
@@ -1587,18 +1590,17 @@ bool RSMarshallingHelper::Unmarshalling(Parcel& parcel, std::shared_ptr<Drawing:
         replacedOpList.emplace_back(regionPos, replacePos);
     }
 
-    bool isMalloc = false;
-    const void* data = RSMarshallingHelper::ReadFromParcel(parcel, size, isMalloc);
+    // Large buffers are copied from the ashmem mapping into the list directly, without an intermediate copy.
+    std::shared_ptr<void> dataHolder;
+    const void* data = RSMarshallingHelper::ReadFromParcelMapped(parcel, size, dataHolder);
     if (data == nullptr) {
         ROSEN_LOGE("unirender: failed RSMarshallingHelper::Unmarshalling Drawing::DrawCmdList");
         return false;
     }
 
     val = Drawing::DrawCmdList::CreateFromData({ data, size }, true);
-    if (isMalloc) {
-        free(const_cast<void*>(data));
-        data = nullptr;
-    }
+    data = nullptr;
+    dataHolder = nullptr;
     if (val == nullptr) {
         ROSEN_LOGE("unirender: failed RSMarshallingHelper::Unmarshalling Drawing::DrawCmdList is nullptr");
         return false;
@@ -1612,32 +1614,24 @@ bool RSMarshallingHelper::Unmarshalling(Parcel& parcel, std::shared_ptr<Drawing:
 
     int32_t imageSize = parcel.ReadInt32();
     if (imageSize > 0) {
-        bool isMal = false;
-        const void* imageData = RSMarshallingHelper::ReadFromParcel(parcel, imageSize, isMal);
+        std::shared_ptr<void> imageHolder;
+        const void* imageData = RSMarshallingHelper::ReadFromParcelMapped(parcel, imageSize, imageHolder);
         if (imageData == nullptr) {
             ROSEN_LOGE("unirender: failed RSMarshallingHelper::Unmarshalling Drawing::DrawCmdList image is nullptr");
             return false;
         }
         val->SetUpImageData(imageData, imageSize);
-        if (isMal) {
-            free(const_cast<void*>(imageData));
-            imageData = nullptr;
-        }
     }
 
     int32_t bitmapSize = parcel.ReadInt32();
     if (bitmapSize > 0) {
-        bool isMal = false;
-        const void* bitmapData = RSMarshallingHelper::ReadFromParcel(parcel, bitmapSize, isMal);
+        std::shared_ptr<void> bitmapHolder;
+        const void* bitmapData = RSMarshallingHelper::ReadFromParcelMapped(parcel, bitmapSize, bitmapHolder);
         if (bitmapData == nullptr) {
             ROSEN_LOGE("unirender: failed RSMarshallingHelper::Unmarshalling Drawing::DrawCmdList bitmap is nullptr");
             return false;
         }
         val->SetUpBitmapData(bitmapData, bitmapSize);
-        if (isMal) {
-            free(const_cast<void*>(bitmapData));
-            bitmapData = nullptr;
-        }
     }
 
     bool ret = true;
@@ -1908,6 +1902,15 @@ bool RSMarshallingHelper::Unmarshalling(Parcel& parcel, std::shared_ptr<RSRender
     return val != nullptr;
 }
 
+bool RSMarshallingHelper::Marshalling(Parcel& parcel, const RSPropertyDeltaBlock& val)
+{
+    return val.Marshalling(parcel);
+}
+bool RSMarshallingHelper::Unmarshalling(Parcel& parcel, RSPropertyDeltaBlock& val)
+{
+    return val.Unmarshalling(parcel);
+}
+
 #define MARSHALLING_AND_UNMARSHALLING(TEMPLATE)                                                                       \
     template<typename T>                                                                                              \
     bool RSMarshallingHelper::Marshalling(Parcel& parcel, const std::shared_ptr<TEMPLATE<T>>& val)                    \
@@ -2061,6 +2064,22 @@ const void* RSMarshallingHelper::ReadFromParcel(Parcel& parcel, size_t size, boo
     return RS_PROFILER_READ_PARCEL_DATA(parcel, size, isMalloc);
 }
 
+const void* RSMarshallingHelper::ReadFromParcelMapped(Parcel& parcel, size_t size, std::shared_ptr<void>& holder)
+{
+    holder = nullptr;
+    uint32_t bufferSize = parcel.ReadUint32();
+    if (static_cast<unsigned int>(bufferSize) != size) {
+        ROSEN_LOGE("RSMarshallingHelper::ReadFromParcelMapped size mismatch");
+        return nullptr;
+    }
+    if (static_cast<unsigned int>(bufferSize) < MIN_DATA_SIZE ||
+        (!g_useSharedMem && g_tid == std::this_thread::get_id())) {
+        return parcel.ReadUnpadBuffer(size);
+    }
+    // read from ashmem
+    return RS_PROFILER_READ_PARCEL_DATA_MAPPED(parcel, size, holder);
+}
+
 bool RSMarshallingHelper::SkipFromParcel(Parcel& parcel, size_t size)
 {
     int32_t bufferSize = parcel.ReadInt32();
@@ -2092,6 +2111,20 @@ const void* RSMarshallingHelper::ReadFromAshmem(Parcel& parcel, size_t size, boo
     return ashmemAllocator->CopyFromAshmem(size);
 }
 
+const void* RSMarshallingHelper::ReadFromAshmemMapped(Parcel& parcel, size_t size, std::shared_ptr<void>& holder)
+{
+    int fd = static_cast<MessageParcel*>(&parcel)->ReadFileDescriptor();
+    std::shared_ptr<AshmemAllocator> ashmemAllocator =
+        AshmemAllocator::CreateAshmemAllocatorWithFd(fd, size, PROT_READ);
+    if (!ashmemAllocator || ashmemAllocator->GetData() == nullptr) {
+        ROSEN_LOGE("RSMarshallingHelper::ReadFromAshmemMapped CreateAshmemAllocator fail");
+        return nullptr;
+    }
+    // the mapping is released with holder
+    holder = ashmemAllocator;
+    return ashmemAllocator->GetData();
+}
+
 void RSMarshallingHelper::BeginNoSharedMem(std::thread::id tid)
 {
     g_useSharedMem = false;
@@ -223,6 +223,12 @@ float RSSystemProperties::GetClipRectThreshold()
     return threshold == nullptr ? std::atof(DEFAULT_CLIP_RECT_THRESHOLD) : std::atof(threshold);
 }
 
+bool RSSystemProperties::GetTileDirtyEnabled()
+{
+    static bool enabled = system::GetParameter("rosen.uni.partialrender.tiledirty.enabled", "0") != "0";
+    return enabled;
+}
+
 bool RSSystemProperties::GetAllSurfaceVisibleDebugEnabled()
 {
     static CachedHandle g_Handle = CachedParameterCreate("rosen.uni.allsurfacevisibledebug.enabled", "0");
@@ -1050,6 +1056,40 @@ uint32_t RSSystemProperties::GetUnMarshParallelSize()
     return size;
 }
 
+bool RSSystemProperties::GetParallelSyncFlag()
+{
+    static bool flag = system::GetParameter("rosen.graphic.parallelSyncEnabled", "0") != "0";
+    return flag;
+}
+
+uint32_t RSSystemProperties::GetParallelSyncSize()
+{
+    static uint32_t size =
+        static_cast<uint32_t>(std::atoi((system::GetParameter("rosen.graphic.parallelSyncSize", "256")).c_str()));
+    return size;
+}
+
+bool RSSystemProperties::GetAnimationSchedulerFlag()
+{
+    static bool flag = system::GetParameter("rosen.graphic.animationSchedulerEnabled", "1") != "0";
+    return flag;
+}
+
+uint32_t RSSystemProperties::GetAnimationParallelSize()
+{
+    static uint32_t size =
+        static_cast<uint32_t>(std::atoi((system::GetParameter("rosen.graphic.animationParallelSize", "256")).c_str()));
+    return size;
+}
+
+uint32_t RSSystemProperties::GetImageCacheBudget()
+{
+    // in KB, 0 disables keeping released images
+    static uint32_t budget =
+        static_cast<uint32_t>(std::atoi((system::GetParameter("rosen.graphic.imageCacheBudget", "0")).c_str()));
+    return budget;
+}
+
 int RSSystemProperties::GetRSNodeLimit()
 {
     static int rsNodeLimit =
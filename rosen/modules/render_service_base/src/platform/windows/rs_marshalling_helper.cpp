@@ -415,6 +415,15 @@ bool RSMarshallingHelper::Unmarshalling(Parcel& parcel, std::shared_ptr<RSRender
     return {};
 }
 
+bool RSMarshallingHelper::Marshalling(Parcel& parcel, const RSPropertyDeltaBlock& val)
+{
+    return {};
+}
+bool RSMarshallingHelper::Unmarshalling(Parcel& parcel, RSPropertyDeltaBlock& val)
+{
+    return {};
+}
+
 #define MARSHALLING_AND_UNMARSHALLING(TEMPLATE)                                                                       \
     template<typename T>                                                                                              \
     bool RSMarshallingHelper::Marshalling(Parcel& parcel, const std::shared_ptr<TEMPLATE<T>>& val)                    \
@@ -525,6 +534,11 @@ const void* RSMarshallingHelper::ReadFromParcel(Parcel& parcel, size_t size, boo
     return {};
 }
 
+const void* RSMarshallingHelper::ReadFromParcelMapped(Parcel& parcel, size_t size, std::shared_ptr<void>& holder)
+{
+    return {};
+}
+
 bool RSMarshallingHelper::SkipFromParcel(Parcel& parcel, size_t size)
 {
     return {};
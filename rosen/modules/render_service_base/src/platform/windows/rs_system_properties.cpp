@@ -92,6 +92,11 @@ float RSSystemProperties::GetClipRectThreshold()
     return 1.f;
 }
 
+bool RSSystemProperties::GetTileDirtyEnabled()
+{
+    return false;
+}
+
 bool RSSystemProperties::GetAllSurfaceVisibleDebugEnabled()
 {
     return false;
@@ -473,6 +478,31 @@ uint32_t RSSystemProperties::GetUnMarshParallelSize()
     return UINT32_MAX;
 }
 
+bool RSSystemProperties::GetParallelSyncFlag()
+{
+    return false;
+}
+
+uint32_t RSSystemProperties::GetParallelSyncSize()
+{
+    return UINT32_MAX;
+}
+
+bool RSSystemProperties::GetAnimationSchedulerFlag()
+{
+    return false;
+}
+
+uint32_t RSSystemProperties::GetAnimationParallelSize()
+{
+    return UINT32_MAX;
+}
+
+uint32_t RSSystemProperties::GetImageCacheBudget()
+{
+    return 0;
+}
+
 bool RSSystemProperties::GetGpuOverDrawBufferOptimizeEnabled()
 {
     return false;
@@ -1981,7 +1981,8 @@ void RSPropertiesPainter::DrawParticle(const RSProperties& properties, RSPaintFi
     auto bounds = properties.GetDrawRegion();
     int imageCount = particleVector.GetParticleImageCount();
     auto imageVector = particleVector.GetParticleImageVector();
-    auto particleDrawable = std::make_shared<RSParticlesDrawable>(particles, imageVector, imageCount);
+    auto particleDrawable = std::make_shared<RSParticlesDrawable>(
+        particles, particleVector.GetParticleStores(), imageVector, imageCount);
     if (particleDrawable != nullptr) {
         particleDrawable->Draw(canvas, bounds);
     }
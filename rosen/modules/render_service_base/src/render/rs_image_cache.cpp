@@ -15,9 +15,24 @@
 
 #include "render/rs_image_cache.h"
 #include "pixel_map.h"
+#include "platform/common/rs_system_properties.h"
 
 namespace OHOS {
 namespace Rosen {
+namespace {
+constexpr size_t BYTES_PER_PIXEL = 4;
+constexpr size_t BYTE_CONVERT = 1024;
+
+size_t GetImageSize(const std::shared_ptr<Drawing::Image>& img)
+{
+    // the real format is not known here, count it as RGBA_8888
+    if (img == nullptr || img->GetWidth() <= 0 || img->GetHeight() <= 0) {
+        return 0;
+    }
+    return static_cast<size_t>(img->GetWidth()) * static_cast<size_t>(img->GetHeight()) * BYTES_PER_PIXEL;
+}
+} // namespace
+
 // modify the RSImageCache instance as global to extend life cycle, fix destructor crash
 static RSImageCache gRSImageCacheInstance;
 
@@ -26,70 +41,106 @@ RSImageCache& RSImageCache::Instance()
     return gRSImageCacheInstance;
 }
 
+RSImageCache::RSImageCache()
+    : retainedBudget_(static_cast<size_t>(RSSystemProperties::GetImageCacheBudget()) * BYTE_CONVERT)
+{}
+
+RSImageCache::Shard& RSImageCache::GetShard(uint64_t uniqueId) const
+{
+    // uniqueId is pid << 32 | sequence, mix both halves so one process still spreads over all shards
+    return shards_[(uniqueId ^ (uniqueId >> 32)) % SHARD_COUNT];
+}
+
 void RSImageCache::CacheDrawingImage(uint64_t uniqueId, std::shared_ptr<Drawing::Image> img)
 {
     if (img && uniqueId > 0) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        drawingImageCache_.emplace(uniqueId, std::make_pair(img, 0));
+        auto& shard = GetShard(uniqueId);
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+        shard.drawingImageCache_.emplace(uniqueId, std::make_pair(img, 0));
     }
 }
 
 std::shared_ptr<Drawing::Image> RSImageCache::GetDrawingImageCache(uint64_t uniqueId) const
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = drawingImageCache_.find(uniqueId);
-    if (it != drawingImageCache_.end()) {
+    auto& shard = GetShard(uniqueId);
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    auto it = shard.drawingImageCache_.find(uniqueId);
+    if (it != shard.drawingImageCache_.end()) {
+        hitCount_.fetch_add(1, std::memory_order_relaxed);
         return it->second.first;
     }
+    missCount_.fetch_add(1, std::memory_order_relaxed);
     return nullptr;
 }
 
 void RSImageCache::IncreaseDrawingImageCacheRefCount(uint64_t uniqueId)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = drawingImageCache_.find(uniqueId);
-    if (it != drawingImageCache_.end()) {
-        it->second.second++;
+    auto& shard = GetShard(uniqueId);
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    auto it = shard.drawingImageCache_.find(uniqueId);
+    if (it != shard.drawingImageCache_.end()) {
+        if (it->second.second++ == 0) {
+            ForgetRetainedLocked(shard, uniqueId, false);
+        }
     }
 }
 
 void RSImageCache::ReleaseDrawingImageCache(uint64_t uniqueId)
 {
     // release the Drawing::Image if no RSImage holds it
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = drawingImageCache_.find(uniqueId);
-    if (it != drawingImageCache_.end()) {
+    std::vector<std::shared_ptr<void>> released;
+    {
+        auto& shard = GetShard(uniqueId);
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+        auto it = shard.drawingImageCache_.find(uniqueId);
+        if (it == shard.drawingImageCache_.end() ||
+            (it->second.second == 0 && shard.retainedDrawingImages_.count(uniqueId) > 0)) {
+            return;
+        }
         it->second.second--;
-        if (it->second.first == nullptr || it->second.second == 0) {
-            drawingImageCache_.erase(it);
+        if (it->second.first != nullptr && it->second.second != 0) {
+            return;
+        }
+        if (it->second.first == nullptr || !RetainLocked(shard, uniqueId, GetImageSize(it->second.first), false)) {
+            released.emplace_back(std::move(it->second.first));
+            shard.drawingImageCache_.erase(it);
+            return;
         }
     }
+    EvictOverBudget();
 }
 
 void RSImageCache::CachePixelMap(uint64_t uniqueId, std::shared_ptr<Media::PixelMap> pixelMap)
 {
     if (pixelMap && uniqueId > 0) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        pixelMapCache_.emplace(uniqueId, std::make_pair(pixelMap, 0));
+        auto& shard = GetShard(uniqueId);
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+        shard.pixelMapCache_.emplace(uniqueId, std::make_pair(pixelMap, 0));
     }
 }
 
 std::shared_ptr<Media::PixelMap> RSImageCache::GetPixelMapCache(uint64_t uniqueId) const
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = pixelMapCache_.find(uniqueId);
-    if (it != pixelMapCache_.end()) {
+    auto& shard = GetShard(uniqueId);
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    auto it = shard.pixelMapCache_.find(uniqueId);
+    if (it != shard.pixelMapCache_.end()) {
+        hitCount_.fetch_add(1, std::memory_order_relaxed);
         return it->second.first;
     }
+    missCount_.fetch_add(1, std::memory_order_relaxed);
     return nullptr;
 }
 
 void RSImageCache::IncreasePixelMapCacheRefCount(uint64_t uniqueId)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = pixelMapCache_.find(uniqueId);
-    if (it != pixelMapCache_.end()) {
-        it->second.second++;
+    auto& shard = GetShard(uniqueId);
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    auto it = shard.pixelMapCache_.find(uniqueId);
+    if (it != shard.pixelMapCache_.end()) {
+        if (it->second.second++ == 0) {
+            ForgetRetainedLocked(shard, uniqueId, true);
+        }
     }
 }
 
@@ -113,53 +164,198 @@ void RSImageCache::ReleaseUniqueIdList()
 
 void RSImageCache::ReleasePixelMapCache(uint64_t uniqueId)
 {
-    std::shared_ptr<Media::PixelMap> pixelMap = nullptr;
+    // the pixelMap and images are destructed after the lock is released
+    std::vector<std::shared_ptr<void>> released;
     {
         // release the pixelMap if no RSImage holds it
-        std::lock_guard<std::mutex> lock(mutex_);
-        auto it = pixelMapCache_.find(uniqueId);
-        if (it != pixelMapCache_.end()) {
+        auto& shard = GetShard(uniqueId);
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+        auto it = shard.pixelMapCache_.find(uniqueId);
+        bool retained = false;
+        if (it != shard.pixelMapCache_.end()) {
+            if (it->second.second == 0 && shard.retainedPixelMaps_.count(uniqueId) > 0) {
+                return;
+            }
             it->second.second--;
             if (it->second.first == nullptr || it->second.second == 0) {
-                pixelMap = it->second.first;
-                pixelMapCache_.erase(it);
-                ReleaseDrawingImageCacheByPixelMapId(uniqueId);
+                // a retained pixelMap keeps its uploaded images, so sending it again needs no new upload
+                retained = it->second.first != nullptr &&
+                    RetainLocked(shard, uniqueId, static_cast<size_t>(it->second.first->GetByteCount()), true);
+                if (!retained) {
+                    released.emplace_back(std::move(it->second.first));
+                    shard.pixelMapCache_.erase(it);
+                }
             }
         }
-    ReleaseDrawingImageCacheByPixelMapId(uniqueId);
+        if (!retained) {
+            ReleaseDrawingImageCacheByPixelMapIdLocked(shard, uniqueId, released);
+            return;
+        }
     }
-    pixelMap.reset();
+    EvictOverBudget();
 }
 
 void RSImageCache::CacheRenderDrawingImageByPixelMapId(uint64_t uniqueId,
     std::shared_ptr<Drawing::Image> img, pid_t tid)
 {
     if (uniqueId > 0 && img) {
-        std::lock_guard<std::mutex> lock(mapMutex_);
-        pixelMapIdRelatedDrawingImageCache_[uniqueId][tid] = img;
+        auto& shard = GetShard(uniqueId);
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+        shard.pixelMapIdRelatedDrawingImageCache_[uniqueId][tid] = img;
     }
 }
 
 std::shared_ptr<Drawing::Image> RSImageCache::GetRenderDrawingImageCacheByPixelMapId(uint64_t uniqueId, pid_t tid) const
 {
-    std::lock_guard<std::mutex> lock(mapMutex_);
-    auto it = pixelMapIdRelatedDrawingImageCache_.find(uniqueId);
-    if (it != pixelMapIdRelatedDrawingImageCache_.end()) {
+    auto& shard = GetShard(uniqueId);
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    auto it = shard.pixelMapIdRelatedDrawingImageCache_.find(uniqueId);
+    if (it != shard.pixelMapIdRelatedDrawingImageCache_.end()) {
         auto innerIt = it->second.find(tid);
         if (innerIt != it->second.end()) {
+            hitCount_.fetch_add(1, std::memory_order_relaxed);
             return innerIt->second;
         }
     }
+    missCount_.fetch_add(1, std::memory_order_relaxed);
     return nullptr;
 }
 
 void RSImageCache::ReleaseDrawingImageCacheByPixelMapId(uint64_t uniqueId)
 {
-    std::lock_guard<std::mutex> lock(mapMutex_);
-    auto it = pixelMapIdRelatedDrawingImageCache_.find(uniqueId);
-    if (it != pixelMapIdRelatedDrawingImageCache_.end()) {
-        pixelMapIdRelatedDrawingImageCache_.erase(it);
+    std::vector<std::shared_ptr<void>> released;
+    auto& shard = GetShard(uniqueId);
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    ReleaseDrawingImageCacheByPixelMapIdLocked(shard, uniqueId, released);
+}
+
+void RSImageCache::ReleaseDrawingImageCacheByPixelMapIdLocked(Shard& shard, uint64_t uniqueId,
+    std::vector<std::shared_ptr<void>>& released)
+{
+    auto it = shard.pixelMapIdRelatedDrawingImageCache_.find(uniqueId);
+    if (it != shard.pixelMapIdRelatedDrawingImageCache_.end()) {
+        for (auto& [tid, img] : it->second) {
+            released.emplace_back(std::move(img));
+        }
+        shard.pixelMapIdRelatedDrawingImageCache_.erase(it);
+    }
+}
+
+bool RSImageCache::RetainLocked(Shard& shard, uint64_t uniqueId, size_t size, bool isPixelMap)
+{
+    // any image fitting the whole budget is kept, older entries of other shards make room for it
+    if (size == 0 || size > retainedBudget_.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    if (isPixelMap) {
+        auto it = shard.pixelMapIdRelatedDrawingImageCache_.find(uniqueId);
+        if (it != shard.pixelMapIdRelatedDrawingImageCache_.end()) {
+            for (const auto& [tid, img] : it->second) {
+                size += GetImageSize(img);
+            }
+        }
+    }
+    shard.retainedList_.push_front(
+        { uniqueId, size, isPixelMap, releaseSequence_.fetch_add(1, std::memory_order_relaxed) });
+    auto& retainedMap = isPixelMap ? shard.retainedPixelMaps_ : shard.retainedDrawingImages_;
+    retainedMap[uniqueId] = shard.retainedList_.begin();
+    shard.retainedBytes_ += size;
+    retainedBytes_.fetch_add(size, std::memory_order_relaxed);
+    return true;
+}
+
+void RSImageCache::ForgetRetainedLocked(Shard& shard, uint64_t uniqueId, bool isPixelMap)
+{
+    auto& retainedMap = isPixelMap ? shard.retainedPixelMaps_ : shard.retainedDrawingImages_;
+    auto it = retainedMap.find(uniqueId);
+    if (it == retainedMap.end()) {
+        return;
+    }
+    shard.retainedBytes_ -= it->second->size;
+    retainedBytes_.fetch_sub(it->second->size, std::memory_order_relaxed);
+    shard.retainedList_.erase(it->second);
+    retainedMap.erase(it);
+}
+
+void RSImageCache::EvictOverBudget()
+{
+    while (retainedBytes_.load(std::memory_order_relaxed) > retainedBudget_.load(std::memory_order_relaxed)) {
+        // the oldest entry of each shard is at its back, the oldest of them is evicted
+        Shard* oldestShard = nullptr;
+        uint64_t oldestSequence = 0;
+        for (auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex_);
+            if (!shard.retainedList_.empty() &&
+                (oldestShard == nullptr || shard.retainedList_.back().sequence < oldestSequence)) {
+                oldestShard = &shard;
+                oldestSequence = shard.retainedList_.back().sequence;
+            }
+        }
+        if (oldestShard == nullptr) {
+            return;
+        }
+        // the evicted images are destructed after the lock is released
+        std::vector<std::shared_ptr<void>> evicted;
+        std::lock_guard<std::mutex> lock(oldestShard->mutex_);
+        EvictOldestLocked(*oldestShard, evicted);
+    }
+}
+
+void RSImageCache::EvictOldestLocked(Shard& shard, std::vector<std::shared_ptr<void>>& evicted)
+{
+    // the entry may have been referenced again since the shards were scanned
+    if (shard.retainedList_.empty()) {
+        return;
+    }
+    RetainedEntry entry = shard.retainedList_.back();
+    shard.retainedList_.pop_back();
+    shard.retainedBytes_ -= entry.size;
+    retainedBytes_.fetch_sub(entry.size, std::memory_order_relaxed);
+    if (entry.isPixelMap) {
+        shard.retainedPixelMaps_.erase(entry.uniqueId);
+        auto it = shard.pixelMapCache_.find(entry.uniqueId);
+        if (it != shard.pixelMapCache_.end()) {
+            evicted.emplace_back(std::move(it->second.first));
+            shard.pixelMapCache_.erase(it);
+        }
+        ReleaseDrawingImageCacheByPixelMapIdLocked(shard, entry.uniqueId, evicted);
+    } else {
+        shard.retainedDrawingImages_.erase(entry.uniqueId);
+        auto it = shard.drawingImageCache_.find(entry.uniqueId);
+        if (it != shard.drawingImageCache_.end()) {
+            evicted.emplace_back(std::move(it->second.first));
+            shard.drawingImageCache_.erase(it);
+        }
+    }
+    evictionCount_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RSImageCache::SetRetainedBudget(size_t budget)
+{
+    retainedBudget_.store(budget, std::memory_order_relaxed);
+    EvictOverBudget();
+}
+
+void RSImageCache::DumpStatistics(DfxString& log) const
+{
+    size_t drawingImageCount = 0;
+    size_t pixelMapCount = 0;
+    size_t retainedCount = 0;
+    size_t retainedBytes = 0;
+    for (const auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+        drawingImageCount += shard.drawingImageCache_.size();
+        pixelMapCount += shard.pixelMapCache_.size();
+        retainedCount += shard.retainedList_.size();
+        retainedBytes += shard.retainedBytes_;
     }
+    log.AppendFormat("RSImageCache: %zu images, %zu pixelmaps, retained %zu KB (%zu entries) of %zu KB\n",
+        drawingImageCount, pixelMapCount, retainedBytes / BYTE_CONVERT, retainedCount,
+        retainedBudget_.load(std::memory_order_relaxed) / BYTE_CONVERT);
+    log.AppendFormat("RSImageCache: hit %llu, miss %llu, eviction %llu\n",
+        static_cast<unsigned long long>(hitCount_.load(std::memory_order_relaxed)),
+        static_cast<unsigned long long>(missCount_.load(std::memory_order_relaxed)),
+        static_cast<unsigned long long>(evictionCount_.load(std::memory_order_relaxed)));
 }
 } // namespace Rosen
 } // namespace OHOS
@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include "platform/common/rs_log.h"
 #include "render/rs_particles_drawable.h"
 #include "render/rs_pixel_map_util.h"
@@ -25,7 +27,13 @@ constexpr float DEFAULT_RADIUS = 100;
 constexpr int MAX_ATLAS_COUNT = 2000;
 RSParticlesDrawable::RSParticlesDrawable(const std::vector<std::shared_ptr<RSRenderParticle>>& particles,
     std::vector<std::shared_ptr<RSImage>>& imageVector, size_t imageCount)
-    : particles_(particles), imageVector_(imageVector), imageCount_(imageCount)
+    : RSParticlesDrawable(particles, {}, imageVector, imageCount)
+{}
+
+RSParticlesDrawable::RSParticlesDrawable(const std::vector<std::shared_ptr<RSRenderParticle>>& particles,
+    const std::vector<std::shared_ptr<RSRenderParticleStore>>& particleStores,
+    std::vector<std::shared_ptr<RSImage>>& imageVector, size_t imageCount)
+    : particles_(particles), particleStores_(particleStores), imageVector_(imageVector), imageCount_(imageCount)
 {
     count_.resize(imageCount_);
     imageRsxform_.resize(imageCount_);
@@ -141,12 +149,16 @@ void RSParticlesDrawable::DrawImageFill(Drawing::Canvas& canvas, const std::shar
     if (particle == nullptr) {
         return;
     }
-    auto image = particle->GetImage();
+    DrawImageFill(canvas, particle->GetImage(), particle->GetImageSize(), particle->GetSpin(), position, opacity,
+        scale);
+}
+
+void RSParticlesDrawable::DrawImageFill(Drawing::Canvas& canvas, const std::shared_ptr<RSImage>& image,
+    const Vector2f& imageSize, float spin, Vector2f position, float opacity, float scale)
+{
     if (image == nullptr) {
         return;
     }
-    auto imageSize = particle->GetImageSize();
-    auto spin = particle->GetSpin();
     float left = position.x_;
     float top = position.y_;
     float right = position.x_ + imageSize.x_ * scale;
@@ -166,24 +178,166 @@ void RSParticlesDrawable::DrawImageFill(Drawing::Canvas& canvas, const std::shar
     canvas.Restore();
 }
 
+void RSParticlesDrawable::CaculatePointAtlsArry(
+    Drawing::Canvas& canvas, const RSRenderParticleStore& store, const RectF& bounds, size_t begin, size_t end)
+{
+    if (circleImage_ == nullptr) {
+        circleImage_ = MakeCircleImage(DEFAULT_RADIUS);
+    }
+    pointRsxform_.reserve(pointRsxform_.size() + end - begin);
+    pointTex_.reserve(pointTex_.size() + end - begin);
+    pointColors_.reserve(pointColors_.size() + end - begin);
+    const float* positionX = store.GetPositionX().data();
+    const float* positionY = store.GetPositionY().data();
+    const float* opacity = store.GetOpacity().data();
+    const float* scale = store.GetScale().data();
+    const int16_t* red = store.GetRed().data();
+    const int16_t* green = store.GetGreen().data();
+    const int16_t* blue = store.GetBlue().data();
+    const int16_t* alpha = store.GetAlpha().data();
+    float radius = store.GetRadius();
+    for (size_t i = begin; i < end; i++) {
+        if (!store.IsAlive(i) || opacity[i] <= 0.f || scale[i] <= 0.f ||
+            !bounds.Intersect(positionX[i], positionY[i])) {
+            continue;
+        }
+        ClipBounds(canvas, bounds);
+        // points do not spin, so the transform only scales the circle around its center
+        float pointScale = radius * scale[i] / DEFAULT_RADIUS;
+        pointRsxform_.push_back(Drawing::RSXform::Make(pointScale, 0.f, positionX[i] - pointScale * DEFAULT_RADIUS,
+            positionY[i] - pointScale * DEFAULT_RADIUS));
+        pointTex_.push_back(Drawing::Rect(0, 0, DEFAULT_RADIUS * DOUBLE, DEFAULT_RADIUS * DOUBLE));
+        Color color(red[i], green[i], blue[i], static_cast<int16_t>(alpha[i] * opacity[i]));
+        pointColors_.push_back(Drawing::Color(color.AsArgbInt()).CastToColorQuad());
+        pointCount_++;
+    }
+}
+
+void RSParticlesDrawable::CaculateImageAtlsArry(
+    Drawing::Canvas& canvas, const RSRenderParticleStore& store, const RectF& bounds, size_t begin, size_t end)
+{
+    auto& particleParams = store.GetParticleRenderParams();
+    if (particleParams == nullptr) {
+        return;
+    }
+    auto& image = particleParams->GetParticleImage();
+    if (image == nullptr) {
+        return;
+    }
+    auto pixelmap = image->GetPixelMap();
+    if (pixelmap == nullptr) {
+        return;
+    }
+    auto imageIndex = particleParams->GetImageIndex();
+    if (imageIndex >= imageCount_) {
+        return;
+    }
+    const auto& imageSize = particleParams->GetImageSize();
+    bool fill = image->GetImageFit() == ImageFit::FILL;
+    float fitScale = 0.f;
+    if (!fill) {
+        // the fitted size only depends on the image and particle sizes, so it is the same for all particles
+        image->SetFrameRect(RectF(0.f, 0.f, imageSize.x_, imageSize.y_));
+        image->ApplyImageFit();
+        fitScale = image->GetDstRect().GetWidth() / pixelmap->GetWidth();
+    }
+    Vector2f center(pixelmap->GetWidth() / DOUBLE, pixelmap->GetHeight() / DOUBLE);
+    const float* positionX = store.GetPositionX().data();
+    const float* positionY = store.GetPositionY().data();
+    const float* opacity = store.GetOpacity().data();
+    const float* scale = store.GetScale().data();
+    const float* spin = store.GetSpin().data();
+    for (size_t i = begin; i < end; i++) {
+        if (!store.IsAlive(i) || opacity[i] <= 0.f || scale[i] <= 0.f ||
+            !bounds.Intersect(positionX[i], positionY[i])) {
+            continue;
+        }
+        ClipBounds(canvas, bounds);
+        Vector2f position(positionX[i], positionY[i]);
+        if (fill) {
+            DrawImageFill(canvas, image, imageSize, spin[i], position, opacity[i], scale[i]);
+            continue;
+        }
+        Color color(store.GetRed()[i], store.GetGreen()[i], store.GetBlue()[i],
+            static_cast<int16_t>(store.GetAlpha()[i] * opacity[i]));
+        imageRsxform_[imageIndex].push_back(MakeRSXform(center, position, spin[i], fitScale * scale[i]));
+        imageTex_[imageIndex].push_back(Drawing::Rect(0, 0, pixelmap->GetWidth(), pixelmap->GetHeight()));
+        imageColors_[imageIndex].push_back(Drawing::Color(color.AsArgbInt()).CastToColorQuad());
+        count_[imageIndex]++;
+    }
+}
+
+void RSParticlesDrawable::CaculateStoreAtlsArry(Drawing::Canvas& canvas, const RectF& bounds)
+{
+    // every store is sorted by emission order, so they are merged run by run: the store holding the earliest
+    // particle left is drawn up to the first particle emitted after the next particle of any other store
+    std::vector<size_t> cursors(particleStores_.size(), 0);
+    while (true) {
+        size_t next = particleStores_.size();
+        uint64_t nextOrder = UINT64_MAX;
+        uint64_t limit = UINT64_MAX;
+        for (size_t i = 0; i < particleStores_.size(); i++) {
+            const auto& store = particleStores_[i];
+            if (store == nullptr || cursors[i] >= store->GetSize()) {
+                continue;
+            }
+            uint64_t order = store->GetEmitOrder()[cursors[i]];
+            if (next == particleStores_.size() || order < nextOrder) {
+                limit = std::min(limit, nextOrder);
+                next = i;
+                nextOrder = order;
+            } else {
+                limit = std::min(limit, order);
+            }
+        }
+        if (next == particleStores_.size()) {
+            return;
+        }
+        const auto& store = *particleStores_[next];
+        const auto& emitOrder = store.GetEmitOrder();
+        size_t begin = cursors[next];
+        size_t end = static_cast<size_t>(
+            std::upper_bound(emitOrder.begin() + begin, emitOrder.end(), limit) - emitOrder.begin());
+        if (store.GetParticleType() == ParticleType::POINTS) {
+            CaculatePointAtlsArry(canvas, store, bounds, begin, end);
+        } else {
+            CaculateImageAtlsArry(canvas, store, bounds, begin, end);
+        }
+        cursors[next] = end;
+    }
+}
+
+void RSParticlesDrawable::ClipBounds(Drawing::Canvas& canvas, const RectF& bounds)
+{
+    // the same clip for every particle, so it is recorded once
+    if (clipped_) {
+        return;
+    }
+    auto clipBounds =
+        Drawing::Rect(bounds.left_, bounds.top_, bounds.left_ + bounds.width_, bounds.top_ + bounds.height_);
+    canvas.ClipRect(clipBounds, Drawing::ClipOp::INTERSECT, true);
+    clipped_ = true;
+}
+
 void RSParticlesDrawable::Draw(Drawing::Canvas& canvas, std::shared_ptr<RectF> bounds)
 {
-    if (particles_.empty()) {
+    if (particles_.empty() && particleStores_.empty()) {
         ROSEN_LOGE("RSParticlesDrawable::Draw particles_ is empty");
         return;
     }
+    if (bounds == nullptr) {
+        return;
+    }
     for (const auto& particle : particles_) {
         if (particle != nullptr && particle->IsAlive()) {
             auto position = particle->GetPosition();
             float opacity = particle->GetOpacity();
             float scale = particle->GetScale();
-            if (bounds == nullptr || !(bounds->Intersect(position.x_, position.y_)) || opacity <= 0.f || scale <= 0.f) {
+            if (!(bounds->Intersect(position.x_, position.y_)) || opacity <= 0.f || scale <= 0.f) {
                 continue;
             }
             auto particleType = particle->GetParticleType();
-            auto clipBounds = Drawing::Rect(
-                bounds->left_, bounds->top_, bounds->left_ + bounds->width_, bounds->top_ + bounds->height_);
-            canvas.ClipRect(clipBounds, Drawing::ClipOp::INTERSECT, true);
+            ClipBounds(canvas, *bounds);
             if (particleType == ParticleType::POINTS) {
                 CaculatePointAtlsArry(particle, position, opacity, scale);
             } else {
@@ -191,6 +345,7 @@ void RSParticlesDrawable::Draw(Drawing::Canvas& canvas, std::shared_ptr<RectF> b
             }
         }
     }
+    CaculateStoreAtlsArry(canvas, *bounds);
     DrawParticles(canvas);
 }
 
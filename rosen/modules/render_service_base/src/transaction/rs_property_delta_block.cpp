@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "transaction/rs_property_delta_block.h"
+
+#include <type_traits>
+
+#include "platform/common/rs_log.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+template<typename T>
+bool WriteArray(Parcel& parcel, const std::vector<T>& array)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "only plain arrays are written as bytes");
+    return parcel.WriteBuffer(array.data(), array.size() * sizeof(T));
+}
+
+template<typename T>
+bool ReadArray(Parcel& parcel, std::vector<T>& array, size_t count)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "only plain arrays are read as bytes");
+    size_t size = count * sizeof(T);
+    const uint8_t* data = parcel.ReadBuffer(size);
+    if (data == nullptr) {
+        return false;
+    }
+    array.resize(count);
+    if (memcpy_s(array.data(), size, data, size) != EOK) {
+        return false;
+    }
+    return true;
+}
+
+// Values are written as their components. Vector2 has a virtual destructor, so copying its bytes would carry the
+// vtable pointer of the client into the render service.
+template<typename T>
+struct ValueCodec;
+
+template<>
+struct ValueCodec<float> {
+    using Component = float;
+    static constexpr size_t COUNT = 1;
+    static void Encode(const float& value, Component* out)
+    {
+        out[0] = value;
+    }
+    static float Decode(const Component* in)
+    {
+        return in[0];
+    }
+};
+
+template<>
+struct ValueCodec<Vector2f> {
+    using Component = float;
+    static constexpr size_t COUNT = 2;
+    static void Encode(const Vector2f& value, Component* out)
+    {
+        out[0] = value.x_;
+        out[1] = value.y_;
+    }
+    static Vector2f Decode(const Component* in)
+    {
+        return Vector2f(in[0], in[1]);
+    }
+};
+
+template<>
+struct ValueCodec<Vector4f> {
+    using Component = float;
+    static constexpr size_t COUNT = 4;
+    static void Encode(const Vector4f& value, Component* out)
+    {
+        for (size_t i = 0; i < COUNT; i++) {
+            out[i] = value.data_[i];
+        }
+    }
+    static Vector4f Decode(const Component* in)
+    {
+        return Vector4f(in);
+    }
+};
+
+template<>
+struct ValueCodec<Color> {
+    // the channels are kept as int16_t, animations may move them out of [0, 255]
+    using Component = int16_t;
+    static constexpr size_t COUNT = 4;
+    static void Encode(const Color& value, Component* out)
+    {
+        out[0] = value.GetRed();
+        out[1] = value.GetGreen();
+        out[2] = value.GetBlue();
+        out[3] = value.GetAlpha();
+    }
+    static Color Decode(const Component* in)
+    {
+        return Color(in[0], in[1], in[2], in[3]);
+    }
+};
+
+template<typename T>
+bool WriteValues(Parcel& parcel, const std::vector<T>& values)
+{
+    using Codec = ValueCodec<T>;
+    std::vector<typename Codec::Component> components(values.size() * Codec::COUNT);
+    for (size_t i = 0; i < values.size(); i++) {
+        Codec::Encode(values[i], &components[i * Codec::COUNT]);
+    }
+    return WriteArray(parcel, components);
+}
+
+template<typename T>
+bool ReadValues(Parcel& parcel, std::vector<T>& values, uint32_t count)
+{
+    using Codec = ValueCodec<T>;
+    std::vector<typename Codec::Component> components;
+    if (!ReadArray(parcel, components, static_cast<size_t>(count) * Codec::COUNT)) {
+        return false;
+    }
+    values.clear();
+    values.reserve(count);
+    for (uint32_t i = 0; i < count; i++) {
+        values.push_back(Codec::Decode(&components[i * Codec::COUNT]));
+    }
+    return true;
+}
+
+template<typename T>
+bool MarshallingColumn(Parcel& parcel, const RSPropertyDeltaBlock::Column<T>& column)
+{
+    uint32_t count = static_cast<uint32_t>(column.Size());
+    if (!parcel.WriteUint32(count)) {
+        return false;
+    }
+    if (count == 0) {
+        return true;
+    }
+    return WriteArray(parcel, column.ids) && WriteArray(parcel, column.types) && WriteValues(parcel, column.values);
+}
+
+template<typename T>
+bool UnmarshallingColumn(Parcel& parcel, RSPropertyDeltaBlock::Column<T>& column)
+{
+    uint32_t count = 0;
+    if (!parcel.ReadUint32(count)) {
+        return false;
+    }
+    if (count == 0) {
+        return true;
+    }
+    constexpr size_t entrySize = sizeof(PropertyId) + sizeof(PropertyUpdateType) +
+        sizeof(typename ValueCodec<T>::Component) * ValueCodec<T>::COUNT;
+    if (count > parcel.GetReadableBytes() / entrySize) {
+        ROSEN_LOGE("RSPropertyDeltaBlock::Unmarshalling invalid count %{public}u", count);
+        return false;
+    }
+    return ReadArray(parcel, column.ids, count) && ReadArray(parcel, column.types, count) &&
+           ReadValues(parcel, column.values, count);
+}
+
+#ifdef RS_PROFILER_ENABLED
+template<typename T>
+void PatchColumn(RSPropertyDeltaBlock::Column<T>& column, RSPropertyDeltaBlock::PatchFunction function)
+{
+    for (auto& id : column.ids) {
+        id = function(id);
+    }
+}
+#endif
+} // namespace
+
+size_t RSPropertyDeltaBlock::GetSize() const
+{
+    return floatColumn_.Size() + vector2fColumn_.Size() + vector4fColumn_.Size() + colorColumn_.Size();
+}
+
+bool RSPropertyDeltaBlock::Marshalling(Parcel& parcel) const
+{
+    return MarshallingColumn(parcel, floatColumn_) && MarshallingColumn(parcel, vector2fColumn_) &&
+           MarshallingColumn(parcel, vector4fColumn_) && MarshallingColumn(parcel, colorColumn_);
+}
+
+bool RSPropertyDeltaBlock::Unmarshalling(Parcel& parcel)
+{
+    return UnmarshallingColumn(parcel, floatColumn_) && UnmarshallingColumn(parcel, vector2fColumn_) &&
+           UnmarshallingColumn(parcel, vector4fColumn_) && UnmarshallingColumn(parcel, colorColumn_);
+}
+
+#ifdef RS_PROFILER_ENABLED
+void RSPropertyDeltaBlock::Patch(PatchFunction function)
+{
+    PatchColumn(floatColumn_, function);
+    PatchColumn(vector2fColumn_, function);
+    PatchColumn(vector4fColumn_, function);
+    PatchColumn(colorColumn_, function);
+}
+#endif
+} // namespace Rosen
+} // namespace OHOS
@@ -18,6 +18,7 @@
 #include "command/rs_canvas_node_command.h"
 #include "command/rs_command.h"
 #include "command/rs_command_factory.h"
+#include "command/rs_node_command.h"
 #include "platform/common/rs_log.h"
 #include "platform/common/rs_system_properties.h"
 #include "rs_profiler.h"
@@ -27,6 +28,54 @@ namespace Rosen {
 namespace {
 static constexpr size_t PARCEL_MAX_CPACITY = 2000 * 1024; // upper bound of parcel capacity
 static constexpr size_t PARCEL_SPLIT_THRESHOLD = 1800 * 1024; // should be < PARCEL_MAX_CPACITY
+
+template<typename T>
+void AddToDeltaBlock(RSPropertyDeltaBlock& block, RSCommand& command)
+{
+    const auto& [nodeId, value, id, type] = static_cast<T&>(command).GetParams();
+    block.Add(id, value, type);
+}
+
+bool IsDeltaBlockCommand(const RSCommand& command)
+{
+    return command.GetType() == RSCommandType::RS_NODE &&
+           command.GetSubType() == RSNodeCommandType::UPDATE_MODIFIER_DELTA_BLOCK;
+}
+
+bool AddToDeltaBlock(RSPropertyDeltaBlock& block, RSCommand& command)
+{
+    if (command.GetType() != RSCommandType::RS_NODE) {
+        return false;
+    }
+    switch (command.GetSubType()) {
+        case RSNodeCommandType::UPDATE_MODIFIER_FLOAT:
+            AddToDeltaBlock<RSUpdatePropertyFloat>(block, command);
+            return true;
+        case RSNodeCommandType::UPDATE_MODIFIER_VECTOR2F:
+            AddToDeltaBlock<RSUpdatePropertyVector2f>(block, command);
+            return true;
+        case RSNodeCommandType::UPDATE_MODIFIER_VECTOR4F:
+            AddToDeltaBlock<RSUpdatePropertyVector4f>(block, command);
+            return true;
+        case RSNodeCommandType::UPDATE_MODIFIER_COLOR:
+            AddToDeltaBlock<RSUpdatePropertyColor>(block, command);
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool IsMergeableUpdate(const RSCommand& command)
+{
+    if (command.GetType() != RSCommandType::RS_NODE) {
+        return false;
+    }
+    auto subType = command.GetSubType();
+    return subType == RSNodeCommandType::UPDATE_MODIFIER_FLOAT ||
+           subType == RSNodeCommandType::UPDATE_MODIFIER_VECTOR2F ||
+           subType == RSNodeCommandType::UPDATE_MODIFIER_VECTOR4F ||
+           subType == RSNodeCommandType::UPDATE_MODIFIER_COLOR;
+}
 }
 
 std::function<void(uint64_t, int, int)> RSTransactionData::alarmLogFunc = [](uint64_t nodeId, int count, int num) {
@@ -172,7 +221,7 @@ void RSTransactionData::Clear()
 void RSTransactionData::AddCommand(std::unique_ptr<RSCommand>& command, NodeId nodeId, FollowType followType)
 {
     std::unique_lock<std::mutex> lock(commandMutex_);
-    if (command) {
+    if (command && !MergePropertyUpdate(command, nodeId, followType)) {
         payload_.emplace_back(nodeId, followType, std::move(command));
     }
 }
@@ -180,11 +229,42 @@ void RSTransactionData::AddCommand(std::unique_ptr<RSCommand>& command, NodeId n
 void RSTransactionData::AddCommand(std::unique_ptr<RSCommand>&& command, NodeId nodeId, FollowType followType)
 {
     std::unique_lock<std::mutex> lock(commandMutex_);
-    if (command) {
+    if (command && !MergePropertyUpdate(command, nodeId, followType)) {
         payload_.emplace_back(nodeId, followType, std::move(command));
     }
 }
 
+bool RSTransactionData::MergePropertyUpdate(std::unique_ptr<RSCommand>& command, NodeId nodeId,
+    FollowType followType)
+{
+    // only the last command is merged, so the order of commands is kept
+    if (payload_.empty() || !IsMergeableUpdate(*command)) {
+        return false;
+    }
+    auto& [lastNodeId, lastFollowType, lastCommand] = payload_.back();
+    if (lastCommand == nullptr || lastNodeId != nodeId || lastFollowType != followType ||
+        lastCommand->GetNodeId() != command->GetNodeId()) {
+        return false;
+    }
+    if (IsDeltaBlockCommand(*lastCommand)) {
+        auto& [blockNodeId, block] = static_cast<RSUpdatePropertyDeltaBlock&>(*lastCommand).GetParams();
+        if (!AddToDeltaBlock(block, *command)) {
+            return false;
+        }
+        command.reset();
+        return true;
+    }
+    if (!IsMergeableUpdate(*lastCommand)) {
+        return false;
+    }
+    RSPropertyDeltaBlock block;
+    AddToDeltaBlock(block, *lastCommand);
+    AddToDeltaBlock(block, *command);
+    lastCommand = std::make_unique<RSUpdatePropertyDeltaBlock>(command->GetNodeId(), block);
+    command.reset();
+    return true;
+}
+
 bool RSTransactionData::UnmarshallingCommand(Parcel& parcel)
 {
     Clear();
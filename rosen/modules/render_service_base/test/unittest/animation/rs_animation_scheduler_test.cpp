@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "animation/rs_animation_scheduler.h"
+#include "animation/rs_cubic_bezier_interpolator.h"
+#include "animation/rs_render_curve_animation.h"
+#include "animation/rs_render_interpolating_spring_animation.h"
+#include "animation/rs_steps_interpolator.h"
+#include "modifier/rs_render_property.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+class RSAnimationSchedulerTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+    static constexpr uint64_t ANIMATION_ID = 12345;
+    static constexpr uint64_t PROPERTY_ID = 54321;
+    static constexpr int64_t START_TIME = 1000000000;
+    static constexpr int64_t FRAME_TIME = 16666667;
+
+    static std::shared_ptr<RSRenderAnimatableProperty<float>> CreateProperty(float value);
+    static std::shared_ptr<RSRenderCurveAnimation> CreateCurveAnimation(
+        const std::shared_ptr<RSRenderAnimatableProperty<float>>& property, AnimationId id);
+};
+
+void RSAnimationSchedulerTest::SetUpTestCase() {}
+void RSAnimationSchedulerTest::TearDownTestCase() {}
+void RSAnimationSchedulerTest::SetUp() {}
+void RSAnimationSchedulerTest::TearDown() {}
+
+std::shared_ptr<RSRenderAnimatableProperty<float>> RSAnimationSchedulerTest::CreateProperty(float value)
+{
+    return std::make_shared<RSRenderAnimatableProperty<float>>(
+        value, PROPERTY_ID, RSRenderPropertyType::PROPERTY_FLOAT);
+}
+
+std::shared_ptr<RSRenderCurveAnimation> RSAnimationSchedulerTest::CreateCurveAnimation(
+    const std::shared_ptr<RSRenderAnimatableProperty<float>>& property, AnimationId id)
+{
+    auto animation = std::make_shared<RSRenderCurveAnimation>(
+        id, PROPERTY_ID, CreateProperty(0.0f), CreateProperty(0.0f), CreateProperty(100.0f));
+    animation->SetDuration(1000); // 1000 is duration in ms
+    animation->SetInterpolator(std::make_shared<RSCubicBezierInterpolator>(0.42f, 0.0f, 0.58f, 1.0f));
+    animation->AttachRenderProperty(property);
+    animation->Start();
+    return animation;
+}
+
+/**
+ * @tc.name: Evaluate001
+ * @tc.desc: Verify that the scheduler evaluates the same values as the interpolators and spring models
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSAnimationSchedulerTest, Evaluate001, TestSize.Level1)
+{
+    RSCubicBezierInterpolator cubicBezier(0.25f, 0.1f, 0.25f, 1.0f);
+    LinearInterpolator linear;
+    RSStepsInterpolator steps(4); // 4 is step count
+    RSSpringModel<float> spring(0.5f, 0.8f, -1.0f, 0.0f, 0.00025f);
+
+    constexpr int count = 20;
+    std::vector<float> outputs(count * 4);
+    RSAnimationScheduler scheduler;
+    for (int i = 0; i < count; i++) {
+        float input = static_cast<float>(i) / count;
+        scheduler.AddSpring(spring, input, outputs[i * 4]);
+        scheduler.AddInterpolation(linear, input, outputs[i * 4 + 1]);
+        scheduler.AddInterpolation(cubicBezier, input, outputs[i * 4 + 2]);
+        scheduler.AddInterpolation(steps, input, outputs[i * 4 + 3]);
+    }
+    ASSERT_EQ(scheduler.GetJobCount(), outputs.size());
+    // evaluate in uneven ranges, which cross the arrays of different interpolator types
+    scheduler.Evaluate(0, 7u);
+    scheduler.Evaluate(7u, 45u);
+    scheduler.Evaluate(45u, outputs.size() + 10u);
+    for (int i = 0; i < count; i++) {
+        float input = static_cast<float>(i) / count;
+        EXPECT_EQ(outputs[i * 4], 1.0f + spring.CalculateDisplacement(input));
+        EXPECT_EQ(outputs[i * 4 + 1], linear.Interpolate(input));
+        EXPECT_EQ(outputs[i * 4 + 2], cubicBezier.Interpolate(input));
+        EXPECT_EQ(outputs[i * 4 + 3], steps.Interpolate(input));
+    }
+
+    scheduler.Clear();
+    EXPECT_EQ(scheduler.GetJobCount(), 0u);
+}
+
+/**
+ * @tc.name: PrepareAnimate001
+ * @tc.desc: Verify that a prepared curve animation produces the same values as Animate alone
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSAnimationSchedulerTest, PrepareAnimate001, TestSize.Level1)
+{
+    auto property = CreateProperty(0.0f);
+    auto preparedProperty = CreateProperty(0.0f);
+    auto animation = CreateCurveAnimation(property, ANIMATION_ID);
+    auto preparedAnimation = CreateCurveAnimation(preparedProperty, ANIMATION_ID + 1);
+
+    RSAnimationScheduler scheduler;
+    for (int frame = 0; frame < 70; frame++) { // 70 frames run past the end of the animation
+        int64_t time = START_TIME + frame * FRAME_TIME;
+        preparedAnimation->PrepareAnimate(time, scheduler);
+        scheduler.Evaluate();
+        bool isFinished = animation->Animate(time);
+        EXPECT_EQ(preparedAnimation->Animate(time), isFinished);
+        scheduler.Clear();
+        EXPECT_EQ(preparedProperty->Get(), property->Get());
+        EXPECT_EQ(preparedAnimation->GetValueFraction(), animation->GetValueFraction());
+        EXPECT_EQ(preparedAnimation->IsFinished(), animation->IsFinished());
+    }
+    EXPECT_TRUE(preparedAnimation->IsFinished());
+}
+
+/**
+ * @tc.name: PrepareAnimate002
+ * @tc.desc: Verify that a prepared interpolating spring animation produces the same values as Animate alone
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSAnimationSchedulerTest, PrepareAnimate002, TestSize.Level1)
+{
+    auto createAnimation = [](const std::shared_ptr<RSRenderAnimatableProperty<float>>& property, AnimationId id) {
+        auto animation = std::make_shared<RSRenderInterpolatingSpringAnimation>(
+            id, PROPERTY_ID, CreateProperty(0.0f), CreateProperty(0.0f), CreateProperty(100.0f));
+        animation->SetSpringParameters(0.5f, 0.8f, 0.0f);
+        animation->AttachRenderProperty(property);
+        animation->Start();
+        return animation;
+    };
+    auto property = CreateProperty(0.0f);
+    auto preparedProperty = CreateProperty(0.0f);
+    auto animation = createAnimation(property, ANIMATION_ID);
+    auto preparedAnimation = createAnimation(preparedProperty, ANIMATION_ID + 1);
+
+    RSAnimationScheduler scheduler;
+    for (int frame = 0; frame < 20; frame++) { // 20 is frame count
+        int64_t time = START_TIME + frame * FRAME_TIME;
+        preparedAnimation->PrepareAnimate(time, scheduler);
+        scheduler.Evaluate();
+        EXPECT_EQ(preparedAnimation->Animate(time), animation->Animate(time));
+        scheduler.Clear();
+        EXPECT_EQ(preparedProperty->Get(), property->Get());
+    }
+
+    // an animation which is not animated at the prepared time animates as usual
+    int64_t time = START_TIME + 20 * FRAME_TIME; // 20 is frame count
+    preparedAnimation->PrepareAnimate(time, scheduler);
+    scheduler.Evaluate();
+    scheduler.Clear();
+    time += FRAME_TIME;
+    animation->Animate(time);
+    preparedAnimation->Animate(time);
+    EXPECT_EQ(preparedProperty->Get(), property->Get());
+}
+
+/**
+ * @tc.name: PrepareAnimate003
+ * @tc.desc: Verify that the prepare pass writes no property in the start delay, the fill is applied by Animate
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSAnimationSchedulerTest, PrepareAnimate003, TestSize.Level1)
+{
+    auto property = CreateProperty(50.0f);
+    auto animation = std::make_shared<RSRenderCurveAnimation>(
+        ANIMATION_ID, PROPERTY_ID, CreateProperty(0.0f), CreateProperty(0.0f), CreateProperty(100.0f));
+    animation->SetDuration(1000); // 1000 is duration in ms
+    animation->SetStartDelay(100); // 100 is start delay in ms
+    animation->SetFillMode(FillMode::BACKWARDS);
+    animation->AttachRenderProperty(property);
+    animation->Start();
+
+    RSAnimationScheduler scheduler;
+    // the first frame only sets the start time
+    animation->PrepareAnimate(START_TIME, scheduler);
+    EXPECT_FALSE(animation->Animate(START_TIME));
+    EXPECT_EQ(property->Get(), 50.0f);
+
+    int64_t time = START_TIME + FRAME_TIME;
+    animation->PrepareAnimate(time, scheduler);
+    scheduler.Evaluate();
+    EXPECT_EQ(scheduler.GetJobCount(), 0u);
+    EXPECT_EQ(property->Get(), 50.0f);
+    EXPECT_FALSE(animation->Animate(time));
+    EXPECT_EQ(property->Get(), 0.0f);
+}
+} // namespace Rosen
+} // namespace OHOS
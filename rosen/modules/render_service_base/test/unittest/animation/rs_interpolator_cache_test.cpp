@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "animation/rs_cubic_bezier_interpolator.h"
+#include "animation/rs_interpolator_cache.h"
+#include "animation/rs_render_interpolating_spring_animation.h"
+#include "animation/rs_spring_interpolator.h"
+#include "modifier/rs_render_property.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+class RSInterpolatorCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+    static constexpr int SAMPLE_COUNT = 10000;
+    // the binary search of the analytic cubic bezier path stops at a resolution of 1 / 4000
+    static constexpr float ANALYTIC_CUBIC_BEZIER_ERROR = 1.2e-3f;
+};
+
+void RSInterpolatorCacheTest::SetUpTestCase() {}
+void RSInterpolatorCacheTest::TearDownTestCase() {}
+void RSInterpolatorCacheTest::SetUp() {}
+void RSInterpolatorCacheTest::TearDown() {}
+
+namespace {
+struct CubicBezierParams {
+    float x1;
+    float y1;
+    float x2;
+    float y2;
+};
+
+// ease, ease in, ease out, ease in out, fast out slow in, sharp, friction, extreme and overshoot
+const std::vector<CubicBezierParams> CUBIC_BEZIER_PRESETS = {
+    { 0.25f, 0.1f, 0.25f, 1.0f }, { 0.42f, 0.0f, 1.0f, 1.0f }, { 0.0f, 0.0f, 0.58f, 1.0f },
+    { 0.42f, 0.0f, 0.58f, 1.0f }, { 0.4f, 0.0f, 0.2f, 1.0f }, { 0.33f, 0.0f, 0.67f, 1.0f },
+    { 0.2f, 0.0f, 0.2f, 1.0f }, { 0.9f, 0.0f, 0.1f, 1.0f }, { 0.3f, 1.5f, 0.6f, -0.5f },
+};
+} // namespace
+
+/**
+ * @tc.name: CubicBezierAccuracy001
+ * @tc.desc: Verify that the cubic bezier tables stay within their error bound of the curve
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSInterpolatorCacheTest, CubicBezierAccuracy001, TestSize.Level1)
+{
+    for (const auto& params : CUBIC_BEZIER_PRESETS) {
+        RSCubicBezierInterpolator interpolator(params.x1, params.y1, params.x2, params.y2);
+        RSCubicBezierInterpolator analytic(params.x1, params.y1, params.x2, params.y2);
+        analytic.table_ = nullptr;
+        ASSERT_NE(interpolator.table_, nullptr);
+        ASSERT_TRUE(interpolator.table_->IsSampled());
+        for (int i = 0; i <= SAMPLE_COUNT; i++) {
+            float input = static_cast<float>(i) / SAMPLE_COUNT;
+            float value = interpolator.InterpolateImpl(input);
+            EXPECT_NEAR(value, interpolator.CalculatePreciseValue(input), RSInterpolatorTable::MAX_ERROR);
+            EXPECT_NEAR(value, analytic.InterpolateImpl(input),
+                RSInterpolatorTable::MAX_ERROR + ANALYTIC_CUBIC_BEZIER_ERROR);
+        }
+        EXPECT_EQ(interpolator.InterpolateImpl(0.0f), 0.0f);
+        EXPECT_EQ(interpolator.InterpolateImpl(1.0f), 1.0f);
+        EXPECT_EQ(interpolator.InterpolateImpl(-1.0f), 0.0f);
+        EXPECT_EQ(interpolator.InterpolateImpl(2.0f), 1.0f);
+    }
+}
+
+/**
+ * @tc.name: SpringAccuracy001
+ * @tc.desc: Verify that the spring interpolator tables stay within their error bound of the spring model, and that
+ *           springs which can not be sampled within it are evaluated directly
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSInterpolatorCacheTest, SpringAccuracy001, TestSize.Level1)
+{
+    // response, damping ratio and initial velocity
+    const std::vector<std::vector<float>> springs = {
+        { 0.55f, 0.825f, 0.0f }, { 0.3f, 0.9f, 0.0f }, { 0.5f, 0.7f, 5.0f }, { 0.35f, 1.0f, 0.0f },
+        { 0.4f, 1.5f, 0.0f },
+    };
+    for (const auto& spring : springs) {
+        RSSpringInterpolator interpolator(spring[0], spring[1], spring[2]);
+        ASSERT_TRUE(interpolator.table_->IsSampled());
+        EXPECT_EQ(interpolator.estimatedDuration_, interpolator.EstimateDuration());
+        for (int i = 0; i <= SAMPLE_COUNT; i++) {
+            float input = static_cast<float>(i) / SAMPLE_COUNT;
+            EXPECT_NEAR(interpolator.InterpolateImpl(input), interpolator.CalculateValue(input),
+                RSInterpolatorTable::MAX_ERROR);
+        }
+    }
+
+    RSSpringInterpolator bouncy(1.0f, 0.1f, 0.0f); // 1.0 is response, 0.1 is damping ratio
+    EXPECT_FALSE(bouncy.table_->IsSampled());
+    EXPECT_EQ(bouncy.InterpolateImpl(0.3f), bouncy.CalculateValue(0.3f));
+}
+
+/**
+ * @tc.name: InterpolatingSpringAccuracy001
+ * @tc.desc: Verify that interpolating spring animations keep the estimated duration and sample within the bound
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSInterpolatorCacheTest, InterpolatingSpringAccuracy001, TestSize.Level1)
+{
+    constexpr uint64_t animationId = 12345;
+    constexpr uint64_t propertyId = 54321;
+    auto createProperty = [](float value) {
+        return std::make_shared<RSRenderAnimatableProperty<float>>(
+            value, propertyId, RSRenderPropertyType::PROPERTY_FLOAT);
+    };
+    auto animation = std::make_shared<RSRenderInterpolatingSpringAnimation>(
+        animationId, propertyId, createProperty(0.0f), createProperty(0.0f), createProperty(1.0f));
+    animation->SetSpringParameters(0.5f, 0.8f, 0.0f);
+    animation->OnInitialize(0);
+    ASSERT_NE(animation->springTable_, nullptr);
+    EXPECT_EQ(animation->GetDuration(), std::lroundf(animation->EstimateDuration() * 1000)); // 1000 ms per second
+    EXPECT_TRUE(animation->IsSpringTableValid());
+    for (int i = 0; i <= SAMPLE_COUNT; i++) {
+        float fraction = static_cast<float>(i) / SAMPLE_COUNT;
+        float mappedTime = fraction * animation->GetDuration() / 1000; // 1000 ms per second
+        EXPECT_NEAR(animation->springTable_->Sample(fraction), 1.0f + animation->CalculateDisplacement(mappedTime),
+            RSInterpolatorTable::MAX_ERROR);
+    }
+
+    // the table no longer matches once the duration is changed
+    animation->SetDuration(animation->GetDuration() + 1);
+    EXPECT_FALSE(animation->IsSpringTableValid());
+}
+
+/**
+ * @tc.name: GetTable001
+ * @tc.desc: Verify that interpolators with the same curve share one table and the cache stays within its capacity
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSInterpolatorCacheTest, GetTable001, TestSize.Level1)
+{
+    auto& cache = RSInterpolatorCache::Instance();
+    cache.Clear();
+    RSCubicBezierInterpolator first(0.2f, 0.0f, 0.2f, 1.0f);
+    RSCubicBezierInterpolator second(0.2f, 0.0f, 0.2f, 1.0f);
+    RSCubicBezierInterpolator other(0.3f, 0.0f, 0.2f, 1.0f);
+    EXPECT_EQ(first.table_, second.table_);
+    EXPECT_NE(first.table_, other.table_);
+    EXPECT_EQ(cache.GetSize(), 2u);
+
+    int builds = 0;
+    for (size_t i = 0; i < RSInterpolatorCache::CAPACITY + 10; i++) {
+        RSInterpolatorTableKey key = { RSInterpolatorTableType::SPRING_INTERPOLATOR,
+            { static_cast<float>(i), 0.0f, 0.0f, 0.0f } };
+        cache.GetTable(key, [&builds]() {
+            builds++;
+            return std::make_shared<RSInterpolatorTable>([](float input) { return input; });
+        });
+    }
+    EXPECT_EQ(builds, static_cast<int>(RSInterpolatorCache::CAPACITY) + 10);
+    EXPECT_EQ(cache.GetSize(), RSInterpolatorCache::CAPACITY);
+    cache.Clear();
+    EXPECT_EQ(cache.GetSize(), 0u);
+}
+
+/**
+ * @tc.name: GetTable002
+ * @tc.desc: Verify that keys with non-finite params are not cached and that interpolators with them are rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSInterpolatorCacheTest, GetTable002, TestSize.Level1)
+{
+    auto& cache = RSInterpolatorCache::Instance();
+    cache.Clear();
+    int builds = 0;
+    auto build = [&builds]() {
+        builds++;
+        return std::make_shared<RSInterpolatorTable>([](float input) { return input; });
+    };
+    RSInterpolatorTableKey nanKey = { RSInterpolatorTableType::CUBIC_BEZIER, { NAN, 0.0f, 0.0f, 1.0f } };
+    RSInterpolatorTableKey infKey = { RSInterpolatorTableType::CUBIC_BEZIER, { 0.0f, INFINITY, 0.0f, 1.0f } };
+    EXPECT_EQ(cache.GetTable(nanKey, build), nullptr);
+    EXPECT_EQ(cache.GetTable(infKey, build), nullptr);
+    EXPECT_EQ(builds, 0);
+    EXPECT_EQ(cache.GetSize(), 0u);
+
+    // the least recently used table is evicted first
+    for (size_t i = 0; i < RSInterpolatorCache::CAPACITY; i++) {
+        RSInterpolatorTableKey key = { RSInterpolatorTableType::SPRING_INTERPOLATOR,
+            { static_cast<float>(i), 0.0f, 0.0f, 0.0f } };
+        cache.GetTable(key, build);
+    }
+    RSInterpolatorTableKey first = { RSInterpolatorTableType::SPRING_INTERPOLATOR, { 0.0f, 0.0f, 0.0f, 0.0f } };
+    RSInterpolatorTableKey second = { RSInterpolatorTableType::SPRING_INTERPOLATOR, { 1.0f, 0.0f, 0.0f, 0.0f } };
+    cache.GetTable(first, build);
+    RSInterpolatorTableKey newKey = { RSInterpolatorTableType::CUBIC_BEZIER, { 0.0f, 0.0f, 0.0f, 1.0f } };
+    cache.GetTable(newKey, build);
+    builds = 0;
+    cache.GetTable(first, build);
+    EXPECT_EQ(builds, 0);
+    cache.GetTable(second, build);
+    EXPECT_EQ(builds, 1);
+    EXPECT_EQ(cache.GetSize(), RSInterpolatorCache::CAPACITY);
+    cache.Clear();
+
+    Parcel cubicBezierParcel;
+    ASSERT_TRUE(cubicBezierParcel.WriteUint64(1) && cubicBezierParcel.WriteFloat(0.4f) &&
+        cubicBezierParcel.WriteFloat(NAN) && cubicBezierParcel.WriteFloat(0.2f) && cubicBezierParcel.WriteFloat(1.0f));
+    EXPECT_EQ(RSCubicBezierInterpolator::Unmarshalling(cubicBezierParcel), nullptr);
+    Parcel springParcel;
+    ASSERT_TRUE(springParcel.WriteUint64(1) && springParcel.WriteFloat(0.5f) && springParcel.WriteFloat(0.8f) &&
+        springParcel.WriteFloat(NAN));
+    EXPECT_EQ(RSSpringInterpolator::Unmarshalling(springParcel), nullptr);
+    EXPECT_EQ(cache.GetSize(), 0u);
+}
+
+/**
+ * @tc.name: InterpolatingSpringVelocity001
+ * @tc.desc: Verify that interpolating springs with an initial velocity are evaluated without a table
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSInterpolatorCacheTest, InterpolatingSpringVelocity001, TestSize.Level1)
+{
+    constexpr uint64_t animationId = 12345;
+    constexpr uint64_t propertyId = 54321;
+    auto createProperty = [](float value) {
+        return std::make_shared<RSRenderAnimatableProperty<float>>(
+            value, propertyId, RSRenderPropertyType::PROPERTY_FLOAT);
+    };
+    auto& cache = RSInterpolatorCache::Instance();
+    cache.Clear();
+    auto animation = std::make_shared<RSRenderInterpolatingSpringAnimation>(
+        animationId, propertyId, createProperty(0.0f), createProperty(0.0f), createProperty(1.0f));
+    animation->SetSpringParameters(0.5f, 0.8f, 3.0f); // 3.0 is the velocity of a fling
+    animation->OnInitialize(0);
+    EXPECT_EQ(animation->springTable_, nullptr);
+    EXPECT_FALSE(animation->IsSpringTableValid());
+    EXPECT_EQ(animation->GetDuration(), std::lroundf(animation->EstimateDuration() * 1000)); // 1000 ms per second
+    EXPECT_EQ(cache.GetSize(), 0u);
+}
+} // namespace Rosen
+} // namespace OHOS
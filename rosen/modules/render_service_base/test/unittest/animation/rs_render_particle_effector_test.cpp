@@ -143,6 +143,35 @@ HWTEST_F(RSRenderParticleEffectorTest, UpdateColor001, TestSize.Level1)
     GTEST_LOG_(INFO) << "RSRenderParticleEffectorTest UpdateColor001 end";
 }
 
+/**
+ * @tc.name: UpdateColor002
+ * @tc.desc: Verify that every color channel carries its own fractional part to the next frame
+ * @tc.type:FUNC
+ * @tc.require: issueIA6IWR
+ */
+HWTEST_F(RSRenderParticleEffectorTest, UpdateColor002, TestSize.Level1)
+{
+    ASSERT_TRUE(particle != nullptr);
+    particle->SetColor(Color(100, 100, 100, 100));
+    particle->SetRedF(0.f);
+    particle->SetGreenF(0.f);
+    particle->SetBlueF(0.f);
+    particle->SetAlphaF(0.f);
+    particle->redSpeed_ = 2.f;
+    particle->greenSpeed_ = 6.f;
+    particle->blueSpeed_ = -2.f;
+    particle->alphaSpeed_ = 10.f;
+    float colorDeltaTime = 0.25f;
+    effector->UpdateColor(particle, colorDeltaTime);
+    EXPECT_EQ(particle->GetColor(), Color(100, 101, 100, 102));
+    EXPECT_FLOAT_EQ(particle->GetRedF(), 0.5f);
+    EXPECT_FLOAT_EQ(particle->GetGreenF(), 0.5f);
+    EXPECT_FLOAT_EQ(particle->GetBlueF(), -0.5f);
+    EXPECT_FLOAT_EQ(particle->GetAlphaF(), 0.5f);
+    effector->UpdateColor(particle, colorDeltaTime);
+    EXPECT_EQ(particle->GetColor(), Color(101, 103, 99, 105));
+}
+
 /**
  * @tc.name: UpdateOpacity001
  * @tc.desc: Verify the UpdateOpacity
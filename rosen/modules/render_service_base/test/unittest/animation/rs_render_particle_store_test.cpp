@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "animation/rs_render_particle_store.h"
+#include "animation/rs_render_particle_system.h"
+#include "render/rs_particles_drawable.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+class RSRenderParticleStoreTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+    static std::shared_ptr<ParticleRenderParams> CreateParams(int64_t lifeTime, int particleCount);
+};
+
+void RSRenderParticleStoreTest::SetUpTestCase() {}
+void RSRenderParticleStoreTest::TearDownTestCase() {}
+void RSRenderParticleStoreTest::SetUp() {}
+void RSRenderParticleStoreTest::TearDown() {}
+
+std::shared_ptr<ParticleRenderParams> RSRenderParticleStoreTest::CreateParams(int64_t lifeTime, int particleCount)
+{
+    int emitRate = 1000;
+    Vector2f position = Vector2f(0.f, 0.f);
+    Vector2f emitSize = Vector2f(500.f, 500.f);
+    Range<int64_t> lifeTimeRange = Range<int64_t>(lifeTime, lifeTime);
+    std::shared_ptr<RSImage> image;
+    Vector2f imageSize = Vector2f(1.f, 1.f);
+    EmitterConfig emitterConfig = EmitterConfig(emitRate, ShapeType::RECT, position, emitSize, particleCount,
+        lifeTimeRange, ParticleType::POINTS, 1.f, image, imageSize);
+    ParticleVelocity velocity(Range<float>(10.f, 50.f), Range<float>(0.f, 360.f));
+    std::vector<std::shared_ptr<ChangeInOverLife<float>>> noChange;
+    RenderParticleAcceleration acceleration(
+        RenderParticleParaType<float>(Range<float>(1.f, 5.f), ParticleUpdator::RANDOM, Range<float>(0.1f, 1.f),
+            noChange),
+        RenderParticleParaType<float>(Range<float>(0.f, 90.f), ParticleUpdator::NONE, Range<float>(), noChange));
+    std::vector<std::shared_ptr<ChangeInOverLife<Color>>> noColorChange;
+    RenderParticleColorParaType color(Range<Color>(RSColor(100, 0, 0, 100), RSColor(255, 255, 255, 255)),
+        DistributionType::UNIFORM, ParticleUpdator::RANDOM, Range<float>(1.f, 10.f), Range<float>(1.f, 10.f),
+        Range<float>(1.f, 10.f), Range<float>(1.f, 10.f), noColorChange);
+    RenderParticleParaType<float> opacity(
+        Range<float>(0.5f, 1.f), ParticleUpdator::RANDOM, Range<float>(-0.1f, 0.1f), noChange);
+    RenderParticleParaType<float> scale(
+        Range<float>(0.5f, 1.f), ParticleUpdator::RANDOM, Range<float>(0.1f, 0.5f), noChange);
+    RenderParticleParaType<float> spin(
+        Range<float>(0.f, 90.f), ParticleUpdator::RANDOM, Range<float>(10.f, 20.f), noChange);
+    return std::make_shared<ParticleRenderParams>(emitterConfig, velocity, acceleration, color, opacity, scale, spin);
+}
+
+/**
+ * @tc.name: Add001
+ * @tc.desc: Verify that Add copies the initial state of a particle into the arrays
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSRenderParticleStoreTest, Add001, TestSize.Level1)
+{
+    auto params = CreateParams(3000, 20); // 3000 is lifeTime, 20 is particleCount
+    RSRenderParticleStore store(params);
+    EXPECT_EQ(store.GetSize(), 0u);
+    EXPECT_EQ(store.GetParticleType(), ParticleType::POINTS);
+    EXPECT_EQ(store.GetRadius(), 1.f);
+
+    RSRenderParticle particle(params);
+    store.Add(particle);
+    ASSERT_EQ(store.GetSize(), 1u);
+    EXPECT_TRUE(store.IsAlive(0));
+    EXPECT_EQ(store.GetPositionX()[0], particle.GetPosition().x_);
+    EXPECT_EQ(store.GetPositionY()[0], particle.GetPosition().y_);
+    EXPECT_EQ(store.GetOpacity()[0], particle.GetOpacity());
+    EXPECT_EQ(store.GetScale()[0], particle.GetScale());
+    EXPECT_EQ(store.GetSpin()[0], particle.GetSpin());
+    EXPECT_EQ(store.GetRed()[0], particle.GetColor().GetRed());
+    EXPECT_EQ(store.GetAlpha()[0], particle.GetColor().GetAlpha());
+
+    store.Clear();
+    EXPECT_EQ(store.GetSize(), 0u);
+}
+
+/**
+ * @tc.name: Update001
+ * @tc.desc: Verify that updating a store matches updating the same particles one by one
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSRenderParticleStoreTest, Update001, TestSize.Level1)
+{
+    auto params = CreateParams(3000, 100); // 3000 is lifeTime, 100 is particleCount
+    RSRenderParticleStore store(params);
+    std::vector<std::shared_ptr<RSRenderParticle>> particles;
+    for (int i = 0; i < 100; i++) { // 100 is particleCount
+        auto particle = std::make_shared<RSRenderParticle>(params);
+        store.Add(*particle);
+        particles.push_back(particle);
+    }
+    RSRenderParticleEffector effector;
+    int64_t deltaTime = NS_TO_S / 60; // 60 frames per second
+    for (int frame = 0; frame < 10; frame++) { // 10 is frame count
+        for (auto& particle : particles) {
+            effector.Update(particle, nullptr, deltaTime);
+        }
+        effector.Update(store, nullptr, deltaTime);
+    }
+    ASSERT_EQ(store.GetSize(), particles.size());
+    constexpr float error = 1e-3f;
+    for (size_t i = 0; i < particles.size(); i++) {
+        EXPECT_NEAR(store.GetPositionX()[i], particles[i]->GetPosition().x_, error);
+        EXPECT_NEAR(store.GetPositionY()[i], particles[i]->GetPosition().y_, error);
+        EXPECT_NEAR(store.GetVelocityX()[i], particles[i]->GetVelocity().x_, error);
+        EXPECT_NEAR(store.GetVelocityY()[i], particles[i]->GetVelocity().y_, error);
+        EXPECT_NEAR(store.GetOpacity()[i], particles[i]->GetOpacity(), error);
+        EXPECT_NEAR(store.GetScale()[i], particles[i]->GetScale(), error);
+        EXPECT_NEAR(store.GetSpin()[i], particles[i]->GetSpin(), error);
+        auto color = particles[i]->GetColor();
+        EXPECT_EQ(store.GetRed()[i], color.GetRed());
+        EXPECT_EQ(store.GetGreen()[i], color.GetGreen());
+        EXPECT_EQ(store.GetBlue()[i], color.GetBlue());
+        EXPECT_EQ(store.GetAlpha()[i], color.GetAlpha());
+        EXPECT_EQ(store.GetActiveTime()[i], particles[i]->GetActiveTime());
+        EXPECT_EQ(store.IsAlive(i), particles[i]->IsAlive());
+    }
+}
+
+/**
+ * @tc.name: RemoveDeadParticles001
+ * @tc.desc: Verify that dead particles are dropped and the alive ones keep their order
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSRenderParticleStoreTest, RemoveDeadParticles001, TestSize.Level1)
+{
+    auto params = CreateParams(3000, 20); // 3000 is lifeTime, 20 is particleCount
+    RSRenderParticleStore store(params);
+    RSRenderParticleEffector effector;
+    for (int i = 0; i < 10; i++) { // 10 particles are added first
+        RSRenderParticle particle(params);
+        store.Add(particle);
+    }
+    effector.UpdateActiveTime(store, 2 * NS_TO_S); // 2 seconds
+    std::vector<float> positionX;
+    for (int i = 0; i < 5; i++) { // 5 particles are added later
+        RSRenderParticle particle(params);
+        store.Add(particle);
+        positionX.push_back(particle.GetPosition().x_);
+    }
+    effector.UpdateActiveTime(store, 2 * NS_TO_S); // 2 seconds, the first 10 particles outlive 3000ms
+    store.RemoveDeadParticles();
+    ASSERT_EQ(store.GetSize(), positionX.size());
+    for (size_t i = 0; i < positionX.size(); i++) {
+        EXPECT_TRUE(store.IsAlive(i));
+        EXPECT_EQ(store.GetPositionX()[i], positionX[i]);
+    }
+}
+
+/**
+ * @tc.name: ParticleSystem001
+ * @tc.desc: Verify that the particle system emits into one store per emitter
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSRenderParticleStoreTest, ParticleSystem001, TestSize.Level1)
+{
+    std::vector<std::shared_ptr<ParticleRenderParams>> particlesRenderParams = { CreateParams(3000, 20) };
+    RSRenderParticleSystem particleSystem(particlesRenderParams);
+    std::vector<std::shared_ptr<RSRenderParticleStore>> stores;
+    std::vector<std::shared_ptr<RSImage>> imageVector;
+    particleSystem.Emit(NS_TO_S, stores, imageVector);
+    ASSERT_EQ(stores.size(), 1u);
+    ASSERT_NE(stores[0], nullptr);
+    EXPECT_EQ(stores[0]->GetSize(), 20u); // 20 is particleCount
+    particleSystem.UpdateParticle(NS_TO_S, stores);
+    EXPECT_FALSE(particleSystem.IsFinish(stores));
+
+    RSRenderParticleVector particleVector;
+    particleVector.particleStores_ = stores;
+    EXPECT_EQ(particleVector.GetParticleSize(), 20); // 20 is particleCount
+    EXPECT_FALSE(particleVector == particleVector);
+}
+
+/**
+ * @tc.name: DrawOrder001
+ * @tc.desc: Verify that the particles of several stores are drawn in the order they were emitted
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSRenderParticleStoreTest, DrawOrder001, TestSize.Level1)
+{
+    auto params = CreateParams(3000, 10); // 3000 is lifeTime, 10 is particleCount
+    auto firstStore = std::make_shared<RSRenderParticleStore>(params);
+    auto secondStore = std::make_shared<RSRenderParticleStore>(params);
+    // the position of a particle is its emit order, so the atlas has to be filled from left to right
+    auto add = [&params](RSRenderParticleStore& store, uint64_t emitOrder) {
+        RSRenderParticle particle(params);
+        particle.SetPosition(Vector2f(static_cast<float>(emitOrder), 0.f));
+        particle.SetOpacity(1.f);
+        particle.SetScale(1.f);
+        store.Add(particle, emitOrder);
+    };
+    for (uint64_t emitOrder : { 0, 1, 4, 5 }) {
+        add(*firstStore, emitOrder);
+    }
+    for (uint64_t emitOrder : { 2, 3, 6 }) {
+        add(*secondStore, emitOrder);
+    }
+    std::vector<std::shared_ptr<RSImage>> imageVector;
+    RSParticlesDrawable drawable({}, { firstStore, secondStore }, imageVector, 0);
+    Drawing::Canvas canvas;
+    drawable.Draw(canvas, std::make_shared<RectF>(-1.f, -1.f, 100.f, 100.f));
+    ASSERT_EQ(drawable.pointRsxform_.size(), 7u); // 7 is the particle count of both stores
+    for (size_t i = 1; i < drawable.pointRsxform_.size(); i++) {
+        EXPECT_LT(drawable.pointRsxform_[i - 1].tx_, drawable.pointRsxform_[i].tx_);
+    }
+}
+} // namespace Rosen
+} // namespace OHOS
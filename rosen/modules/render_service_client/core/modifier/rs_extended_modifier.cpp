@@ -176,6 +176,10 @@ RSDrawingContext RSExtendedModifierHelper::CreateDrawingContext(NodeId nodeId)
     auto recordingCanvas = new ExtendRecordingCanvas(node->GetPaintWidth(), node->GetPaintHeight());
     recordingCanvas->SetIsCustomTextType(node->GetIsCustomTextType());
     recordingCanvas->SetIsCustomTypeface(node->GetIsCustomTypeface());
+    if (auto recording = recordingCanvas->GetDrawCmdList()) {
+        // recording is done on this thread only until FinishDrawing hands the list over
+        recording->BindOwnerThread();
+    }
     return { recordingCanvas, node->GetPaintWidth(), node->GetPaintHeight() };
 }
 
@@ -203,6 +207,7 @@ std::shared_ptr<Drawing::DrawCmdList> RSExtendedModifierHelper::FinishDrawing(RS
         ctx.canvas = nullptr;
         return nullptr;
     }
+    recording->UnbindOwnerThread();
 #if defined(RS_ENABLE_VK)
     if (RSSystemProperties::GetGpuApiType() == GpuApiType::VULKAN && RSSystemProperties::GetTextBlobAsPixelMap()) {
         auto pixelMapDrawCmdList = MakePiexlMapDrawCmdList(recording, ctx);
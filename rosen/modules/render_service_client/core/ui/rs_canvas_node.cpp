@@ -57,6 +57,14 @@ RSCanvasNode::~RSCanvasNode()
 ExtendRecordingCanvas* RSCanvasNode::BeginRecording(int width, int height)
 {
     recordingCanvas_ = new ExtendRecordingCanvas(width, height);
+    if (auto recording = recordingCanvas_->GetDrawCmdList()) {
+        // recording is done on this thread only until FinishRecording hands the list over
+        recording->BindOwnerThread();
+        // the reserve replaces the first chunk of the new list, so a recording of the same size stays contiguous
+        if (lastRecordingSize_ > 0) {
+            recording->ReserveOpData(lastRecordingSize_);
+        }
+    }
     recordingCanvas_->SetIsCustomTextType(isCustomTextType_);
     recordingCanvas_->SetIsCustomTypeface(isCustomTypeface_);
     auto transactionProxy = RSTransactionProxy::GetInstance();
@@ -94,6 +102,12 @@ void RSCanvasNode::FinishRecording()
     auto recording = recordingCanvas_->GetDrawCmdList();
     delete recordingCanvas_;
     recordingCanvas_ = nullptr;
+    if (recording) {
+        // flattened on the recording thread, so marshalling finds the ops contiguous
+        recording->FlattenOpData();
+        recording->UnbindOwnerThread();
+    }
+    lastRecordingSize_ = recording ? recording->GetOpDataSize() : 0;
     if (recording && recording->IsEmpty()) {
         return;
     }
@@ -117,12 +131,20 @@ void RSCanvasNode::DrawOnNode(RSModifierType type, DrawFunc func)
     auto recordingCanvas = std::make_shared<ExtendRecordingCanvas>(GetPaintWidth(), GetPaintHeight());
     recordingCanvas->SetIsCustomTextType(isCustomTextType_);
     recordingCanvas->SetIsCustomTypeface(isCustomTypeface_);
+    if (auto recording = recordingCanvas->GetDrawCmdList()) {
+        recording->BindOwnerThread();
+    }
     func(recordingCanvas);
+    auto recording = recordingCanvas->GetDrawCmdList();
+    if (recording) {
+        // flattened on the recording thread, so marshalling finds the ops contiguous
+        recording->FlattenOpData();
+        recording->UnbindOwnerThread();
+    }
     auto transactionProxy = RSTransactionProxy::GetInstance();
     if (transactionProxy == nullptr) {
         return;
     }
-    auto recording = recordingCanvas->GetDrawCmdList();
     if (recording && recording->IsEmpty()) {
         return;
     }
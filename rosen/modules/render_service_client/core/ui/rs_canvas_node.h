@@ -61,6 +61,8 @@ protected:
 private:
     ExtendRecordingCanvas* recordingCanvas_ = nullptr;
     bool recordingUpdated_ = false;
+    // size of the last recording, the next recording reserves its op buffer at this size
+    size_t lastRecordingSize_ = 0;
     bool hdrPresent_ = false;
     mutable std::mutex mutex_;
 
@@ -1026,6 +1026,20 @@ const void* RSProfiler::ReadParcelData(Parcel& parcel, size_t size, bool& isMall
     return data;
 }
 
+const void* RSProfiler::ReadParcelDataMapped(Parcel& parcel, size_t size, std::shared_ptr<void>& holder)
+{
+    if (!IsEnabled()) {
+        return RSMarshallingHelper::ReadFromAshmemMapped(parcel, size, holder);
+    }
+
+    bool isMalloc = false;
+    const void* data = ReadParcelData(parcel, size, isMalloc);
+    if (data != nullptr && isMalloc) {
+        holder = std::shared_ptr<void>(const_cast<void*>(data), free);
+    }
+    return data;
+}
+
 uint32_t RSProfiler::GetNodeDepth(const std::shared_ptr<RSRenderNode> node)
 {
     uint32_t depth = 0;
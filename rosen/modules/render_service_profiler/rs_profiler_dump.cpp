@@ -472,7 +472,7 @@ void RSProfiler::DumpNodeAnimation(const RSRenderAnimation& animation, JsonWrite
 
 void RSProfiler::DumpNodeChildrenListUpdate(const RSRenderNode& node, JsonWriter& out)
 {
-    if (!node.isFullChildrenListValid_) {
+    if (!node.isFullChildrenListValid_ || !node.appendedChildren_.empty()) {
         auto& childrenUpdate = out["children update"];
         childrenUpdate.PushObject();
         childrenUpdate["current count"] = node.fullChildrenList_->size();
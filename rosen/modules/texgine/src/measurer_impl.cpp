@@ -15,6 +15,8 @@
 
 #include "measurer_impl.h"
 
+#include <string_view>
+
 #include "texgine_exception.h"
 #include "texgine/utils/exlog.h"
 #ifdef LOGGER_ENABLE_SCOPE
@@ -28,12 +30,11 @@ namespace TextEngine {
 #define INVALID_TEXT_LENGTH (-1)
 #define SUCCESSED 0
 #define FAILED 1
-#define POLL_MECHANISM 4999
-#define POLL_NUM 1000
 constexpr static uint8_t FIRST_BYTE = 24;
 constexpr static uint8_t SECOND_BYTE = 16;
 constexpr static uint8_t THIRD_BYTE = 8;
 static std::string g_detectionName;
+static std::mutex g_detectionMutex;
 
 namespace {
 void DumpCharGroup(int32_t index, const CharGroup &cg, double glyphEm,
@@ -105,12 +106,52 @@ const std::vector<Boundary> &MeasurerImpl::GetWordBoundary() const
     return boundaries_;
 }
 
-void MeasurerImpl::UpdateCache()
+void MeasurerImpl::SetCacheBudget(size_t bytes)
+{
+    cache_.SetBudget(bytes);
+}
+
+MeasurerImpl::CacheStatistics MeasurerImpl::GetCacheStatistics()
+{
+    return cache_.GetStatistics();
+}
+
+void MeasurerImpl::ClearCache()
+{
+    cache_.Clear();
+}
+
+size_t MeasurerImpl::EstimateBytes(const struct MeasurerCacheKey &key, const struct MeasurerCacheVal &value)
 {
-    auto iter = cache_.begin();
-    for (size_t index = 0; index < POLL_NUM; index++) {
-        cache_.erase(iter++);
+    size_t bytes = sizeof(struct MeasurerCacheKey) + sizeof(struct MeasurerCacheVal) +
+        key.text.size() * sizeof(uint16_t) + key.locale.size() + value.boundaries.size() * sizeof(Boundary);
+    for (const auto &cg : value.cgs) {
+        bytes += sizeof(struct CharGroup) + cg.chars.size() * sizeof(uint16_t) + cg.glyphs.size() * sizeof(Glyph);
     }
+    return bytes;
+}
+
+std::shared_ptr<const MeasurerImpl::MeasurerCacheVal> MeasurerImpl::FindCache(const struct MeasurerCacheKey &key)
+{
+    return cache_.Find(key);
+}
+
+void MeasurerImpl::UpdateCache(const struct MeasurerCacheKey &key, CharGroups &cgs,
+    const std::vector<Boundary> &boundaries)
+{
+    if (cache_.GetShardBudget() == 0) {
+        return;
+    }
+    auto value = std::make_shared<struct MeasurerCacheVal>();
+    value->cgs = cgs;
+    value->boundaries = boundaries;
+    size_t bytes = EstimateBytes(key, *value);
+    cache_.Insert(key, std::move(value), bytes);
+}
+
+void MeasurerImpl::EraseCache(const struct MeasurerCacheKey &key, const struct MeasurerCacheVal *value)
+{
+    cache_.Erase(key, value);
 }
 
 void MeasurerImpl::GetInitKey(struct MeasurerCacheKey &key) const
@@ -124,6 +165,21 @@ void MeasurerImpl::GetInitKey(struct MeasurerCacheKey &key) const
     key.endIndex = endIndex_;
     key.letterSpacing = letterSpacing_;
     key.wordSpacing = wordSpacing_;
+
+    size_t hash = std::hash<std::u16string_view>()(
+        std::u16string_view(reinterpret_cast<const char16_t *>(text_.data()), text_.size()));
+    auto combine = [&hash](size_t value) {
+        // 0x9e3779b9 and the shifts are the boost::hash_combine mixing constants
+        hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    };
+    combine(std::hash<std::string>()(locale_));
+    combine(std::hash<double>()(size_));
+    combine(std::hash<double>()(letterSpacing_));
+    combine(std::hash<double>()(wordSpacing_));
+    combine(static_cast<size_t>(style_.GetWeight()));
+    combine(static_cast<size_t>(style_.GetFontStyle()));
+    combine((startIndex_ << 1) ^ (endIndex_ << 16) ^ static_cast<size_t>(rtl_));
+    key.hash = hash;
 }
 
 int MeasurerImpl::Measure(CharGroups &cgs)
@@ -134,16 +190,20 @@ int MeasurerImpl::Measure(CharGroups &cgs)
     LOGSCOPED(sl, LOGEX_FUNC_LINE_DEBUG(), "MeasurerImpl::Measure");
     MeasurerCacheKey key;
     GetInitKey(key);
-    if (fontFeatures_ == nullptr || fontFeatures_->GetFeatures().size() == 0) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        auto it = cache_.find(key);
-        if (it != cache_.end()) {
-            cgs = it->second.cgs.Clone();
-            boundaries_ = it->second.boundaries;
-            if (g_detectionName != cgs.GetTypefaceName()) {
-                cache_.erase(key);
-            } else if (cache_.size() > POLL_MECHANISM) {
-                UpdateCache();
+    bool cacheable = fontFeatures_ == nullptr || fontFeatures_->GetFeatures().size() == 0;
+    if (cacheable) {
+        auto value = FindCache(key);
+        if (value != nullptr) {
+            std::string detectionName;
+            {
+                std::lock_guard<std::mutex> lock(g_detectionMutex);
+                detectionName = g_detectionName;
+            }
+            // the cached char groups are shared, not cloned, they are never modified after measuring
+            cgs = value->cgs;
+            boundaries_ = value->boundaries;
+            if (detectionName != cgs.GetTypefaceName()) {
+                EraseCache(key, value.get());
             }
             return SUCCESSED;
         }
@@ -162,13 +222,12 @@ int MeasurerImpl::Measure(CharGroups &cgs)
         return ret;
     }
 
-    if (fontFeatures_ == nullptr || fontFeatures_->GetFeatures().size() == 0) {
-        if (cgs.CheckCodePoint()) {
+    if (cacheable && cgs.CheckCodePoint()) {
+        {
+            std::lock_guard<std::mutex> lock(g_detectionMutex);
             g_detectionName = cgs.GetTypefaceName();
-            struct MeasurerCacheVal value = {cgs.Clone(), boundaries_};
-            std::lock_guard<std::mutex> lock(mutex_);
-            cache_[key] = value;
         }
+        UpdateCache(key, cgs, boundaries_);
     }
     return SUCCESSED;
 }
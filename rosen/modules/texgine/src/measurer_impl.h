@@ -27,6 +27,7 @@
 #include <unicode/uchar.h>
 
 #include "measurer.h"
+#include "utils/sharded_lru_cache.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -40,6 +41,10 @@ struct MeasuringRun {
 
 class MeasurerImpl : public Measurer {
 public:
+    using CacheStatistics = LruCacheStatistics;
+    static constexpr size_t CACHE_SHARD_COUNT = 16;
+    static constexpr size_t DEFAULT_CACHE_BUDGET = 8 * 1024 * 1024;
+
     MeasurerImpl(const std::vector<uint16_t> &text, const FontCollection &fontCollection);
 
     /*
@@ -49,12 +54,29 @@ public:
 
     /*
      * @brief Measure font
-     * @param cgs The output parameter, after measurer will generate char groups
+     * @param cgs The output parameter, after measurer will generate char groups.
+     *            The char groups may share storage with the measure cache, so they must not be modified in place
      * @return 0 is measurer successed
      *         1 is measurer failed
      */
     int Measure(CharGroups &cgs) override;
 
+    /*
+     * @brief Sets the memory budget of the measure cache, least recently used results are evicted beyond it
+     * @param bytes The budget in bytes, 0 disables the cache
+     */
+    static void SetCacheBudget(size_t bytes);
+
+    /*
+     * @brief Gets the hit, miss and eviction counts and the current size of the measure cache
+     */
+    static CacheStatistics GetCacheStatistics();
+
+    /*
+     * @brief Drops all cached measure results
+     */
+    static void ClearCache();
+
     /*
      * @brief Seeks typeface for text, this should be private, now is for UT testing
      * @param runs Input and output parameter, intermediate products of measurement
@@ -98,53 +120,39 @@ private:
         double letterSpacing = 0;
         double wordSpacing = 0;
 
-        bool operator <(const struct MeasurerCacheKey &rhs) const
+        size_t hash = 0;
+
+        bool operator ==(const struct MeasurerCacheKey &rhs) const
         {
-            if (startIndex != rhs.startIndex) {
-                return startIndex < rhs.startIndex;
-            }
-            if (endIndex != rhs.endIndex) {
-                return endIndex < rhs.endIndex;
-            }
-            if (text != rhs.text) {
-                return text < rhs.text;
-            }
-            if (rtl != rhs.rtl) {
-                return rtl < rhs.rtl;
-            }
-            if (size != rhs.size) {
-                return size < rhs.size;
-            }
-            if (style != rhs.style) {
-                return style < rhs.style;
-            }
-            if (locale != rhs.locale) {
-                return locale < rhs.locale;
-            }
-            if (letterSpacing != rhs.letterSpacing) {
-                return letterSpacing < rhs.letterSpacing;
-            }
-            if (wordSpacing != rhs.wordSpacing) {
-                return wordSpacing < rhs.wordSpacing;
-            }
-            return false;
+            return hash == rhs.hash && startIndex == rhs.startIndex && endIndex == rhs.endIndex &&
+                rtl == rhs.rtl && size == rhs.size && style == rhs.style && letterSpacing == rhs.letterSpacing &&
+                wordSpacing == rhs.wordSpacing && text == rhs.text && locale == rhs.locale;
         }
     };
+    struct MeasurerCacheKeyHash {
+        size_t operator()(const struct MeasurerCacheKey &key) const
+        {
+            return key.hash;
+        }
+    };
+    // immutable once cached, hits share it instead of copying
     struct MeasurerCacheVal {
         CharGroups cgs;
         std::vector<Boundary> boundaries = {};
     };
-
     void DoSeekScript(std::list<struct MeasuringRun> &runs, hb_unicode_funcs_t* icuGetUnicodeFuncs);
     int DoShape(CharGroups &cgs, MeasuringRun &run, size_t &index);
     int GetGlyphs(CharGroups &cgs, MeasuringRun &run, size_t &index, hb_buffer_t* hbuffer,
         std::shared_ptr<TextEngine::Typeface> typeface);
     void DoCgsByCluster(std::map<uint32_t, TextEngine::CharGroup> &cgsByCluster);
     void HbDestroy(hb_buffer_t* hbuffer, hb_font_t* hfont, hb_face_t* hface, hb_unicode_funcs_t* icuGetUnicodeFuncs);
-    void UpdateCache();
     void GetInitKey(struct MeasurerCacheKey &key) const;
-    static inline std::mutex mutex_;
-    static inline std::map<struct MeasurerCacheKey, struct MeasurerCacheVal> cache_;
+    static std::shared_ptr<const struct MeasurerCacheVal> FindCache(const struct MeasurerCacheKey &key);
+    static void UpdateCache(const struct MeasurerCacheKey &key, CharGroups &cgs,
+        const std::vector<Boundary> &boundaries);
+    static size_t EstimateBytes(const struct MeasurerCacheKey &key, const struct MeasurerCacheVal &value);
+    static inline ShardedLruCache<struct MeasurerCacheKey, const struct MeasurerCacheVal,
+        struct MeasurerCacheKeyHash, CACHE_SHARD_COUNT> cache_ { DEFAULT_CACHE_BUDGET };
     std::vector<Boundary> boundaries_ = {};
 };
 
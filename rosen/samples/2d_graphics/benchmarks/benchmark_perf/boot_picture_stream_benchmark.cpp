@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "boot_picture_stream.h"
+#include "boot_picture_zip_util.h"
+#include "image/bitmap.h"
+#include "perf_benchmark.h"
+#include "util.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+const std::string ZIP_PATH = "/data/local/tmp/boot_picture_stream_benchmark.zip";
+constexpr int32_t FRAME_NUM = 60;
+constexpr int32_t FRAME_SIZE = 480;
+
+// peak resident memory since the last ResetPeakRss, in KB
+int64_t ReadPeakRss()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, strlen("VmHWM:"), "VmHWM:") == 0) {
+            return std::stoll(line.substr(strlen("VmHWM:")));
+        }
+    }
+    return -1;
+}
+
+void ResetPeakRss()
+{
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+}
+
+double ElapsedMs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool ReadAllFrames()
+{
+    Drawing::ImageInfo info(FRAME_SIZE, FRAME_SIZE, Drawing::ColorType::COLORTYPE_RGBA_8888,
+        Drawing::AlphaType::ALPHATYPE_PREMUL);
+    std::vector<uint8_t> pixels(static_cast<size_t>(FRAME_SIZE) * FRAME_SIZE * 4);
+    auto start = std::chrono::steady_clock::now();
+    ImageStructVec imgVec;
+    FrameRateConfig frameConfig;
+    if (!ReadZipFile(ZIP_PATH, imgVec, frameConfig) || static_cast<int32_t>(imgVec.size()) != FRAME_NUM) {
+        return false;
+    }
+    SortZipFile(imgVec);
+    for (int32_t i = 0; i < FRAME_NUM; i++) {
+        if (!imgVec[i]->imageData->ReadPixels(info, pixels.data(), FRAME_SIZE * 4, 0, 0)) {
+            return false;
+        }
+        if (i == 0) {
+            std::cout << "ReadZipFile first frame: " << ElapsedMs(start) << "ms" << std::endl;
+        }
+    }
+    return true;
+}
+
+bool StreamAllFrames()
+{
+    auto start = std::chrono::steady_clock::now();
+    BootPictureStream stream;
+    FrameRateConfig frameConfig;
+    if (!stream.Open(ZIP_PATH, frameConfig)) {
+        return false;
+    }
+    stream.Start();
+    std::shared_ptr<ImageStruct> frame = nullptr;
+    for (int32_t i = 0; i < FRAME_NUM; i++) {
+        if (!PopBootPictureFrame(stream, frame)) {
+            return false;
+        }
+        if (i == 0) {
+            std::cout << "BootPictureStream first frame: " << ElapsedMs(start) << "ms" << std::endl;
+        }
+    }
+    return true;
+}
+} // namespace
+
+// time to first frame and peak memory of ReadZipFile and BootPictureStream
+PERF_BENCHMARK(BootPictureStream)
+{
+    if (!WriteBootPictureZip(ZIP_PATH, FRAME_NUM, FRAME_SIZE)) {
+        std::cout << "Boot picture zip write failed" << std::endl;
+        remove(ZIP_PATH.c_str());
+        return;
+    }
+    // all frames are read before the first one is drawn
+    ResetPeakRss();
+    bool ret = ReadAllFrames();
+    std::cout << "ReadZipFile peak rss: " << ReadPeakRss() << "KB" << std::endl;
+
+    ResetPeakRss();
+    ret = StreamAllFrames() && ret;
+    std::cout << "BootPictureStream peak rss: " << ReadPeakRss() << "KB" << std::endl;
+    if (!ret) {
+        std::cout << "Boot picture frames read failed" << std::endl;
+    }
+    remove(ZIP_PATH.c_str());
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+
+#include "draw/path.h"
+#include "perf_benchmark.h"
+#include "recording/draw_cmd_list.h"
+#include "recording/recording_canvas.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr int32_t CANVAS_WIDTH = 1000;
+constexpr int32_t CANVAS_HEIGHT = 1000;
+constexpr uint32_t MIXED_OP_COUNT = 10000;
+constexpr uint32_t MIXED_OP_KINDS = 5;
+
+void RecordMixedOps(Drawing::RecordingCanvas& canvas)
+{
+    Drawing::Path path;
+    path.MoveTo(0, 0);
+    path.LineTo(CANVAS_WIDTH, CANVAS_HEIGHT);
+    Drawing::Brush brush(Drawing::Color::COLOR_GREEN);
+    Drawing::Pen pen(Drawing::Color::COLOR_RED);
+    for (uint32_t i = 0; i < MIXED_OP_COUNT / MIXED_OP_KINDS; i++) {
+        float pos = static_cast<float>(i % CANVAS_WIDTH);
+        canvas.AttachBrush(brush);
+        canvas.DrawRect(Drawing::Rect(pos, pos, pos + 10, pos + 10));
+        canvas.DrawCircle(Drawing::Point(pos, pos), 5);
+        canvas.DetachBrush();
+        canvas.AttachPen(pen);
+        canvas.DrawLine(Drawing::Point(0, pos), Drawing::Point(CANVAS_WIDTH, pos));
+        canvas.DrawPath(path);
+        canvas.DetachPen();
+        canvas.DrawColor(Drawing::Color::COLOR_WHITE);
+    }
+}
+
+int64_t RecordMixedOpsTime(bool bindOwnerThread)
+{
+    Drawing::RecordingCanvas canvas(CANVAS_WIDTH, CANVAS_HEIGHT);
+    if (bindOwnerThread) {
+        canvas.GetDrawCmdList()->BindOwnerThread();
+    }
+    auto start = std::chrono::steady_clock::now();
+    RecordMixedOps(canvas);
+    int64_t time = PerfBenchmark::ElapsedUs(start);
+    canvas.GetDrawCmdList()->UnbindOwnerThread();
+    return time;
+}
+} // namespace
+
+// records 10k mixed ops with locking and on the owner thread
+PERF_BENCHMARK(CmdListRecording)
+{
+    int64_t lockedTime = RecordMixedOpsTime(false);
+    int64_t ownerThreadTime = RecordMixedOpsTime(true);
+    std::cout << "CmdList record " << MIXED_OP_COUNT << " mixed ops: locked " << lockedTime << "us, owner thread "
+              << ownerThreadTime << "us" << std::endl;
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+
+#include "color_picker.h"
+#include "effect_errors.h"
+#include "perf_benchmark.h"
+#include "pixel_map.h"
+
+namespace OHOS {
+namespace Rosen {
+// extracts the colors of a 100x100 pixelmap
+PERF_BENCHMARK(CreateColorPicker)
+{
+    constexpr uint32_t width = 100;
+    constexpr uint32_t height = 100;
+    constexpr int replayCount = 100;
+    std::vector<uint32_t> colors(width * height);
+    for (uint32_t i = 0; i < colors.size(); i++) {
+        colors[i] = 0xFF000000 | ((i * 2654435761u) & 0xFFFFFF); // 2654435761 spreads the colors
+    }
+    Media::InitializationOptions opts;
+    opts.size.width = width;
+    opts.size.height = height;
+    opts.pixelFormat = Media::PixelFormat::RGBA_8888;
+    opts.editable = true;
+    std::shared_ptr<Media::PixelMap> pixmap = Media::PixelMap::Create(colors.data(), colors.size(), opts);
+    if (pixmap == nullptr) {
+        std::cout << "PixelMap create failed" << std::endl;
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < replayCount; i++) {
+        uint32_t errorCode = SUCCESS;
+        std::shared_ptr<ColorPicker> pColorPicker = ColorPicker::CreateColorPicker(pixmap, errorCode);
+        if (pColorPicker == nullptr) {
+            std::cout << "CreateColorPicker failed, errorCode " << errorCode << std::endl;
+            return;
+        }
+    }
+    int64_t time = PerfBenchmark::ElapsedUs(start) / replayCount;
+    std::cout << "CreateColorPicker " << width << "x" << height << ": " << time << "us" << std::endl;
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+
+#include "perf_benchmark.h"
+#include "recording/draw_cmd.h"
+#include "recording/draw_cmd_list.h"
+#include "recording/draw_op_arena.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr uint32_t OP_COUNT = 10000;
+constexpr uint32_t LOOP_COUNT = 100;
+
+std::shared_ptr<Drawing::DrawCmdList> CreateCmdList()
+{
+    auto drawCmdList = std::make_shared<Drawing::DrawCmdList>(10, 20);
+    for (uint32_t i = 0; i < OP_COUNT; i++) {
+        if (i % 2 == 0) {
+            drawCmdList->AddDrawOp<Drawing::TranslateOpItem::ConstructorHandle>(1.0f, 1.0f);
+        } else {
+            drawCmdList->AddDrawOp<Drawing::ClearOpItem::ConstructorHandle>(Drawing::Color::COLOR_BLACK);
+        }
+    }
+    drawCmdList->FlattenOpData();
+    return drawCmdList;
+}
+} // namespace
+
+// creates 10k ops on heap, in a DrawOpArena, and by unmarshalling a DrawCmdList
+PERF_BENCHMARK(DrawOpArenaUnmarshalling)
+{
+    std::vector<std::shared_ptr<Drawing::DrawOpItem>> ops;
+    ops.reserve(OP_COUNT);
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t loop = 0; loop < LOOP_COUNT; loop++) {
+        for (uint32_t i = 0; i < OP_COUNT; i++) {
+            ops.emplace_back(std::make_shared<Drawing::ClearOpItem>(Drawing::Color::COLOR_BLACK));
+        }
+        ops.clear();
+    }
+    int64_t heapTime = PerfBenchmark::ElapsedUs(start);
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t loop = 0; loop < LOOP_COUNT; loop++) {
+        auto arena = std::make_shared<Drawing::DrawOpArena>();
+        for (uint32_t i = 0; i < OP_COUNT; i++) {
+            ops.emplace_back(std::allocate_shared<Drawing::ClearOpItem>(
+                Drawing::DrawOpArenaAllocator<Drawing::ClearOpItem>(arena), Drawing::Color::COLOR_BLACK));
+        }
+        ops.clear();
+    }
+    int64_t arenaTime = PerfBenchmark::ElapsedUs(start);
+
+    auto drawCmdList = CreateCmdList();
+    auto data = drawCmdList->GetData();
+    start = std::chrono::steady_clock::now();
+    for (uint32_t loop = 0; loop < LOOP_COUNT; loop++) {
+        auto newDrawCmdList = Drawing::DrawCmdList::CreateFromData(data, false);
+        newDrawCmdList->UnmarshallingDrawOps();
+    }
+    int64_t unmarshallingTime = PerfBenchmark::ElapsedUs(start);
+
+    std::cout << "DrawOpItem create " << OP_COUNT << " ops x " << LOOP_COUNT << ": heap " << heapTime << "us, arena "
+              << arenaTime << "us, UnmarshallingDrawOps " << unmarshallingTime << "us" << std::endl;
+}
+} // namespace Rosen
+} // namespace OHOS
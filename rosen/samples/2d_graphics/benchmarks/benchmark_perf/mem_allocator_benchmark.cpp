@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+
+#include "perf_benchmark.h"
+#include "recording/mem_allocator.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr uint32_t OP_COUNT = 10000;
+constexpr uint32_t LOOP_COUNT = 100;
+
+struct BenchmarkOp {
+    uint32_t index;
+    uint32_t value;
+    char payload[40];
+};
+
+int64_t RecordOps(bool chunked)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t loop = 0; loop < LOOP_COUNT; loop++) {
+        Drawing::MemAllocator allocator;
+        allocator.SetChunked(chunked);
+        for (uint32_t i = 0; i < OP_COUNT; i++) {
+            allocator.Allocate<BenchmarkOp>(BenchmarkOp { i, i, {} });
+        }
+        allocator.Flatten();
+    }
+    return PerfBenchmark::ElapsedUs(start);
+}
+} // namespace
+
+// records ops into a contiguous and a chunked MemAllocator and flattens them
+PERF_BENCHMARK(MemAllocatorRecording)
+{
+    int64_t contiguousTime = RecordOps(false);
+    int64_t chunkedTime = RecordOps(true);
+    std::cout << "MemAllocator record " << OP_COUNT << " ops x " << LOOP_COUNT << ": contiguous " << contiguousTime
+              << "us, chunked " << chunkedTime << "us" << std::endl;
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+
+#include "paragraph_layout_cache.h"
+#include "perf_benchmark.h"
+#include "txt/font_collection.h"
+#include "txt/paragraph_builder.h"
+#include "txt/paragraph_style.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+const std::vector<std::u16string> CORPUS = {
+    u"The quick brown fox jumps over the lazy dog, again and again.",
+    u"敏捷的棕色狐狸跳过了懒狗，一次又一次地跳过。",
+    u"Съешь же ещё этих мягких французских булок да выпей чаю.",
+    u"نص عربي قصير للاختبار مع بعض الكلمات الإضافية",
+    u"Mixed 混合 text テキスト with 숫자 12345 and emoji 😀 inside.",
+    u"สวัสดีครับ นี่คือข้อความภาษาไทยสำหรับทดสอบ",
+    u"Ελληνικό κείμενο για δοκιμή της διάταξης παραγράφων.",
+    u"हिन्दी में एक छोटा सा परीक्षण वाक्य यहाँ है।",
+};
+const std::vector<double> WIDTHS = { 120, 240, 360 };
+constexpr int ROUNDS = 50;
+constexpr double FONT_SIZE = 16;
+
+int64_t LayoutCorpus(const std::shared_ptr<SPText::FontCollection>& fontCollection)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (const auto& text : CORPUS) {
+            for (double width : WIDTHS) {
+                SPText::ParagraphStyle paragraphStyle;
+                auto builder = SPText::ParagraphBuilder::Create(paragraphStyle, fontCollection);
+                SPText::TextStyle textStyle;
+                textStyle.fontSize = FONT_SIZE;
+                builder->PushStyle(textStyle);
+                builder->AddText(text);
+                builder->Pop();
+                builder->Build()->Layout(width);
+            }
+        }
+    }
+    return PerfBenchmark::ElapsedUs(start);
+}
+} // namespace
+
+// lays out a corpus of mixed script paragraphs repeatedly, as recycled list items do
+PERF_BENCHMARK(ParagraphLayoutCache)
+{
+    auto fontCollection = std::make_shared<SPText::FontCollection>();
+    fontCollection->SetupDefaultFontManager();
+    auto& cache = SPText::ParagraphLayoutCache::Instance();
+    cache.Clear();
+    cache.SetBudget(0);
+    int64_t uncached = LayoutCorpus(fontCollection);
+    cache.SetBudget(SPText::ParagraphLayoutCache::DEFAULT_BUDGET);
+    int64_t cached = LayoutCorpus(fontCollection);
+    auto statistics = cache.GetStatistics();
+    std::cout << "ParagraphLayout " << ROUNDS * CORPUS.size() * WIDTHS.size() << " layouts: uncached " << uncached
+              << "us, cached " << cached << "us, hits " << statistics.hits << ", misses " << statistics.misses
+              << ", bytes " << statistics.bytes << std::endl;
+    cache.Clear();
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "perf_benchmark.h"
+
+#include <iostream>
+
+namespace OHOS {
+namespace Rosen {
+PerfBenchmark& PerfBenchmark::Instance()
+{
+    static PerfBenchmark instance;
+    return instance;
+}
+
+bool PerfBenchmark::Register(const std::string& name, Func func)
+{
+    benchmarks_.emplace_back(name, std::move(func));
+    return true;
+}
+
+void PerfBenchmark::Run(const std::string& filter) const
+{
+    for (const auto& [name, func] : benchmarks_) {
+        if (!filter.empty() && name.find(filter) == std::string::npos) {
+            continue;
+        }
+        std::cout << "[ RUN      ] " << name << std::endl;
+        auto start = std::chrono::steady_clock::now();
+        func();
+        std::cout << "[     DONE ] " << name << " (" << ElapsedUs(start) / 1000 << " ms)" << std::endl;
+    }
+}
+} // namespace Rosen
+} // namespace OHOS
+
+int main(int argc, char* argv[])
+{
+    OHOS::Rosen::PerfBenchmark::Instance().Run(argc > 1 ? argv[1] : "");
+    return 0;
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PERF_BENCHMARK_H
+#define PERF_BENCHMARK_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace OHOS {
+namespace Rosen {
+/*
+ * Timing loops of the graphic modules, kept out of the unit tests so that those only check behaviour. A benchmark
+ * registers itself with PERF_BENCHMARK and prints its own results. rosen_perf_benchmark runs all of them, or the
+ * ones whose name contains the first argument.
+ */
+class PerfBenchmark {
+public:
+    using Func = std::function<void()>;
+
+    static PerfBenchmark& Instance();
+
+    bool Register(const std::string& name, Func func);
+    void Run(const std::string& filter) const;
+
+    static int64_t ElapsedUs(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+private:
+    std::vector<std::pair<std::string, Func>> benchmarks_;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#define PERF_BENCHMARK(name)                                                                          \
+    static void name();                                                                               \
+    [[maybe_unused]] static bool g_##name##Registered =                                               \
+        OHOS::Rosen::PerfBenchmark::Instance().Register(#name, name);                                 \
+    static void name()
+
+#endif // PERF_BENCHMARK_H
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+#include <thread>
+
+#include "animation/rs_animation_scheduler.h"
+#include "animation/rs_cubic_bezier_interpolator.h"
+#include "animation/rs_render_curve_animation.h"
+#include "modifier/rs_render_property.h"
+#include "perf_benchmark.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr uint64_t ANIMATION_ID = 12345;
+constexpr uint64_t PROPERTY_ID = 54321;
+constexpr int64_t START_TIME = 1000000000;
+constexpr int64_t FRAME_TIME = 16666667;
+constexpr int ANIMATION_COUNT = 10000;
+constexpr int FRAME_COUNT = 30;
+
+std::shared_ptr<RSRenderAnimatableProperty<float>> CreateProperty(float value)
+{
+    return std::make_shared<RSRenderAnimatableProperty<float>>(
+        value, PROPERTY_ID, RSRenderPropertyType::PROPERTY_FLOAT);
+}
+
+std::vector<std::shared_ptr<RSRenderCurveAnimation>> CreateAnimations()
+{
+    std::vector<std::shared_ptr<RSRenderCurveAnimation>> animations;
+    for (int i = 0; i < ANIMATION_COUNT; i++) {
+        auto animation = std::make_shared<RSRenderCurveAnimation>(
+            ANIMATION_ID + i, PROPERTY_ID, CreateProperty(0.0f), CreateProperty(0.0f), CreateProperty(100.0f));
+        animation->SetDuration(1000); // 1000 is duration in ms
+        animation->SetInterpolator(std::make_shared<RSCubicBezierInterpolator>(0.42f, 0.0f, 0.58f, 1.0f));
+        animation->AttachRenderProperty(CreateProperty(0.0f));
+        animation->Start();
+        animations.push_back(animation);
+    }
+    return animations;
+}
+
+// threadCount 0 animates one by one, otherwise the interpolations are batched on threadCount threads
+int64_t AnimateFrames(std::vector<std::shared_ptr<RSRenderCurveAnimation>>& animations, int threadCount)
+{
+    RSAnimationScheduler scheduler;
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < FRAME_COUNT; frame++) {
+        int64_t time = START_TIME + frame * FRAME_TIME;
+        if (threadCount > 0) {
+            for (auto& animation : animations) {
+                animation->PrepareAnimate(time, scheduler);
+            }
+            size_t chunkSize = (scheduler.GetJobCount() + threadCount - 1) / threadCount;
+            std::vector<std::thread> threads;
+            for (int i = 1; i < threadCount; i++) {
+                threads.emplace_back([&scheduler, i, chunkSize]() {
+                    scheduler.Evaluate(i * chunkSize, (i + 1) * chunkSize);
+                });
+            }
+            scheduler.Evaluate(0, chunkSize);
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+        for (auto& animation : animations) {
+            animation->Animate(time);
+        }
+        scheduler.Clear();
+    }
+    return PerfBenchmark::ElapsedUs(start);
+}
+} // namespace
+
+// animates 10k curve animations one by one, and with their interpolations batched on 1 and 4 threads
+PERF_BENCHMARK(AnimationScheduler)
+{
+    auto serialAnimations = CreateAnimations();
+    auto batchAnimations = CreateAnimations();
+    auto parallelAnimations = CreateAnimations();
+    int64_t serialTime = AnimateFrames(serialAnimations, 0);
+    int64_t batchTime = AnimateFrames(batchAnimations, 1);
+    int64_t parallelTime = AnimateFrames(parallelAnimations, 4); // 4 is thread count
+    for (int i = 0; i < ANIMATION_COUNT; i++) {
+        if (batchAnimations[i]->GetValueFraction() != serialAnimations[i]->GetValueFraction() ||
+            parallelAnimations[i]->GetValueFraction() != serialAnimations[i]->GetValueFraction()) {
+            std::cout << "Batched animation " << i << " differs from the serial one" << std::endl;
+            return;
+        }
+    }
+    std::cout << "Animations " << ANIMATION_COUNT << " x " << FRAME_COUNT << " frames: serial " << serialTime
+              << "us, batched " << batchTime << "us, batched on 4 threads " << parallelTime << "us" << std::endl;
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+
+#include "perf_benchmark.h"
+#include "pipeline/rs_base_render_util.h"
+#include "surface_buffer_impl.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+sptr<SurfaceBuffer> CreatePatternBuffer(int32_t width, int32_t height, int32_t format)
+{
+    sptr<SurfaceBuffer> buffer = new SurfaceBufferImpl();
+    BufferRequestConfig requestConfig = {
+        .width = width,
+        .height = height,
+        .strideAlignment = 0x8,
+        .format = format,
+        .usage = BUFFER_USAGE_CPU_READ | BUFFER_USAGE_CPU_WRITE | BUFFER_USAGE_MEM_DMA,
+        .timeout = 0,
+        .colorGamut = GraphicColorGamut::GRAPHIC_COLOR_GAMUT_SRGB,
+    };
+    if (buffer->Alloc(requestConfig) != OHOS::GSERROR_OK || buffer->GetVirAddr() == nullptr) {
+        return nullptr;
+    }
+    auto addr = static_cast<uint8_t*>(buffer->GetVirAddr());
+    int32_t stride = buffer->GetStride();
+    if (format == GRAPHIC_PIXEL_FMT_YCBCR_420_SP || format == GRAPHIC_PIXEL_FMT_YCRCB_420_SP) {
+        for (int32_t i = 0; i < height; i++) {
+            for (int32_t j = 0; j < width; j++) {
+                addr[i * stride + j] = static_cast<uint8_t>(i * 7 + j * 3); // y pattern
+            }
+        }
+        uint8_t* uv = addr + stride * height;
+        for (int32_t i = 0; i < height / 2; i++) { // 2 rows share 1 uv row
+            for (int32_t j = 0; j < width; j++) {
+                uv[i * stride + j] = static_cast<uint8_t>(i * 5 + j * 11 + 64); // uv pattern
+            }
+        }
+        return buffer;
+    }
+    for (int32_t i = 0; i < height; i++) {
+        for (int32_t j = 0; j < width; j++) {
+            uint8_t* pixel = addr + i * stride + j * 4; // 4 bytes per pixel
+            pixel[0] = static_cast<uint8_t>(j * 4); // r pattern
+            pixel[1] = static_cast<uint8_t>(i * 4); // g pattern
+            pixel[2] = static_cast<uint8_t>((i + j) * 2); // b pattern
+            pixel[3] = 200; // alpha
+        }
+    }
+    return buffer;
+}
+} // namespace
+
+// converts 1080p and 4k buffers from YUV420SP to RGBA and from sRGB to Display P3
+PERF_BENCHMARK(ConvertBufferToBitmap)
+{
+    constexpr int rounds = 10;
+    std::vector<std::pair<int32_t, int32_t>> sizes = { { 1920, 1080 }, { 3840, 2160 } };
+    for (auto& [width, height] : sizes) {
+        for (int32_t format : { GRAPHIC_PIXEL_FMT_YCRCB_420_SP, GRAPHIC_PIXEL_FMT_RGBA_8888 }) {
+            bool isGamut = format == GRAPHIC_PIXEL_FMT_RGBA_8888;
+            auto buffer = CreatePatternBuffer(width, height, format);
+            if (buffer == nullptr) {
+                std::cout << "SurfaceBuffer alloc failed" << std::endl;
+                return;
+            }
+            std::vector<uint8_t> newBuffer;
+            Drawing::Bitmap bitmap;
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < rounds; i++) {
+                if (!RSBaseRenderUtil::ConvertBufferToBitmap(buffer, newBuffer,
+                    GraphicColorGamut::GRAPHIC_COLOR_GAMUT_DISPLAY_P3, bitmap)) {
+                    std::cout << "ConvertBufferToBitmap failed" << std::endl;
+                    return;
+                }
+            }
+            int64_t cost = PerfBenchmark::ElapsedUs(start);
+            std::cout << "ConvertBufferToBitmap " << (isGamut ? "gamut " : "yuv ") << width << "x" << height << ": "
+                      << cost / rounds << "us" << std::endl;
+        }
+    }
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+
+#include "perf_benchmark.h"
+#include "pipeline/rs_dirty_region_manager.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr int32_t SCREEN_WIDTH = 1260;
+constexpr int32_t SCREEN_HEIGHT = 2720;
+constexpr int32_t FRAME_COUNT = 600;
+constexpr int BUFFER_AGE = 3;
+
+// a clock ticking every second, a growing progress bar and a blinking cursor at 60 fps
+int64_t ReplayDirtyTrace(RSDirtyRegionManager& manager, int64_t& pixels)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int32_t frame = 0; frame < FRAME_COUNT; frame++) {
+        if (frame % 60 == 0) {
+            manager.MergeDirtyRect(RectI(1100, 60, 120, 40));
+        }
+        manager.MergeDirtyRect(RectI(100 + frame, 2600, 2, 8));
+        if (frame % 30 == 0) {
+            manager.MergeDirtyRect(RectI(600, 1200, 3, 40));
+        }
+        manager.SetBufferAge(BUFFER_AGE);
+        manager.UpdateDirty();
+        for (const auto& rect : manager.GetDirtyRegionRectsFlipWithinSurface()) {
+            pixels += static_cast<int64_t>(rect.width_) * rect.height_;
+        }
+        manager.Clear();
+    }
+    return PerfBenchmark::ElapsedUs(start);
+}
+} // namespace
+
+// replays scattered small dirty rects and compares the pixels redrawn by tiles and by bound
+PERF_BENCHMARK(DirtyTileReplay)
+{
+    RSDirtyRegionManager boundManager(true);
+    boundManager.isTileDirtyEnabled_ = false;
+    boundManager.SetSurfaceSize(SCREEN_WIDTH, SCREEN_HEIGHT);
+    RSDirtyRegionManager tileManager(true);
+    tileManager.isTileDirtyEnabled_ = true;
+    tileManager.dirtyTilesHistory_.resize(tileManager.HISTORY_QUEUE_MAX_SIZE);
+    tileManager.SetSurfaceSize(SCREEN_WIDTH, SCREEN_HEIGHT);
+    int64_t boundPixels = 0;
+    int64_t tilePixels = 0;
+    int64_t boundTime = ReplayDirtyTrace(boundManager, boundPixels);
+    int64_t tileTime = ReplayDirtyTrace(tileManager, tilePixels);
+    std::cout << "DirtyTileReplay " << FRAME_COUNT << " frames: bound " << boundPixels << " pixels in " << boundTime
+              << "us, tiles " << tilePixels << " pixels in " << tileTime << "us" << std::endl;
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <iostream>
+
+#include "animation/rs_cubic_bezier_interpolator.h"
+#include "animation/rs_interpolator_cache.h"
+#include "animation/rs_spring_interpolator.h"
+#include "perf_benchmark.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr int SAMPLE_COUNT = 1000000;
+constexpr int INIT_COUNT = 1000;
+
+int64_t SampleCurve(const RSInterpolator& interpolator, float& sum)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < SAMPLE_COUNT; i++) {
+        sum += interpolator.InterpolateImpl(static_cast<float>(i) / SAMPLE_COUNT);
+    }
+    return PerfBenchmark::ElapsedUs(start);
+}
+} // namespace
+
+// samples cubic bezier and spring curves analytically and from their tables
+PERF_BENCHMARK(InterpolatorCache)
+{
+    float analyticSum = 0.0f;
+    float tableSum = 0.0f;
+    RSCubicBezierInterpolator cubicBezier(0.42f, 0.0f, 0.58f, 1.0f);
+    RSCubicBezierInterpolator analyticCubicBezier(0.42f, 0.0f, 0.58f, 1.0f);
+    analyticCubicBezier.table_ = nullptr;
+    int64_t analyticTime = SampleCurve(analyticCubicBezier, analyticSum);
+    int64_t tableTime = SampleCurve(cubicBezier, tableSum);
+    std::cout << "CubicBezier " << SAMPLE_COUNT << " samples: analytic " << analyticTime << "us, table " << tableTime
+              << "us, mean difference " << std::fabs(tableSum - analyticSum) / SAMPLE_COUNT << std::endl;
+
+    analyticSum = 0.0f;
+    tableSum = 0.0f;
+    RSSpringInterpolator spring(0.55f, 0.825f, 0.0f);
+    RSSpringInterpolator analyticSpring(0.55f, 0.825f, 0.0f);
+    analyticSpring.table_ = std::make_shared<RSInterpolatorTable>([](float) { return NAN; });
+    analyticTime = SampleCurve(analyticSpring, analyticSum);
+    tableTime = SampleCurve(spring, tableSum);
+    std::cout << "Spring " << SAMPLE_COUNT << " samples: analytic " << analyticTime << "us, table " << tableTime
+              << "us, mean difference " << std::fabs(tableSum - analyticSum) / SAMPLE_COUNT << std::endl;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < INIT_COUNT; i++) {
+        RSSpringInterpolator uncached(0.55f, 0.825f, static_cast<float>(i));
+    }
+    int64_t uncachedTime = PerfBenchmark::ElapsedUs(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < INIT_COUNT; i++) {
+        RSSpringInterpolator cached(0.55f, 0.825f, 0.0f);
+    }
+    int64_t cachedTime = PerfBenchmark::ElapsedUs(start);
+    std::cout << "Spring " << INIT_COUNT << " constructions: new curve " << uncachedTime << "us, cached curve "
+              << cachedTime << "us" << std::endl;
+}
+} // namespace Rosen
+} // namespace OHOS
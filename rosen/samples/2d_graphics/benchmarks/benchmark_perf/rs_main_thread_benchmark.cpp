@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+
+#include "params/rs_surface_render_params.h"
+#include "perf_benchmark.h"
+#include "pipeline/rs_main_thread.h"
+#include "pipeline/rs_surface_render_node.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr int REPLAY_COUNT = 50;
+
+std::vector<RSBaseRenderNode::SharedPtr> CreateSurfaces(const std::shared_ptr<RSContext>& context, uint32_t count)
+{
+    // cascaded windows of a free-window desktop, the first one is the bottom
+    constexpr int32_t stepX = 37;
+    constexpr int32_t stepY = 23;
+    constexpr int32_t rangeX = 1600;
+    constexpr int32_t rangeY = 900;
+    constexpr int32_t width = 400;
+    constexpr int32_t height = 300;
+    std::vector<RSBaseRenderNode::SharedPtr> surfaces;
+    for (uint32_t i = 0; i < count; i++) {
+        NodeId id = i + 1;
+        auto node = std::make_shared<RSSurfaceRenderNode>(id, context);
+        node->stagingRenderParams_ = std::make_unique<RSSurfaceRenderParams>(id);
+        RectI rect = RectI(static_cast<int32_t>(i) * stepX % rangeX, static_cast<int32_t>(i) * stepY % rangeY,
+            width, height);
+        node->oldDirtyInSurface_ = rect;
+        node->SetDstRect(rect);
+        node->opaqueRegion_ = Occlusion::Region(rect);
+        surfaces.emplace_back(node);
+    }
+    return surfaces;
+}
+
+void MoveSurface(const RSBaseRenderNode::SharedPtr& node, int32_t offset)
+{
+    auto surface = RSBaseRenderNode::ReinterpretCast<RSSurfaceRenderNode>(node);
+    RectI rect = surface->GetDstRect().Offset(offset, offset);
+    surface->oldDirtyInSurface_ = rect;
+    surface->SetDstRect(rect);
+    surface->opaqueRegion_ = Occlusion::Region(rect);
+}
+} // namespace
+
+// occlusion from scratch against reusing the surfaces above the changed one
+PERF_BENCHMARK(MainThreadCalcOcclusion)
+{
+    auto mainThread = RSMainThread::Instance();
+    auto isUniRender = mainThread->isUniRender_;
+    mainThread->isUniRender_ = true;
+    for (uint32_t surfaceCount : { 50, 100, 200 }) {
+        auto curAllSurfaces = CreateSurfaces(mainThread->context_, surfaceCount);
+        VisibleData dstCurVisVec;
+        std::map<NodeId, RSVisibleLevel> dstPidVisMap;
+        // the focused window in the middle of the stack is moved every frame
+        auto& movedSurface = curAllSurfaces[surfaceCount / 2];
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < REPLAY_COUNT; i++) {
+            mainThread->occlusionCaches_.clear();
+            MoveSurface(movedSurface, i % 2 == 0 ? 1 : -1);
+            dstCurVisVec.clear();
+            mainThread->CalcOcclusionImplementation(nullptr, curAllSurfaces, dstCurVisVec, dstPidVisMap);
+        }
+        int64_t fullTime = PerfBenchmark::ElapsedUs(start) / REPLAY_COUNT;
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < REPLAY_COUNT; i++) {
+            MoveSurface(movedSurface, i % 2 == 0 ? 1 : -1);
+            dstCurVisVec.clear();
+            mainThread->CalcOcclusionImplementation(nullptr, curAllSurfaces, dstCurVisVec, dstPidVisMap);
+        }
+        int64_t incrementalTime = PerfBenchmark::ElapsedUs(start) / REPLAY_COUNT;
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < REPLAY_COUNT; i++) {
+            dstCurVisVec.clear();
+            mainThread->CalcOcclusionImplementation(nullptr, curAllSurfaces, dstCurVisVec, dstPidVisMap);
+        }
+        int64_t unchangedTime = PerfBenchmark::ElapsedUs(start) / REPLAY_COUNT;
+        std::cout << "CalcOcclusionImplementation " << surfaceCount << " surfaces: full " << fullTime
+                  << "us, middle surface changed " << incrementalTime << "us, unchanged " << unchangedTime << "us"
+                  << std::endl;
+    }
+    mainThread->occlusionCaches_.clear();
+    mainThread->isUniRender_ = isUniRender;
+}
+} // namespace Rosen
+} // namespace OHOS
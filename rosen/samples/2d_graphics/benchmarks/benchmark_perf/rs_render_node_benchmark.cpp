@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+
+#include "drawable/rs_drawable.h"
+#include "params/rs_render_params.h"
+#include "perf_benchmark.h"
+#include "pipeline/rs_render_node.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+// the children part of RSRenderNode::ApplyModifiers()
+void UpdateChildren(RSRenderNode& node)
+{
+    if (!node.isFullChildrenListValid_) {
+        node.GenerateFullChildrenList();
+    } else if (!node.appendedChildren_.empty()) {
+        node.AppendFullChildrenList();
+    }
+    for (auto& child : *node.GetSortedChildren()) {
+        UpdateChildren(*child);
+    }
+}
+
+int Traverse(const RSRenderNode& node)
+{
+    int visited = 1;
+    for (auto& child : *node.GetSortedChildren()) {
+        if (child->GetRenderProperties().GetPositionZ() >= 0.0f) {
+            visited += Traverse(*child);
+        }
+    }
+    return visited;
+}
+
+ModifierDirtyTypes MakeDirtyTypes(std::initializer_list<RSModifierType> types)
+{
+    ModifierDirtyTypes dirtyTypes;
+    for (auto type : types) {
+        dirtyTypes.set(static_cast<size_t>(type));
+    }
+    return dirtyTypes;
+}
+} // namespace
+
+// builds a tree of 20k nodes, generates the children lists and traverses it
+PERF_BENCHMARK(RenderNodePrepareTraversal)
+{
+    constexpr int firstLevelCount = 100;
+    constexpr int secondLevelCount = 199;
+    constexpr int traversalCount = 20;
+
+    NodeId id = 0;
+    auto start = std::chrono::steady_clock::now();
+    auto root = std::make_shared<RSRenderNode>(id++);
+    std::vector<std::shared_ptr<RSRenderNode>> nodes;
+    for (int i = 0; i < firstLevelCount; i++) {
+        auto firstLevel = std::make_shared<RSRenderNode>(id++);
+        root->AddChild(firstLevel);
+        nodes.emplace_back(firstLevel);
+        for (int j = 0; j < secondLevelCount; j++) {
+            auto secondLevel = std::make_shared<RSRenderNode>(id++);
+            firstLevel->AddChild(secondLevel);
+            nodes.emplace_back(secondLevel);
+        }
+    }
+    int64_t buildTime = PerfBenchmark::ElapsedUs(start);
+    start = std::chrono::steady_clock::now();
+    UpdateChildren(*root);
+    int64_t updateTime = PerfBenchmark::ElapsedUs(start);
+    int visited = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < traversalCount; i++) {
+        visited += Traverse(*root);
+    }
+    int64_t traverseTime = PerfBenchmark::ElapsedUs(start);
+    start = std::chrono::steady_clock::now();
+    root->SetIsOnTheTree(true);
+    root->SetIsOnTheTree(false);
+    int64_t onTreeTime = PerfBenchmark::ElapsedUs(start);
+    std::cout << "RenderNodePrepareTraversal " << id << " nodes: build " << buildTime << "us, generate children lists "
+              << updateTime << "us, " << traversalCount << " traversals of " << visited / traversalCount << " nodes "
+              << traverseTime << "us, on/off tree " << onTreeTime << "us" << std::endl;
+
+    // append one child at a time to a node with many children, once inserted and once generated again
+    auto parent = nodes.front();
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < secondLevelCount; i++) {
+        parent->AddChild(std::make_shared<RSRenderNode>(id++));
+        UpdateChildren(*parent);
+    }
+    int64_t appendTime = PerfBenchmark::ElapsedUs(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < secondLevelCount; i++) {
+        parent->AddChild(std::make_shared<RSRenderNode>(id++));
+        parent->isFullChildrenListValid_ = false;
+        UpdateChildren(*parent);
+    }
+    int64_t generateTime = PerfBenchmark::ElapsedUs(start);
+    std::cout << "RenderNodePrepareTraversal " << secondLevelCount << " appended children: inserted " << appendTime
+              << "us, generated " << generateTime << "us" << std::endl;
+}
+
+// updates the drawables of 10k nodes with the dirty modifier types of common animations
+PERF_BENCHMARK(RenderNodeUpdateDrawableVec)
+{
+    constexpr int nodeCount = 10000;
+    constexpr int frameCount = 20;
+    // translate or alpha animations, background color changes and layout changes
+    const std::vector<ModifierDirtyTypes> dirtyTypesList = {
+        MakeDirtyTypes({ RSModifierType::TRANSLATE }),
+        MakeDirtyTypes({ RSModifierType::ALPHA }),
+        MakeDirtyTypes({ RSModifierType::BACKGROUND_COLOR }),
+        MakeDirtyTypes({ RSModifierType::BOUNDS, RSModifierType::FRAME }),
+        MakeDirtyTypes({ RSModifierType::BOUNDS, RSModifierType::CORNER_RADIUS, RSModifierType::BORDER_WIDTH,
+            RSModifierType::BORDER_COLOR }),
+    };
+
+    std::vector<std::shared_ptr<RSRenderNode>> nodes;
+    for (int i = 0; i < nodeCount; i++) {
+        auto node = std::make_shared<RSRenderNode>(i + 1);
+        auto& properties = node->GetMutableRenderProperties();
+        properties.SetBounds({ 0, 0, 100, 100 });
+        properties.SetBackgroundColor(Color(0xFF, 0, 0));
+        if (i % 2 == 0) {
+            properties.SetBorderWidth(Vector4f(1.0f));
+            properties.SetBorderColor(Vector4<Color>(Color(0, 0, 0xFF)));
+        }
+        node->stagingRenderParams_ = std::make_unique<RSRenderParams>(i + 1);
+        node->dirtyTypes_ = dirtyTypesList[2];
+        node->UpdateDrawableVecV2();
+        node->dirtySlots_.reset();
+        nodes.emplace_back(node);
+    }
+
+    size_t dirtySlotCount = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frameCount; frame++) {
+        for (int i = 0; i < nodeCount; i++) {
+            auto& node = nodes[i];
+            dirtySlotCount += RSDrawable::CalculateDirtySlots(
+                dirtyTypesList[(i + frame) % dirtyTypesList.size()], node->drawableVec_).count();
+        }
+    }
+    int64_t calculateTime = PerfBenchmark::ElapsedUs(start);
+    start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frameCount; frame++) {
+        for (int i = 0; i < nodeCount; i++) {
+            auto& node = nodes[i];
+            node->dirtyTypes_ = dirtyTypesList[(i + frame) % dirtyTypesList.size()];
+            node->UpdateDrawableVecV2();
+            node->dirtySlots_.reset();
+        }
+    }
+    int64_t updateTime = PerfBenchmark::ElapsedUs(start);
+    std::cout << "RenderNodeUpdateDrawableVec " << nodeCount << " nodes x " << frameCount << " frames: "
+              << dirtySlotCount << " dirty slots, CalculateDirtySlots " << calculateTime << "us, UpdateDrawableVecV2 "
+              << updateTime << "us" << std::endl;
+}
+} // namespace Rosen
+} // namespace OHOS
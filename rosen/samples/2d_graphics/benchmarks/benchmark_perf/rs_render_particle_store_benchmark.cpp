@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+
+#include "animation/rs_render_particle_store.h"
+#include "animation/rs_render_particle_system.h"
+#include "perf_benchmark.h"
+#include "render/rs_particles_drawable.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+std::shared_ptr<ParticleRenderParams> CreateParams(int64_t lifeTime, int particleCount)
+{
+    int emitRate = 1000;
+    Vector2f position = Vector2f(0.f, 0.f);
+    Vector2f emitSize = Vector2f(500.f, 500.f);
+    Range<int64_t> lifeTimeRange = Range<int64_t>(lifeTime, lifeTime);
+    std::shared_ptr<RSImage> image;
+    Vector2f imageSize = Vector2f(1.f, 1.f);
+    EmitterConfig emitterConfig = EmitterConfig(emitRate, ShapeType::RECT, position, emitSize, particleCount,
+        lifeTimeRange, ParticleType::POINTS, 1.f, image, imageSize);
+    ParticleVelocity velocity(Range<float>(10.f, 50.f), Range<float>(0.f, 360.f));
+    std::vector<std::shared_ptr<ChangeInOverLife<float>>> noChange;
+    RenderParticleAcceleration acceleration(
+        RenderParticleParaType<float>(Range<float>(1.f, 5.f), ParticleUpdator::RANDOM, Range<float>(0.1f, 1.f),
+            noChange),
+        RenderParticleParaType<float>(Range<float>(0.f, 90.f), ParticleUpdator::NONE, Range<float>(), noChange));
+    std::vector<std::shared_ptr<ChangeInOverLife<Color>>> noColorChange;
+    RenderParticleColorParaType color(Range<Color>(RSColor(100, 0, 0, 100), RSColor(255, 255, 255, 255)),
+        DistributionType::UNIFORM, ParticleUpdator::RANDOM, Range<float>(1.f, 10.f), Range<float>(1.f, 10.f),
+        Range<float>(1.f, 10.f), Range<float>(1.f, 10.f), noColorChange);
+    RenderParticleParaType<float> opacity(
+        Range<float>(0.5f, 1.f), ParticleUpdator::RANDOM, Range<float>(-0.1f, 0.1f), noChange);
+    RenderParticleParaType<float> scale(
+        Range<float>(0.5f, 1.f), ParticleUpdator::RANDOM, Range<float>(0.1f, 0.5f), noChange);
+    RenderParticleParaType<float> spin(
+        Range<float>(0.f, 90.f), ParticleUpdator::RANDOM, Range<float>(10.f, 20.f), noChange);
+    return std::make_shared<ParticleRenderParams>(emitterConfig, velocity, acceleration, color, opacity, scale, spin);
+}
+} // namespace
+
+// updates and draws 10k and 100k particles, one by one and as a store
+PERF_BENCHMARK(ParticleStore)
+{
+    constexpr int frames = 30;
+    int64_t deltaTime = NS_TO_S / 60; // 60 frames per second
+    for (int count : { 10000, 100000 }) {
+        auto params = CreateParams(100000, count); // 100000 is lifeTime
+        std::vector<std::shared_ptr<RSRenderParticle>> particles;
+        auto store = std::make_shared<RSRenderParticleStore>(params);
+        store->Reserve(count);
+        for (int i = 0; i < count; i++) {
+            auto particle = std::make_shared<RSRenderParticle>(params);
+            store->Add(*particle);
+            particles.push_back(particle);
+        }
+        RSRenderParticleEffector effector;
+        auto bounds = std::make_shared<RectF>(0.f, 0.f, 1000.f, 1000.f);
+        std::vector<std::shared_ptr<RSImage>> imageVector;
+        Drawing::Canvas canvas;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; frame++) {
+            for (auto& particle : particles) {
+                effector.Update(particle, nullptr, deltaTime);
+            }
+            RSParticlesDrawable(particles, imageVector, 0).Draw(canvas, bounds);
+        }
+        int64_t particleTime = PerfBenchmark::ElapsedUs(start);
+
+        start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; frame++) {
+            effector.Update(*store, nullptr, deltaTime);
+            RSParticlesDrawable({}, { store }, imageVector, 0).Draw(canvas, bounds);
+        }
+        int64_t storeTime = PerfBenchmark::ElapsedUs(start);
+        std::cout << "Particles " << count << " x " << frames << " frames: per particle " << particleTime
+                  << "us, store " << storeTime << "us" << std::endl;
+    }
+}
+} // namespace Rosen
+} // namespace OHOS
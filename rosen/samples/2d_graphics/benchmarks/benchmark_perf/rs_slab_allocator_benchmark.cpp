@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+
+#include "memory/rs_slab_allocator.h"
+#include "perf_benchmark.h"
+#include "pipeline/rs_canvas_render_node.h"
+#include "pipeline/rs_render_node_gc.h"
+
+namespace OHOS {
+namespace Rosen {
+// creates and releases render nodes through RSRenderNodeGC as list scrolling does
+PERF_BENCHMARK(SlabAllocatorNodeChurn)
+{
+    constexpr int rounds = 100;
+    constexpr int nodesPerRound = 500;
+    std::vector<std::shared_ptr<RSRenderNode>> nodes;
+    nodes.reserve(nodesPerRound);
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        for (int i = 0; i < nodesPerRound; i++) {
+            NodeId id = static_cast<NodeId>(round * nodesPerRound + i + 1);
+            nodes.emplace_back(new RSCanvasRenderNode(id), RSRenderNodeGC::NodeDestructor);
+        }
+        nodes.clear();
+        while (!RSRenderNodeGC::Instance().nodeBucket_.empty()) {
+            RSRenderNodeGC::Instance().ReleaseNodeBucket();
+        }
+    }
+    int64_t time = PerfBenchmark::ElapsedUs(start);
+    std::cout << "NodeChurn " << rounds * nodesPerRound << " nodes: " << time << "us, slabs "
+              << RSRenderNode::GetAllocator().GetSlabCount() << std::endl;
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+
+#include "command/rs_base_node_command.h"
+#include "command/rs_node_command.h"
+#include "perf_benchmark.h"
+#include "transaction/rs_transaction_data.h"
+
+namespace OHOS {
+namespace Rosen {
+// the per-command decode cost of a large transaction parcel
+PERF_BENCHMARK(TransactionDataUnmarshalling)
+{
+    constexpr uint64_t commandCount = 10000;
+    constexpr int replayCount = 20;
+    RSTransactionData rsTransactionData;
+    for (uint64_t i = 0; i < commandCount; i++) {
+        NodeId nodeId = i + 1;
+        rsTransactionData.AddCommand(std::make_unique<RSUpdatePropertyFloat>(nodeId, 1.0f, i, UPDATE_TYPE_OVERWRITE),
+            nodeId, FollowType::NONE);
+        rsTransactionData.AddCommand(std::make_unique<RSBaseNodeAddChild>(nodeId, nodeId + 1, -1),
+            nodeId, FollowType::NONE);
+    }
+    Parcel parcel;
+    if (!rsTransactionData.Marshalling(parcel)) {
+        std::cout << "RSTransactionData marshalling failed" << std::endl;
+        return;
+    }
+    size_t marshaledCount = rsTransactionData.GetMarshallingIndex();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < replayCount; i++) {
+        parcel.RewindRead(0);
+        std::unique_ptr<RSTransactionData> transactionData(RSTransactionData::Unmarshalling(parcel));
+        if (transactionData == nullptr || transactionData->GetCommandCount() != marshaledCount) {
+            std::cout << "RSTransactionData unmarshalling failed" << std::endl;
+            return;
+        }
+    }
+    int64_t totalTime = PerfBenchmark::ElapsedUs(start) * 1000; // 1000: ns per us
+    std::cout << "RSTransactionData unmarshalling " << marshaledCount << " commands x " << replayCount << ": "
+              << totalTime / (static_cast<int64_t>(marshaledCount) * replayCount) << "ns per command" << std::endl;
+}
+
+// parcel size and decode time of an animation frame with and without delta blocks
+PERF_BENCHMARK(TransactionDataMergePropertyUpdate)
+{
+    constexpr uint64_t nodeCount = 500;
+    constexpr uint64_t propertyCount = 8;
+    constexpr int replayCount = 20;
+    // a FollowType change between updates prevents the merge, so both frames carry the same updates
+    RSTransactionData mergedData;
+    RSTransactionData separatedData;
+    for (uint64_t i = 0; i < nodeCount; i++) {
+        NodeId nodeId = i + 1;
+        for (uint64_t j = 0; j < propertyCount; j++) {
+            PropertyId id = i * propertyCount + j;
+            mergedData.AddCommand(std::make_unique<RSUpdatePropertyFloat>(nodeId, 1.0f, id, UPDATE_TYPE_OVERWRITE),
+                nodeId, FollowType::NONE);
+            separatedData.AddCommand(std::make_unique<RSUpdatePropertyFloat>(nodeId, 1.0f, id, UPDATE_TYPE_OVERWRITE),
+                nodeId, j % 2 == 0 ? FollowType::NONE : FollowType::FOLLOW_TO_PARENT);
+        }
+    }
+
+    auto measure = [](RSTransactionData& data, size_t& parcelSize) -> int64_t {
+        Parcel parcel;
+        if (!data.Marshalling(parcel)) {
+            return -1;
+        }
+        parcelSize = parcel.GetDataSize();
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < replayCount; i++) {
+            parcel.RewindRead(0);
+            std::unique_ptr<RSTransactionData> transactionData(RSTransactionData::Unmarshalling(parcel));
+            if (transactionData == nullptr) {
+                return -1;
+            }
+        }
+        return PerfBenchmark::ElapsedUs(start) / replayCount;
+    };
+    size_t mergedSize = 0;
+    size_t separatedSize = 0;
+    int64_t mergedTime = measure(mergedData, mergedSize);
+    int64_t separatedTime = measure(separatedData, separatedSize);
+    if (mergedTime < 0 || separatedTime < 0) {
+        std::cout << "RSTransactionData marshalling or unmarshalling failed" << std::endl;
+        return;
+    }
+    std::cout << "RSTransactionData " << nodeCount * propertyCount << " property updates: separated "
+              << separatedSize << " bytes " << separatedTime << "us, delta block " << mergedSize << " bytes "
+              << mergedTime << "us" << std::endl;
+}
+} // namespace Rosen
+} // namespace OHOS
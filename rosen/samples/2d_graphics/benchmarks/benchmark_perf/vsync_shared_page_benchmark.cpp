@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fcntl.h>
+#include <iostream>
+#include <unistd.h>
+
+#include "perf_benchmark.h"
+#include "vsync_controller.h"
+#include "vsync_distributor.h"
+#include "vsync_generator.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr int32_t ROUNDS = 200;
+
+void Drain(const std::vector<int32_t>& fds)
+{
+    int64_t data[3];
+    for (int32_t fd : fds) {
+        while (read(fd, data, sizeof(data)) > 0) {
+        }
+    }
+}
+
+bool CreateConnections(const sptr<VSyncDistributor>& distributor, int32_t count, bool isShared,
+    std::vector<sptr<VSyncConnection>>& conns, std::vector<int32_t>& fds)
+{
+    for (int32_t i = 0; i < count; i++) {
+        sptr<VSyncConnection> conn = new VSyncConnection(distributor, "PostVSyncEventBenchmark");
+        int32_t fd = -1;
+        if (isShared) {
+            int32_t pageFd = -1;
+            if (conn->GetSharedPage(pageFd, fd) != VSYNC_ERROR_OK) {
+                return false;
+            }
+            close(pageFd);
+            if (conn->SetSharedPageEnabled(true) != VSYNC_ERROR_OK) {
+                close(fd);
+                return false;
+            }
+        } else {
+            if (conn->GetReceiveFd(fd) != VSYNC_ERROR_OK) {
+                return false;
+            }
+            fcntl(fd, F_SETFL, O_NONBLOCK);
+        }
+        conns.push_back(conn);
+        fds.push_back(fd);
+    }
+    return true;
+}
+} // namespace
+
+// posts vsync events to 1, 10 and 100 connections through the socket and the shared page
+PERF_BENCHMARK(PostVSyncEvent)
+{
+    sptr<VSyncGenerator> generator = CreateVSyncGenerator();
+    sptr<VSyncController> controller = new VSyncController(generator, 0);
+    sptr<VSyncDistributor> distributor = new VSyncDistributor(controller, "PostVSyncEventBenchmark");
+    for (int32_t count : { 1, 10, 100 }) {
+        for (bool isShared : { false, true }) {
+            distributor->isSharedPageEnabled_ = isShared;
+            std::vector<sptr<VSyncConnection>> conns;
+            std::vector<int32_t> fds;
+            bool created = CreateConnections(distributor, count, isShared, conns, fds);
+            int64_t cost = 0;
+            for (int32_t round = 0; created && round < ROUNDS; round++) {
+                auto start = std::chrono::steady_clock::now();
+                distributor->PostVSyncEvent(conns, round + 1, false);
+                cost += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+                // receivers consume every event, so the socket never takes the EAGAIN path
+                Drain(fds);
+            }
+            if (isShared) {
+                for (int32_t fd : fds) {
+                    close(fd);
+                }
+            }
+            if (!created) {
+                std::cout << "VSyncConnection create failed" << std::endl;
+                break;
+            }
+            std::cout << "PostVSyncEvent " << (isShared ? "shared page" : "socket") << " connections: " << count
+                      << " cost: " << cost / ROUNDS << "ns" << std::endl;
+        }
+    }
+    distributor = nullptr;
+    controller = nullptr;
+    generator = nullptr;
+    DestroyVSyncGenerator();
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "font_collection.h"
+#include "paragraph_builder.h"
+#include "paragraph_impl.h"
+#include "paragraph_layout_cache.h"
+#include "paragraph_style.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::Rosen;
+using namespace OHOS::Rosen::SPText;
+
+namespace txt {
+class ParagraphLayoutCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    static std::unique_ptr<Paragraph> CreateParagraph(const std::u16string& text, double fontSize);
+    static inline std::shared_ptr<FontCollection> fontCollection_ = nullptr;
+};
+
+void ParagraphLayoutCacheTest::SetUpTestCase()
+{
+    fontCollection_ = std::make_shared<FontCollection>();
+    fontCollection_->SetupDefaultFontManager();
+}
+
+void ParagraphLayoutCacheTest::TearDownTestCase()
+{
+    ParagraphLayoutCache::Instance().SetBudget(ParagraphLayoutCache::DEFAULT_BUDGET);
+    ParagraphLayoutCache::Instance().Clear();
+    fontCollection_ = nullptr;
+}
+
+void ParagraphLayoutCacheTest::SetUp()
+{
+    ParagraphLayoutCache::Instance().SetBudget(ParagraphLayoutCache::DEFAULT_BUDGET);
+    ParagraphLayoutCache::Instance().Clear();
+}
+
+std::unique_ptr<Paragraph> ParagraphLayoutCacheTest::CreateParagraph(const std::u16string& text, double fontSize)
+{
+    ParagraphStyle paragraphStyle;
+    std::unique_ptr<ParagraphBuilder> builder = ParagraphBuilder::Create(paragraphStyle, fontCollection_);
+    TextStyle textStyle;
+    textStyle.fontSize = fontSize;
+    builder->PushStyle(textStyle);
+    builder->AddText(text);
+    builder->Pop();
+    return builder->Build();
+}
+
+/*
+ * @tc.name: ParagraphLayoutCacheTest001
+ * @tc.desc: test that an equal paragraph laid out at the same width reuses the cached layout
+ * @tc.type: FUNC
+ */
+HWTEST_F(ParagraphLayoutCacheTest, ParagraphLayoutCacheTest001, TestSize.Level1)
+{
+    auto& cache = ParagraphLayoutCache::Instance();
+    auto misses = cache.GetStatistics().misses;
+    // 200 and 16 just for test
+    auto first = CreateParagraph(u"layout cache test text", 16);
+    ASSERT_NE(first, nullptr);
+    first->Layout(200);
+    auto statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.entries, 1);
+    EXPECT_EQ(statistics.misses, misses + 1);
+
+    auto second = CreateParagraph(u"layout cache test text", 16);
+    ASSERT_NE(second, nullptr);
+    second->Layout(200);
+    EXPECT_EQ(cache.GetStatistics().hits, statistics.hits + 1);
+    EXPECT_EQ(second->GetLineCount(), first->GetLineCount());
+    EXPECT_EQ(second->GetHeight(), first->GetHeight());
+    EXPECT_EQ(second->GetLongestLine(), first->GetLongestLine());
+    EXPECT_EQ(second->GetMaxIntrinsicWidth(), first->GetMaxIntrinsicWidth());
+
+    // laying out again at the same width does not go to the cache
+    second->Layout(200);
+    EXPECT_EQ(cache.GetStatistics().hits, statistics.hits + 1);
+}
+
+/*
+ * @tc.name: ParagraphLayoutCacheTest002
+ * @tc.desc: test that different widths, styles and texts do not share layouts
+ * @tc.type: FUNC
+ */
+HWTEST_F(ParagraphLayoutCacheTest, ParagraphLayoutCacheTest002, TestSize.Level1)
+{
+    auto& cache = ParagraphLayoutCache::Instance();
+    auto hits = cache.GetStatistics().hits;
+    // 100, 200 and 16, 20 just for test
+    auto paragraph = CreateParagraph(u"layout cache test text", 16);
+    paragraph->Layout(200);
+    paragraph->Layout(100);
+    CreateParagraph(u"layout cache test text", 20)->Layout(200);
+    CreateParagraph(u"layout cache text", 16)->Layout(200);
+    auto statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.hits, hits);
+    EXPECT_EQ(statistics.entries, 4);
+
+    // changed paragraphs are neither looked up nor stored
+    paragraph->UpdateFontSize(0, 1, 30);
+    paragraph->Layout(150);
+    EXPECT_EQ(cache.GetStatistics().entries, 4);
+    EXPECT_EQ(cache.GetStatistics().misses, statistics.misses);
+}
+
+/*
+ * @tc.name: ParagraphLayoutCacheTest003
+ * @tc.desc: test that the cache stays within its budget and can be cleared
+ * @tc.type: FUNC
+ */
+HWTEST_F(ParagraphLayoutCacheTest, ParagraphLayoutCacheTest003, TestSize.Level1)
+{
+    auto& cache = ParagraphLayoutCache::Instance();
+    cache.SetBudget(0);
+    // 200 and 16 just for test
+    CreateParagraph(u"layout cache test text", 16)->Layout(200);
+    EXPECT_EQ(cache.GetStatistics().entries, 0);
+
+    cache.SetBudget(ParagraphLayoutCache::DEFAULT_BUDGET);
+    CreateParagraph(u"layout cache test text", 16)->Layout(200);
+    auto statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.entries, 1);
+    cache.SetBudget(statistics.bytes * ParagraphLayoutCache::SHARD_COUNT - 1);
+    EXPECT_EQ(cache.GetStatistics().entries, 0);
+    EXPECT_EQ(cache.GetStatistics().evictions, statistics.evictions + 1);
+
+    cache.SetBudget(ParagraphLayoutCache::DEFAULT_BUDGET);
+    CreateParagraph(u"layout cache test text", 16)->Layout(200);
+    fontCollection_->ClearFontFamilyCache();
+    EXPECT_EQ(cache.GetStatistics().entries, 0);
+}
+} // namespace txt
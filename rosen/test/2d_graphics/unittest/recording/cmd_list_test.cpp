@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "draw/path.h"
+#include "recording/draw_cmd_list.h"
+#include "recording/recording_canvas.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+namespace {
+constexpr int32_t CANVAS_WIDTH = 1000;
+constexpr int32_t CANVAS_HEIGHT = 1000;
+constexpr uint32_t TEST_MIXED_OP_COUNT = 10000;
+constexpr uint32_t TEST_MIXED_OP_KINDS = 5;
+
+void RecordMixedOps(RecordingCanvas& canvas)
+{
+    Path path;
+    path.MoveTo(0, 0);
+    path.LineTo(CANVAS_WIDTH, CANVAS_HEIGHT);
+    Brush brush(Color::COLOR_GREEN);
+    Pen pen(Color::COLOR_RED);
+    for (uint32_t i = 0; i < TEST_MIXED_OP_COUNT / TEST_MIXED_OP_KINDS; i++) {
+        float pos = static_cast<float>(i % CANVAS_WIDTH);
+        canvas.AttachBrush(brush);
+        canvas.DrawRect(Rect(pos, pos, pos + 10, pos + 10));
+        canvas.DrawCircle(Point(pos, pos), 5);
+        canvas.DetachBrush();
+        canvas.AttachPen(pen);
+        canvas.DrawLine(Point(0, pos), Point(CANVAS_WIDTH, pos));
+        canvas.DrawPath(path);
+        canvas.DetachPen();
+        canvas.DrawColor(Color::COLOR_WHITE);
+    }
+}
+} // namespace
+
+class CmdListTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+};
+
+void CmdListTest::SetUpTestCase() {}
+void CmdListTest::TearDownTestCase() {}
+void CmdListTest::SetUp() {}
+void CmdListTest::TearDown() {}
+
+/**
+ * @tc.name: OwnerThread001
+ * @tc.desc: Test binding and unbinding the owner thread of CmdList.
+ * @tc.type: FUNC
+ * @tc.require: I7SO7X
+ */
+HWTEST_F(CmdListTest, OwnerThread001, TestSize.Level1)
+{
+    auto drawCmdList = std::make_shared<DrawCmdList>(CANVAS_WIDTH, CANVAS_HEIGHT);
+    EXPECT_FALSE(drawCmdList->IsOwnerThreadBound());
+    drawCmdList->BindOwnerThread();
+    EXPECT_TRUE(drawCmdList->IsOwnerThreadBound());
+    drawCmdList->UnbindOwnerThread();
+    EXPECT_FALSE(drawCmdList->IsOwnerThreadBound());
+}
+
+/**
+ * @tc.name: OwnerThread002
+ * @tc.desc: Test that the ops recorded on the owner thread are the same as the ops recorded with locking.
+ * @tc.type: FUNC
+ * @tc.require: I7SO7X
+ */
+HWTEST_F(CmdListTest, OwnerThread002, TestSize.Level1)
+{
+    RecordingCanvas lockedCanvas(CANVAS_WIDTH, CANVAS_HEIGHT);
+    RecordMixedOps(lockedCanvas);
+
+    RecordingCanvas ownerCanvas(CANVAS_WIDTH, CANVAS_HEIGHT);
+    ownerCanvas.GetDrawCmdList()->BindOwnerThread();
+    RecordMixedOps(ownerCanvas);
+    ownerCanvas.GetDrawCmdList()->UnbindOwnerThread();
+
+    EXPECT_EQ(lockedCanvas.GetDrawCmdList()->GetOpItemSize(), ownerCanvas.GetDrawCmdList()->GetOpItemSize());
+    EXPECT_EQ(lockedCanvas.GetDrawCmdList()->GetOpDataSize(), ownerCanvas.GetDrawCmdList()->GetOpDataSize());
+}
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "recording/draw_cmd.h"
+#include "recording/draw_cmd_list.h"
+#include "recording/draw_op_arena.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+namespace {
+constexpr uint32_t TEST_OP_COUNT = 10000;
+
+std::shared_ptr<DrawCmdList> CreateTestCmdList()
+{
+    auto drawCmdList = std::make_shared<DrawCmdList>(10, 20);
+    for (uint32_t i = 0; i < TEST_OP_COUNT; i++) {
+        if (i % 2 == 0) {
+            drawCmdList->AddDrawOp<TranslateOpItem::ConstructorHandle>(1.0f, 1.0f);
+        } else {
+            drawCmdList->AddDrawOp<ClearOpItem::ConstructorHandle>(Color::COLOR_BLACK);
+        }
+    }
+    drawCmdList->FlattenOpData();
+    return drawCmdList;
+}
+} // namespace
+
+class DrawOpArenaTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+};
+
+void DrawOpArenaTest::SetUpTestCase() {}
+void DrawOpArenaTest::TearDownTestCase() {}
+void DrawOpArenaTest::SetUp() {}
+void DrawOpArenaTest::TearDown() {}
+
+/**
+ * @tc.name: Allocate001
+ * @tc.desc: Test that the memory from DrawOpArena is aligned and counted.
+ * @tc.type: FUNC
+ * @tc.require: I7SO7X
+ */
+HWTEST_F(DrawOpArenaTest, Allocate001, TestSize.Level1)
+{
+    DrawOpArena arena;
+    EXPECT_EQ(arena.Allocate(0, alignof(uint64_t)), nullptr);
+    void* first = arena.Allocate(1, 1);
+    ASSERT_TRUE(first != nullptr);
+    void* second = arena.Allocate(sizeof(uint64_t), alignof(uint64_t));
+    ASSERT_TRUE(second != nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(second) % alignof(uint64_t), 0);
+    EXPECT_EQ(arena.GetUsedSize(), 1 + sizeof(uint64_t));
+    EXPECT_EQ(arena.GetBlockCount(), 1);
+}
+
+/**
+ * @tc.name: Allocate002
+ * @tc.desc: Test that DrawOpArena adds blocks when the current one is full.
+ * @tc.type: FUNC
+ * @tc.require: I7SO7X
+ */
+HWTEST_F(DrawOpArenaTest, Allocate002, TestSize.Level1)
+{
+    DrawOpArena arena;
+    EXPECT_TRUE(arena.Allocate(DrawOpArena::DEFAULT_BLOCK_SIZE, alignof(uint64_t)) != nullptr);
+    EXPECT_TRUE(arena.Allocate(DrawOpArena::DEFAULT_BLOCK_SIZE, alignof(uint64_t)) != nullptr);
+    EXPECT_TRUE(arena.Allocate(DrawOpArena::MAX_BLOCK_SIZE * 2, alignof(uint64_t)) != nullptr);
+    EXPECT_EQ(arena.GetBlockCount(), 3);
+}
+
+/**
+ * @tc.name: Allocate003
+ * @tc.desc: Test that the first block follows the size hint and freed blocks are pooled up to the limit.
+ * @tc.type: FUNC
+ * @tc.require: I7SO7X
+ */
+HWTEST_F(DrawOpArenaTest, Allocate003, TestSize.Level1)
+{
+    DrawOpArena::PurgePool();
+    {
+        DrawOpArena arena(1);
+        EXPECT_TRUE(arena.Allocate(1, 1) != nullptr);
+        EXPECT_EQ(arena.GetBlockCount(), 1);
+    }
+    EXPECT_EQ(DrawOpArena::GetPooledBytes(), DrawOpArena::MIN_BLOCK_SIZE);
+
+    // Blocks released by another thread are reused by the next arena.
+    auto arena = std::make_shared<DrawOpArena>(DrawOpArena::MAX_BLOCK_SIZE);
+    EXPECT_TRUE(arena->Allocate(DrawOpArena::MAX_BLOCK_SIZE, 1) != nullptr);
+    std::thread([&arena]() { arena = nullptr; }).join();
+    EXPECT_EQ(DrawOpArena::GetPooledBytes(), DrawOpArena::MIN_BLOCK_SIZE + DrawOpArena::MAX_BLOCK_SIZE);
+
+    std::vector<std::unique_ptr<DrawOpArena>> arenas;
+    for (size_t i = 0; i <= DrawOpArena::MAX_POOLED_BYTES / DrawOpArena::MAX_BLOCK_SIZE; i++) {
+        arenas.push_back(std::make_unique<DrawOpArena>(DrawOpArena::MAX_BLOCK_SIZE));
+        EXPECT_TRUE(arenas.back()->Allocate(1, 1) != nullptr);
+    }
+    arenas.clear();
+    EXPECT_LE(DrawOpArena::GetPooledBytes(), DrawOpArena::MAX_POOLED_BYTES);
+    DrawOpArena::PurgePool();
+    EXPECT_EQ(DrawOpArena::GetPooledBytes(), 0);
+}
+
+/**
+ * @tc.name: AllocateShared001
+ * @tc.desc: Test that an object created by DrawOpArenaAllocator keeps the arena alive.
+ * @tc.type: FUNC
+ * @tc.require: I7SO7X
+ */
+HWTEST_F(DrawOpArenaTest, AllocateShared001, TestSize.Level1)
+{
+    auto arena = std::make_shared<DrawOpArena>();
+    auto op = std::allocate_shared<ClearOpItem>(DrawOpArenaAllocator<ClearOpItem>(arena), Color::COLOR_RED);
+    ASSERT_TRUE(op != nullptr);
+    EXPECT_GT(arena->GetUsedSize(), sizeof(ClearOpItem));
+    std::weak_ptr<DrawOpArena> weakArena = arena;
+    arena = nullptr;
+    EXPECT_FALSE(weakArena.expired());
+    EXPECT_EQ(op->GetType(), DrawOpItem::CLEAR_OPITEM);
+    op = nullptr;
+    EXPECT_TRUE(weakArena.expired());
+}
+
+/**
+ * @tc.name: UnmarshallingDrawOps001
+ * @tc.desc: Test that the ops unmarshalled in the arena are the same as the recorded ones.
+ * @tc.type: FUNC
+ * @tc.require: I7SO7X
+ */
+HWTEST_F(DrawOpArenaTest, UnmarshallingDrawOps001, TestSize.Level1)
+{
+    auto drawCmdList = CreateTestCmdList();
+    auto newDrawCmdList = DrawCmdList::CreateFromData(drawCmdList->GetData(), true);
+    ASSERT_TRUE(newDrawCmdList != nullptr);
+    newDrawCmdList->UnmarshallingDrawOps();
+    EXPECT_EQ(newDrawCmdList->GetOpItemSize(), TEST_OP_COUNT);
+    EXPECT_FALSE(newDrawCmdList->GetOpsWithDesc().empty());
+
+    // Ops created outside of UnmarshallingDrawOps are allocated on heap.
+    auto op = newDrawCmdList->MakeDrawOp<ClearOpItem>(Color::COLOR_RED);
+    ASSERT_TRUE(op != nullptr);
+    EXPECT_TRUE(newDrawCmdList->AddDrawOp(op));
+    EXPECT_EQ(newDrawCmdList->GetOpItemSize(), TEST_OP_COUNT + 1);
+}
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
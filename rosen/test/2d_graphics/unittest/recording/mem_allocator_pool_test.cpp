@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "recording/draw_cmd.h"
+#include "recording/draw_cmd_list.h"
+#include "recording/mem_allocator_pool.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+namespace {
+constexpr size_t TEST_BUFFER_SIZE = 3000;
+constexpr size_t TEST_SIZE_CLASS_SIZE = 4096;
+constexpr uint32_t TEST_OP_COUNT = 1000;
+} // namespace
+
+class MemAllocatorPoolTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+};
+
+void MemAllocatorPoolTest::SetUpTestCase() {}
+void MemAllocatorPoolTest::TearDownTestCase() {}
+void MemAllocatorPoolTest::SetUp()
+{
+    MemAllocatorPool::GetInstance().SetMaxRetainedBytes(MemAllocatorPool::DEFAULT_MAX_RETAINED_BYTES);
+    MemAllocatorPool::SetMaxProcessRetainedBytes(MemAllocatorPool::DEFAULT_MAX_PROCESS_RETAINED_BYTES);
+    MemAllocatorPool::GetInstance().Purge();
+}
+void MemAllocatorPoolTest::TearDown()
+{
+    MemAllocatorPool::GetInstance().Purge();
+}
+
+/**
+ * @tc.name: AcquireRelease001
+ * @tc.desc: Test that a released buffer is reused by the next request of the same size class.
+ * @tc.type: FUNC
+ * @tc.require: I7SO7X
+ */
+HWTEST_F(MemAllocatorPoolTest, AcquireRelease001, TestSize.Level1)
+{
+    auto& pool = MemAllocatorPool::GetInstance();
+    auto before = pool.GetStatistics();
+    size_t capacity = 0;
+    char* data = MemAllocatorPool::Acquire(TEST_BUFFER_SIZE, capacity);
+    ASSERT_TRUE(data != nullptr);
+    EXPECT_EQ(capacity, TEST_SIZE_CLASS_SIZE);
+    MemAllocatorPool::Release(data, capacity);
+    EXPECT_EQ(pool.GetStatistics().retainedBytes, TEST_SIZE_CLASS_SIZE);
+
+    size_t newCapacity = 0;
+    char* newData = MemAllocatorPool::Acquire(TEST_BUFFER_SIZE, newCapacity);
+    EXPECT_EQ(newData, data);
+    EXPECT_EQ(newCapacity, capacity);
+    auto after = pool.GetStatistics();
+    EXPECT_EQ(after.hitCount, before.hitCount + 1);
+    EXPECT_EQ(after.missCount, before.missCount + 1);
+    EXPECT_EQ(after.retainedBytes, 0);
+    MemAllocatorPool::Release(newData, newCapacity);
+}
+
+/**
+ * @tc.name: MaxRetainedBytes001
+ * @tc.desc: Test that the pool never retains more bytes than its limit.
+ * @tc.type: FUNC
+ * @tc.require: I7SO7X
+ */
+HWTEST_F(MemAllocatorPoolTest, MaxRetainedBytes001, TestSize.Level1)
+{
+    auto& pool = MemAllocatorPool::GetInstance();
+    size_t capacity = 0;
+    char* first = MemAllocatorPool::Acquire(TEST_BUFFER_SIZE, capacity);
+    char* second = MemAllocatorPool::Acquire(TEST_BUFFER_SIZE, capacity);
+    MemAllocatorPool::Release(first, capacity);
+    MemAllocatorPool::Release(second, capacity);
+    EXPECT_EQ(pool.GetStatistics().retainedBytes, capacity * 2);
+
+    pool.SetMaxRetainedBytes(capacity);
+    EXPECT_EQ(pool.GetStatistics().retainedBytes, capacity);
+    pool.SetMaxRetainedBytes(0);
+    EXPECT_EQ(pool.GetStatistics().retainedBytes, 0);
+}
+
+/**
+ * @tc.name: MaxProcessRetainedBytes001
+ * @tc.desc: Test that the pools of all threads together never retain more bytes than the process limit.
+ * @tc.type: FUNC
+ * @tc.require: I7SO7X
+ */
+HWTEST_F(MemAllocatorPoolTest, MaxProcessRetainedBytes001, TestSize.Level1)
+{
+    MemAllocatorPool::SetMaxProcessRetainedBytes(TEST_SIZE_CLASS_SIZE * 3);
+    auto releaseTwo = [] {
+        size_t capacity = 0;
+        char* first = MemAllocatorPool::Acquire(TEST_BUFFER_SIZE, capacity);
+        char* second = MemAllocatorPool::Acquire(TEST_BUFFER_SIZE, capacity);
+        MemAllocatorPool::Release(first, capacity);
+        MemAllocatorPool::Release(second, capacity);
+    };
+    releaseTwo();
+    std::thread worker([&releaseTwo] {
+        releaseTwo();
+        // Only one buffer fits under the process limit next to the two retained by the main thread
+        EXPECT_EQ(MemAllocatorPool::GetInstance().GetStatistics().retainedBytes, TEST_SIZE_CLASS_SIZE);
+    });
+    worker.join();
+    // The pool of the exited thread returns its bytes to the process limit
+    auto statistics = MemAllocatorPool::GetInstance().GetStatistics();
+    EXPECT_EQ(statistics.retainedBytes, TEST_SIZE_CLASS_SIZE * 2);
+    EXPECT_EQ(statistics.processRetainedBytes, TEST_SIZE_CLASS_SIZE * 2);
+}
+
+/**
+ * @tc.name: DrawCmdListReuse001
+ * @tc.desc: Test that the op buffer of a cleared DrawCmdList is reused by the next recording.
+ * @tc.type: FUNC
+ * @tc.require: I7SO7X
+ */
+HWTEST_F(MemAllocatorPoolTest, DrawCmdListReuse001, TestSize.Level1)
+{
+    auto& pool = MemAllocatorPool::GetInstance();
+    size_t lastSize = 0;
+    {
+        auto drawCmdList = std::make_shared<DrawCmdList>(10, 20);
+        for (uint32_t i = 0; i < TEST_OP_COUNT; i++) {
+            drawCmdList->AddDrawOp<ClearOpItem::ConstructorHandle>(Color::COLOR_BLACK);
+        }
+        lastSize = drawCmdList->GetOpDataSize();
+    }
+    {
+        // The first re-recording at the last size allocates a buffer large enough for all ops
+        auto drawCmdList = std::make_shared<DrawCmdList>(10, 20);
+        EXPECT_TRUE(drawCmdList->ReserveOpData(lastSize));
+        drawCmdList->ClearOp();
+    }
+    EXPECT_GT(pool.GetStatistics().retainedBytes, 0);
+
+    auto drawCmdList = std::make_shared<DrawCmdList>(10, 20);
+    auto before = pool.GetStatistics();
+    EXPECT_TRUE(drawCmdList->ReserveOpData(lastSize));
+    EXPECT_EQ(pool.GetStatistics().hitCount, before.hitCount + 1);
+}
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "recording/draw_cmd.h"
+#include "recording/draw_cmd_list.h"
+#include "recording/mem_allocator.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+namespace {
+constexpr uint32_t TEST_OP_COUNT = 10000;
+constexpr uint32_t TEST_DATA_INTERVAL = 7;
+
+struct TestOp {
+    uint32_t index;
+    uint32_t value;
+    char payload[40];
+};
+} // namespace
+
+class MemAllocatorTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+};
+
+void MemAllocatorTest::SetUpTestCase() {}
+void MemAllocatorTest::TearDownTestCase() {}
+void MemAllocatorTest::SetUp() {}
+void MemAllocatorTest::TearDown() {}
+
+/**
+ * @tc.name: ChunkedAllocate001
+ * @tc.desc: Test that offsets and recorded data stay valid while the chunked allocator grows.
+ * @tc.type: FUNC
+ * @tc.require: I7SO7X
+ */
+HWTEST_F(MemAllocatorTest, ChunkedAllocate001, TestSize.Level1)
+{
+    MemAllocator allocator;
+    allocator.SetChunked(true);
+    EXPECT_TRUE(allocator.IsChunked());
+    std::vector<uint32_t> offsets;
+    std::vector<TestOp*> ops;
+    for (uint32_t i = 0; i < TEST_OP_COUNT; i++) {
+        auto* op = allocator.Allocate<TestOp>(TestOp { i, i * 2, {} });
+        ASSERT_TRUE(op != nullptr);
+        ops.push_back(op);
+        offsets.push_back(allocator.AddrToOffset(op));
+        if (i % TEST_DATA_INTERVAL == 0) {
+            ASSERT_TRUE(allocator.Add(&i, sizeof(i)) != nullptr);
+        }
+    }
+    for (uint32_t i = 0; i < TEST_OP_COUNT; i++) {
+        // Existing ops are never relocated while recording
+        EXPECT_EQ(allocator.OffsetToAddr(offsets[i]), ops[i]);
+        EXPECT_EQ(ops[i]->value, i * 2);
+    }
+}
+
+/**
+ * @tc.name: ChunkedFlatten001
+ * @tc.desc: Test that Flatten copies all chunks into one buffer and keeps every offset unchanged.
+ * @tc.type: FUNC
+ * @tc.require: I7SO7X
+ */
+HWTEST_F(MemAllocatorTest, ChunkedFlatten001, TestSize.Level1)
+{
+    MemAllocator allocator;
+    allocator.SetChunked(true);
+    std::vector<uint32_t> offsets;
+    for (uint32_t i = 0; i < TEST_OP_COUNT; i++) {
+        auto* op = allocator.Allocate<TestOp>(TestOp { i, i * 2, {} });
+        ASSERT_TRUE(op != nullptr);
+        offsets.push_back(allocator.AddrToOffset(op));
+    }
+    // GetData never flattens, the chunks have to be flattened explicitly
+    EXPECT_TRUE(allocator.GetData() == nullptr);
+    ASSERT_TRUE(allocator.Flatten());
+    auto data = static_cast<const char*>(allocator.GetData());
+    ASSERT_TRUE(data != nullptr);
+    for (uint32_t i = 0; i < TEST_OP_COUNT; i++) {
+        auto* op = reinterpret_cast<const TestOp*>(data + offsets[i]);
+        EXPECT_EQ(op->index, i);
+        EXPECT_EQ(allocator.OffsetToAddr(offsets[i]), op);
+    }
+
+    // Recording can go on after flattening
+    auto* op = allocator.Allocate<TestOp>(TestOp { TEST_OP_COUNT, 0, {} });
+    ASSERT_TRUE(op != nullptr);
+    EXPECT_EQ(allocator.OffsetToAddr(allocator.AddrToOffset(op)), op);
+    allocator.SetChunked(false);
+    EXPECT_FALSE(allocator.IsChunked());
+    EXPECT_EQ(static_cast<const TestOp*>(allocator.OffsetToAddr(offsets[1]))->index, 1);
+}
+
+/**
+ * @tc.name: ChunkedReserve001
+ * @tc.desc: Test that Reserve replaces the first chunk so that the reserved data stays in one chunk.
+ * @tc.type: FUNC
+ * @tc.require: I7SO7X
+ */
+HWTEST_F(MemAllocatorTest, ChunkedReserve001, TestSize.Level1)
+{
+    MemAllocator allocator;
+    allocator.SetChunked(true);
+    auto* first = allocator.Allocate<TestOp>(TestOp { 0, 0, {} });
+    ASSERT_TRUE(first != nullptr);
+    uint32_t offset = allocator.AddrToOffset(first);
+    ASSERT_TRUE(allocator.Reserve(sizeof(TestOp) * TEST_OP_COUNT));
+    for (uint32_t i = 1; i < TEST_OP_COUNT; i++) {
+        ASSERT_TRUE(allocator.Allocate<TestOp>(TestOp { i, i * 2, {} }) != nullptr);
+    }
+    EXPECT_EQ(allocator.chunks_.size(), 1);
+    EXPECT_EQ(static_cast<const TestOp*>(allocator.OffsetToAddr(offset))->index, 0);
+}
+
+/**
+ * @tc.name: ChunkedDrawCmdList001
+ * @tc.desc: Test that a recorded DrawCmdList can be rebuilt from its flattened data.
+ * @tc.type: FUNC
+ * @tc.require: I7SO7X
+ */
+HWTEST_F(MemAllocatorTest, ChunkedDrawCmdList001, TestSize.Level1)
+{
+    auto drawCmdList = std::make_shared<DrawCmdList>(10, 20);
+    for (uint32_t i = 0; i < TEST_OP_COUNT; i++) {
+        drawCmdList->AddDrawOp<ClearOpItem::ConstructorHandle>(Color::COLOR_BLACK);
+    }
+    ASSERT_TRUE(drawCmdList->FlattenOpData());
+    auto newDrawCmdList = DrawCmdList::CreateFromData(drawCmdList->GetData(), true);
+    ASSERT_TRUE(newDrawCmdList != nullptr);
+    EXPECT_EQ(newDrawCmdList->GetWidth(), 10);
+    EXPECT_EQ(newDrawCmdList->GetHeight(), 20);
+    newDrawCmdList->UnmarshallingDrawOps();
+    EXPECT_EQ(newDrawCmdList->GetOpItemSize(), TEST_OP_COUNT);
+}
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
@@ -1239,4 +1239,124 @@ HWTEST_F(RSBaseRenderUtilTest, GetAccumulatedBufferCount_001, TestSize.Level2)
     ASSERT_EQ(0, RSBaseRenderUtil::GetAccumulatedBufferCount());
 }
 
+namespace {
+sptr<SurfaceBuffer> CreatePatternBuffer(int32_t width, int32_t height, int32_t format)
+{
+    sptr<SurfaceBuffer> buffer = new SurfaceBufferImpl();
+    BufferRequestConfig requestConfig = {
+        .width = width,
+        .height = height,
+        .strideAlignment = 0x8,
+        .format = format,
+        .usage = BUFFER_USAGE_CPU_READ | BUFFER_USAGE_CPU_WRITE | BUFFER_USAGE_MEM_DMA,
+        .timeout = 0,
+        .colorGamut = GraphicColorGamut::GRAPHIC_COLOR_GAMUT_SRGB,
+    };
+    if (buffer->Alloc(requestConfig) != OHOS::GSERROR_OK || buffer->GetVirAddr() == nullptr) {
+        return nullptr;
+    }
+    auto addr = static_cast<uint8_t*>(buffer->GetVirAddr());
+    int32_t stride = buffer->GetStride();
+    if (format == GRAPHIC_PIXEL_FMT_YCBCR_420_SP || format == GRAPHIC_PIXEL_FMT_YCRCB_420_SP) {
+        for (int32_t i = 0; i < height; i++) {
+            for (int32_t j = 0; j < width; j++) {
+                addr[i * stride + j] = static_cast<uint8_t>(i * 7 + j * 3); // y pattern
+            }
+        }
+        uint8_t* uv = addr + stride * height;
+        for (int32_t i = 0; i < height / 2; i++) { // 2 rows share 1 uv row
+            for (int32_t j = 0; j < width; j++) {
+                uv[i * stride + j] = static_cast<uint8_t>(i * 5 + j * 11 + 64); // uv pattern
+            }
+        }
+        return buffer;
+    }
+    for (int32_t i = 0; i < height; i++) {
+        for (int32_t j = 0; j < width; j++) {
+            uint8_t* pixel = addr + i * stride + j * 4; // 4 bytes per pixel
+            pixel[0] = static_cast<uint8_t>(j * 4); // r pattern
+            pixel[1] = static_cast<uint8_t>(i * 4); // g pattern
+            pixel[2] = static_cast<uint8_t>((i + j) * 2); // b pattern
+            pixel[3] = 200; // alpha
+        }
+    }
+    return buffer;
+}
+
+uint32_t HashBuffer(const std::vector<uint8_t>& data)
+{
+    uint32_t hash = 2166136261u; // FNV-1a offset basis
+    for (uint8_t byte : data) {
+        hash = (hash ^ byte) * 16777619u; // FNV-1a prime
+    }
+    return hash;
+}
+} // namespace
+
+/*
+ * @tc.name: ConvertYUV420SPToRGBA_001
+ * @tc.desc: Test the NV12 and NV21 conversion against the output of the per pixel implementation
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSBaseRenderUtilTest, ConvertYUV420SPToRGBA_001, TestSize.Level2)
+{
+    // hashes of the output of the per pixel implementation for the pattern of CreatePatternBuffer
+    std::vector<std::pair<int32_t, uint32_t>> goldens = {
+        { GRAPHIC_PIXEL_FMT_YCBCR_420_SP, 0x6cd6fc9cu },
+        { GRAPHIC_PIXEL_FMT_YCRCB_420_SP, 0x2b5d6a7fu },
+    };
+    for (auto& [format, golden] : goldens) {
+        auto buffer = CreatePatternBuffer(64, 64, format);
+        ASSERT_NE(buffer, nullptr);
+        std::vector<uint8_t> newBuffer;
+        Drawing::Bitmap bitmap;
+        ASSERT_TRUE(RSBaseRenderUtil::ConvertBufferToBitmap(buffer, newBuffer,
+            GraphicColorGamut::GRAPHIC_COLOR_GAMUT_SRGB, bitmap));
+        ASSERT_EQ(newBuffer.size(), 64u * 64u * 4u);
+        EXPECT_EQ(HashBuffer(newBuffer), golden);
+    }
+}
+
+/*
+ * @tc.name: ConvertBufferColorGamut_001
+ * @tc.desc: Test the sRGB to Display P3 and Adobe RGB conversion against the per pixel implementation
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSBaseRenderUtilTest, ConvertBufferColorGamut_001, TestSize.Level2)
+{
+    struct Golden {
+        int32_t row;
+        int32_t col;
+        uint8_t rgba[4];
+    };
+    // output of the per pixel implementation for the pattern of CreatePatternBuffer
+    std::vector<std::pair<GraphicColorGamut, std::vector<Golden>>> goldens = {
+        { GraphicColorGamut::GRAPHIC_COLOR_GAMUT_DISPLAY_P3,
+            { { 0, 0, { 0, 0, 0, 200 } }, { 10, 50, { 184, 56, 118, 200 } }, { 32, 32, { 128, 128, 128, 200 } },
+                { 63, 17, { 129, 249, 168, 200 } }, { 63, 63, { 252, 252, 252, 200 } } } },
+        { GraphicColorGamut::GRAPHIC_COLOR_GAMUT_ADOBE_RGB,
+            { { 0, 0, { 0, 0, 0, 200 } }, { 10, 50, { 172, 44, 117, 200 } }, { 32, 32, { 127, 127, 127, 200 } },
+                { 63, 17, { 152, 252, 164, 200 } }, { 63, 63, { 252, 252, 252, 200 } } } },
+    };
+    auto buffer = CreatePatternBuffer(64, 64, GRAPHIC_PIXEL_FMT_RGBA_8888);
+    ASSERT_NE(buffer, nullptr);
+    int32_t stride = buffer->GetStride();
+    for (auto& [dstGamut, pixels] : goldens) {
+        std::vector<uint8_t> newBuffer;
+        Drawing::Bitmap bitmap;
+        ASSERT_TRUE(RSBaseRenderUtil::ConvertBufferToBitmap(buffer, newBuffer, dstGamut, bitmap));
+        for (auto& golden : pixels) {
+            size_t offset = static_cast<size_t>(golden.row * stride + golden.col * 4); // 4 bytes per pixel
+            ASSERT_LT(offset + 3, newBuffer.size());
+            for (int32_t k = 0; k < 3; k++) { // 3 color channels
+                // the table based conversion may round differently by 1
+                EXPECT_NEAR(newBuffer[offset + k], golden.rgba[k], 1);
+            }
+            EXPECT_EQ(newBuffer[offset + 3], golden.rgba[3]);
+        }
+    }
+}
+
 } // namespace OHOS::Rosen
@@ -3400,4 +3400,80 @@ HWTEST_F(RSMainThreadTest, CheckUIExtensionCallbackDataChanged002, TestSize.Leve
     mainThread->uiExtensionCallbackData_.clear();
     ASSERT_TRUE(mainThread->CheckUIExtensionCallbackDataChanged());
 }
+
+namespace {
+std::vector<RSBaseRenderNode::SharedPtr> CreateOcclusionTestSurfaces(
+    const std::shared_ptr<RSContext>& context, uint32_t count)
+{
+    // cascaded windows of a free-window desktop, the first one is the bottom
+    constexpr int32_t stepX = 37;
+    constexpr int32_t stepY = 23;
+    constexpr int32_t rangeX = 1600;
+    constexpr int32_t rangeY = 900;
+    constexpr int32_t width = 400;
+    constexpr int32_t height = 300;
+    std::vector<RSBaseRenderNode::SharedPtr> surfaces;
+    for (uint32_t i = 0; i < count; i++) {
+        NodeId id = i + 1;
+        auto node = std::make_shared<RSSurfaceRenderNode>(id, context);
+        node->stagingRenderParams_ = std::make_unique<RSSurfaceRenderParams>(id);
+        RectI rect = RectI(static_cast<int32_t>(i) * stepX % rangeX, static_cast<int32_t>(i) * stepY % rangeY,
+            width, height);
+        node->oldDirtyInSurface_ = rect;
+        node->SetDstRect(rect);
+        node->opaqueRegion_ = Occlusion::Region(rect);
+        surfaces.emplace_back(node);
+    }
+    return surfaces;
+}
+
+void MoveOcclusionTestSurface(const RSBaseRenderNode::SharedPtr& node, int32_t offset)
+{
+    auto surface = RSBaseRenderNode::ReinterpretCast<RSSurfaceRenderNode>(node);
+    RectI rect = surface->GetDstRect().Offset(offset, offset);
+    surface->oldDirtyInSurface_ = rect;
+    surface->SetDstRect(rect);
+    surface->opaqueRegion_ = Occlusion::Region(rect);
+}
+} // namespace
+
+/**
+ * @tc.name: CalcOcclusionImplementation005
+ * @tc.desc: test that occlusion reusing the cached surfaces is the same as the one calculated from scratch
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSMainThreadTest, CalcOcclusionImplementation005, TestSize.Level1)
+{
+    constexpr uint32_t surfaceCount = 50;
+    auto mainThread = RSMainThread::Instance();
+    ASSERT_NE(mainThread, nullptr);
+    auto isUniRender = mainThread->isUniRender_;
+    mainThread->isUniRender_ = true;
+    auto curAllSurfaces = CreateOcclusionTestSurfaces(mainThread->context_, surfaceCount);
+    VisibleData dstCurVisVec;
+    std::map<NodeId, RSVisibleLevel> dstPidVisMap;
+    mainThread->occlusionCaches_.clear();
+    mainThread->CalcOcclusionImplementation(nullptr, curAllSurfaces, dstCurVisVec, dstPidVisMap);
+    ASSERT_EQ(mainThread->occlusionCaches_[INVALID_NODEID].entries.size(), surfaceCount);
+
+    MoveOcclusionTestSurface(curAllSurfaces[surfaceCount / 2], 10);
+    VisibleData incrementalVisVec;
+    mainThread->CalcOcclusionImplementation(nullptr, curAllSurfaces, incrementalVisVec, dstPidVisMap);
+    std::vector<std::vector<Occlusion::Rect>> incrementalRegions;
+    for (auto& node : curAllSurfaces) {
+        auto surface = RSBaseRenderNode::ReinterpretCast<RSSurfaceRenderNode>(node);
+        incrementalRegions.emplace_back(surface->GetVisibleRegion().GetRegionRects());
+    }
+
+    mainThread->occlusionCaches_.clear();
+    VisibleData fullVisVec;
+    mainThread->CalcOcclusionImplementation(nullptr, curAllSurfaces, fullVisVec, dstPidVisMap);
+    EXPECT_EQ(incrementalVisVec, fullVisVec);
+    for (size_t i = 0; i < curAllSurfaces.size(); i++) {
+        auto surface = RSBaseRenderNode::ReinterpretCast<RSSurfaceRenderNode>(curAllSurfaces[i]);
+        EXPECT_EQ(surface->GetVisibleRegion().GetRegionRects(), incrementalRegions[i]);
+    }
+    mainThread->isUniRender_ = isUniRender;
+}
 } // namespace OHOS::Rosen
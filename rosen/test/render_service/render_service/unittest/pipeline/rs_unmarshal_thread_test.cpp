@@ -70,4 +70,35 @@ HWTEST_F(RSUnmarshalThreadTest, RecvParcel001, TestSize.Level1)
     ASSERT_EQ(success, true);
     RSUnmarshalThread::Instance().RecvParcel(data);
 }
-}
\ No newline at end of file
+
+/*
+ * @tc.name: MergeUnmarshalledData001
+ * @tc.desc: Test that data unmarshalled out of order is merged in the order of RecvParcel
+ * @tc.type: FUNC
+ * @tc.require: issueI6QM6E
+ */
+HWTEST_F(RSUnmarshalThreadTest, MergeUnmarshalledData001, TestSize.Level1)
+{
+    RSUnmarshalThread instance;
+    uint64_t seq = instance.nextMergeSeq_;
+    const pid_t pid = 1;
+    for (uint64_t index : { 2, 0, 1 }) {
+        auto transData = std::make_unique<RSTransactionData>();
+        transData->SetSendingPid(pid);
+        transData->SetIndex(index);
+        instance.MergeUnmarshalledData(seq + index, std::move(transData));
+        if (index == 2) {
+            EXPECT_TRUE(instance.cachedTransactionDataMap_.empty());
+        }
+    }
+    ASSERT_EQ(instance.cachedTransactionDataMap_[pid].size(), 3);
+    for (uint64_t index = 0; index < 3; index++) {
+        EXPECT_EQ(instance.cachedTransactionDataMap_[pid][index]->GetIndex(), index);
+    }
+    // an invalid parcel does not block the following ones
+    instance.MergeUnmarshalledData(seq + 4, std::make_unique<RSTransactionData>());
+    instance.MergeUnmarshalledData(seq + 3, nullptr);
+    EXPECT_TRUE(instance.unmarshalledDataMap_.empty());
+    EXPECT_EQ(instance.nextMergeSeq_, seq + 5);
+}
+}
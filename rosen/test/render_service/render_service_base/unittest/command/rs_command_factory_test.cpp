@@ -71,4 +71,25 @@ HWTEST_F(RSCommandFactoryTest, GetUnmarshallingFunc001, TestSize.Level1)
     func = factory.GetUnmarshallingFunc(type, subtype);
     EXPECT_TRUE(func == nullptr);
 }
+
+/**
+ * @tc.name: GetUnmarshallingFunc002
+ * @tc.desc: test that commands in and out of the range of the dispatch table are both registered
+ * @tc.type: FUNC
+ * @tc.require: issueI9P2KH
+ */
+HWTEST_F(RSCommandFactoryTest, GetUnmarshallingFunc002, TestSize.Level1)
+{
+    RSCommandFactory& factory = RSCommandFactory::Instance();
+    UnmarshallingFunc func = [](Parcel& parcel) -> RSCommand* { return nullptr; };
+    uint16_t type = RSCommandFactory::MAX_COMMAND_TYPE_COUNT - 1; // unused type for test
+    uint16_t subtype = RSCommandFactory::MAX_COMMAND_SUBTYPE_COUNT - 1; // unused subtype for test
+    factory.Register(type, subtype, func);
+    EXPECT_EQ(factory.GetUnmarshallingFunc(type, subtype), func);
+
+    uint16_t largeType = RSCommandFactory::MAX_COMMAND_TYPE_COUNT; // out of the table for test
+    factory.Register(largeType, subtype, func);
+    EXPECT_EQ(factory.GetUnmarshallingFunc(largeType, subtype), func);
+    EXPECT_TRUE(factory.GetUnmarshallingFunc(largeType, 0) == nullptr);
+}
 } // namespace OHOS::Rosen
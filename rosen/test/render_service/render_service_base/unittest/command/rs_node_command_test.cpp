@@ -15,6 +15,7 @@
 
 #include "gtest/gtest.h"
 #include "include/command/rs_node_command.h"
+#include "modifier/rs_render_modifier.h"
 #include "params/rs_render_params.h"
 
 using namespace testing;
@@ -308,4 +309,34 @@ HWTEST_F(RSNodeCommandTest, UnregisterGeometryTransitionPair001, TestSize.Level1
     RSNodeCommandHelper::UnregisterGeometryTransitionPair(context, inNodeId, outNodeId);
     EXPECT_EQ(0, inNodeId);
 }
+
+/**
+ * @tc.name: UpdateModifierDeltaBlock001
+ * @tc.desc: test that every property in RSPropertyDeltaBlock is updated by UpdateModifierDeltaBlock
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSNodeCommandTest, UpdateModifierDeltaBlock001, TestSize.Level1)
+{
+    RSContext context;
+    NodeId nodeId = 1;
+    PropertyId alphaId = 10;
+    PropertyId translateId = 11;
+    RSPropertyDeltaBlock block;
+    block.Add<float>(alphaId, 0.5f, UPDATE_TYPE_OVERWRITE);
+    block.Add<Vector2f>(translateId, Vector2f(1.0f, 2.0f), UPDATE_TYPE_INCREMENTAL);
+    // the node is not registered yet
+    RSNodeCommandHelper::UpdateModifierDeltaBlock(context, nodeId, block);
+
+    auto node = std::make_shared<RSRenderNode>(nodeId);
+    context.GetMutableNodeMap().RegisterRenderNode(node);
+    auto alphaProperty = std::make_shared<RSRenderAnimatableProperty<float>>(1.0f, alphaId);
+    auto translateProperty = std::make_shared<RSRenderAnimatableProperty<Vector2f>>(Vector2f(1.0f, 1.0f), translateId);
+    RSNodeCommandHelper::AddModifier(context, nodeId, std::make_shared<RSAlphaRenderModifier>(alphaProperty));
+    RSNodeCommandHelper::AddModifier(context, nodeId, std::make_shared<RSTranslateRenderModifier>(translateProperty));
+
+    RSNodeCommandHelper::UpdateModifierDeltaBlock(context, nodeId, block);
+    EXPECT_EQ(alphaProperty->Get(), 0.5f);
+    EXPECT_EQ(translateProperty->Get(), Vector2f(2.0f, 3.0f));
+}
 } // namespace OHOS::Rosen
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "common/rs_common_def.h"
+#include "common/rs_flat_map.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Rosen {
+class RSFlatMapTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+};
+
+void RSFlatMapTest::SetUpTestCase() {}
+void RSFlatMapTest::TearDownTestCase() {}
+void RSFlatMapTest::SetUp() {}
+void RSFlatMapTest::TearDown() {}
+
+/**
+ * @tc.name: Emplace001
+ * @tc.desc: test that emplaced items are iterated in key order and existing keys are kept
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSFlatMapTest, Emplace001, TestSize.Level1)
+{
+    RSFlatMap<uint64_t, std::string> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.emplace(3, "c").second);
+    EXPECT_TRUE(map.emplace(1, "a").second);
+    EXPECT_TRUE(map.emplace(2, "b").second);
+    auto result = map.emplace(1, "d");
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(result.first->second, "a");
+    EXPECT_EQ(map.size(), 3u);
+
+    std::string values;
+    uint64_t lastKey = 0;
+    for (const auto& [key, value] : map) {
+        EXPECT_GT(key, lastKey);
+        lastKey = key;
+        values += value;
+    }
+    EXPECT_EQ(values, "abc");
+}
+
+/**
+ * @tc.name: Find001
+ * @tc.desc: test results of find, count and operator[]
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSFlatMapTest, Find001, TestSize.Level1)
+{
+    RSFlatMap<uint64_t, int> map;
+    EXPECT_EQ(map.find(1), map.end());
+    map[5] = 50;
+    map[1] = 10;
+    map[5] += 1;
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.count(5), 1u);
+    EXPECT_EQ(map.count(3), 0u);
+    ASSERT_NE(map.find(5), map.end());
+    EXPECT_EQ(map.find(5)->second, 51);
+    EXPECT_EQ(map.find(3), map.end());
+    const auto& constMap = map;
+    ASSERT_NE(constMap.find(1), constMap.end());
+    EXPECT_EQ(constMap.find(1)->second, 10);
+}
+
+/**
+ * @tc.name: Erase001
+ * @tc.desc: test results of erase by key, by iterator and EraseIf
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSFlatMapTest, Erase001, TestSize.Level1)
+{
+    RSFlatMap<uint64_t, int> map;
+    for (int i = 0; i < 10; i++) {
+        map.emplace(i, i);
+    }
+    EXPECT_EQ(map.erase(3), 1u);
+    EXPECT_EQ(map.erase(3), 0u);
+    auto it = map.erase(map.find(4));
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it->first, 5u);
+    EXPECT_EQ(map.size(), 8u);
+
+    EXPECT_EQ(EraseIf(map, [](const auto& pair) -> bool { return pair.second % 2 == 0; }), 4u);
+    EXPECT_EQ(map.size(), 4u);
+    for (const auto& [key, value] : map) {
+        EXPECT_EQ(value % 2, 1);
+    }
+    map.clear();
+    EXPECT_TRUE(map.empty());
+}
+} // namespace OHOS::Rosen
@@ -58,7 +58,47 @@ HWTEST_F(RSDrawableTest, CalculateDirtySlots, TestSize.Level1)
     std::optional<Vector4f> aiInvert = { Vector4f() };
     node.renderContent_->GetMutableRenderProperties().SetAiInvert(aiInvert);
     ASSERT_TRUE(node.GetRenderProperties().GetAiInvert());
-    ASSERT_EQ(RSDrawable::CalculateDirtySlots(dirtyTypes, drawableVec).size(), 33);
+    ASSERT_EQ(RSDrawable::CalculateDirtySlots(dirtyTypes, drawableVec).count(), 33);
+}
+
+/**
+ * @tc.name: CalculateDirtySlotsExpand
+ * @tc.desc: Test bounds and border changes only mark the existing affected drawables
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSDrawableTest, CalculateDirtySlotsExpand, TestSize.Level1)
+{
+    ModifierDirtyTypes dirtyTypes;
+    dirtyTypes.set(static_cast<size_t>(RSModifierType::BOUNDS));
+    RSDrawable::Vec drawableVec;
+    drawableVec[static_cast<size_t>(RSDrawableSlot::BACKGROUND_COLOR)] =
+        std::make_shared<DrawableV2::RSForegroundFilterDrawable>();
+    drawableVec[static_cast<size_t>(RSDrawableSlot::BORDER)] =
+        std::make_shared<DrawableV2::RSForegroundFilterDrawable>();
+    auto dirtySlots = RSDrawable::CalculateDirtySlots(dirtyTypes, drawableVec);
+    std::vector<RSDrawableSlot> slots;
+    RSDrawable::ForEachSlot(dirtySlots, [&slots](RSDrawableSlot slot) { slots.push_back(slot); });
+    std::vector<RSDrawableSlot> expected = { RSDrawableSlot::CLIP_TO_BOUNDS, RSDrawableSlot::BACKGROUND_COLOR,
+        RSDrawableSlot::BORDER };
+    ASSERT_EQ(slots, expected);
+    ASSERT_TRUE(RSDrawable::CalculateDirtySlots(ModifierDirtyTypes(), drawableVec).none());
+}
+
+/**
+ * @tc.name: LowestSetBit
+ * @tc.desc: Test LowestSetBit returns the index of the lowest set bit of every position
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSDrawableTest, LowestSetBit, TestSize.Level1)
+{
+    constexpr size_t wordBits = 64;
+    for (size_t i = 0; i < wordBits; i++) {
+        uint64_t bit = static_cast<uint64_t>(1) << i;
+        ASSERT_EQ(RSDrawable::LowestSetBit(bit), i);
+        ASSERT_EQ(RSDrawable::LowestSetBit(bit | (static_cast<uint64_t>(1) << (wordBits - 1))), i);
+    }
 }
 
 /**
@@ -76,7 +116,7 @@ HWTEST_F(RSDrawableTest, UpdateDirtySlots, TestSize.Level1)
     dirtyTypes.set();
     std::optional<Vector4f> aiInvert = { Vector4f() };
     node.renderContent_->GetMutableRenderProperties().SetAiInvert(aiInvert);
-    std::unordered_set<RSDrawableSlot> dirtySlots = RSDrawable::CalculateDirtySlots(dirtyTypes, drawableVec);
+    RSDrawable::DirtySlots dirtySlots = RSDrawable::CalculateDirtySlots(dirtyTypes, drawableVec);
     std::shared_ptr<RSShader> shader = RSShader::CreateRSShader();
     node.renderContent_->GetMutableRenderProperties().SetBackgroundShader(shader);
     for (auto& drawable : drawableVec) {
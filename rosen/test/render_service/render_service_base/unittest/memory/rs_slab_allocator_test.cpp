@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <gtest/gtest.h>
+
+#include "memory/rs_slab_allocator.h"
+#include "params/rs_render_params.h"
+#include "pipeline/rs_canvas_render_node.h"
+#include "pipeline/rs_render_node_gc.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Rosen {
+class RSSlabAllocatorTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+};
+
+void RSSlabAllocatorTest::SetUpTestCase() {}
+void RSSlabAllocatorTest::TearDownTestCase() {}
+void RSSlabAllocatorTest::SetUp() {}
+void RSSlabAllocatorTest::TearDown() {}
+
+/**
+ * @tc.name: AllocateAndFree001
+ * @tc.desc: blocks of one size class share a slab and freed blocks are reused
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSSlabAllocatorTest, AllocateAndFree001, TestSize.Level1)
+{
+    RSSlabAllocator allocator;
+    constexpr size_t size = 200;
+    void* first = allocator.Allocate(size);
+    void* second = allocator.Allocate(size);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(first) % RSSlabAllocator::BLOCK_ALIGN, 0);
+    EXPECT_EQ(allocator.GetSlabCount(), 1);
+    EXPECT_EQ(allocator.GetLiveBlockCount(), 2);
+
+    allocator.Free(first, size);
+    EXPECT_EQ(allocator.GetLiveBlockCount(), 1);
+    EXPECT_EQ(allocator.Allocate(size), first);
+
+    allocator.Free(first, size);
+    allocator.Free(second, size);
+    EXPECT_EQ(allocator.GetLiveBlockCount(), 0);
+    // the empty slab is kept as the spare slab of the allocator for the next allocation
+    EXPECT_EQ(allocator.GetSlabCount(), 1);
+    EXPECT_EQ(allocator.GetSlabCount(), allocator.GetEmptySlabCount());
+}
+
+/**
+ * @tc.name: AllocateAndFree002
+ * @tc.desc: a size class grows by slabs and only a few empty slabs are kept
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSSlabAllocatorTest, AllocateAndFree002, TestSize.Level1)
+{
+    RSSlabAllocator allocator;
+    constexpr size_t size = 1024;
+    constexpr size_t count = 3 * RSSlabAllocator::SLAB_SIZE / size;
+    std::vector<void*> blocks;
+    for (size_t i = 0; i < count; i++) {
+        blocks.push_back(allocator.Allocate(size));
+    }
+    EXPECT_GT(allocator.GetSlabCount(), 3);
+    for (auto block : blocks) {
+        allocator.Free(block, size);
+    }
+    EXPECT_EQ(allocator.GetLiveBlockCount(), 0);
+    EXPECT_LE(allocator.GetSlabCount(), RSSlabAllocator::MAX_CACHED_EMPTY_SLABS + 1);
+
+    // large objects bypass the slabs
+    void* large = allocator.Allocate(RSSlabAllocator::MAX_BLOCK_SIZE + 1);
+    ASSERT_NE(large, nullptr);
+    EXPECT_EQ(allocator.GetLiveBlockCount(), 0);
+    allocator.Free(large, RSSlabAllocator::MAX_BLOCK_SIZE + 1);
+}
+
+/**
+ * @tc.name: AllocateAndFree003
+ * @tc.desc: the empty slabs of all size classes are bounded together and reused by any size class
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSSlabAllocatorTest, AllocateAndFree003, TestSize.Level1)
+{
+    RSSlabAllocator allocator;
+    constexpr size_t classCount = 20;
+    std::vector<std::pair<void*, size_t>> blocks;
+    for (size_t i = 0; i < classCount; i++) {
+        size_t size = (i + 1) * RSSlabAllocator::BLOCK_ALIGN;
+        blocks.emplace_back(allocator.Allocate(size), size);
+    }
+    EXPECT_EQ(allocator.GetSlabCount(), classCount);
+    for (auto [block, size] : blocks) {
+        allocator.Free(block, size);
+    }
+    EXPECT_LE(allocator.GetSlabCount(), RSSlabAllocator::MAX_CACHED_EMPTY_SLABS + 1);
+    EXPECT_EQ(allocator.GetSlabCount(), allocator.GetEmptySlabCount());
+
+    // a cached slab serves a size class it was not carved for
+    size_t slabCount = allocator.GetSlabCount();
+    constexpr size_t size = 4096;
+    void* block = allocator.Allocate(size);
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(allocator.GetSlabCount(), std::max<size_t>(slabCount, 1));
+    allocator.Free(block, size);
+}
+
+/**
+ * @tc.name: AllocateAndFree004
+ * @tc.desc: an object created and destroyed in a loop keeps its slab while the empty slab cache is full
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSSlabAllocatorTest, AllocateAndFree004, TestSize.Level1)
+{
+    // the slabs freed by this allocator besides its spare slab fill the cache of the process
+    RSSlabAllocator filler;
+    std::vector<std::pair<void*, size_t>> blocks;
+    for (size_t i = 0; i <= RSSlabAllocator::MAX_CACHED_EMPTY_SLABS; i++) {
+        size_t size = (i + 1) * RSSlabAllocator::BLOCK_ALIGN;
+        blocks.emplace_back(filler.Allocate(size), size);
+    }
+    for (auto [block, size] : blocks) {
+        filler.Free(block, size);
+    }
+
+    RSSlabAllocator allocator;
+    constexpr size_t size = 256;
+    constexpr size_t loopCount = 1000;
+    allocator.Free(allocator.Allocate(size), size);
+    ASSERT_EQ(allocator.GetSlabCount(), 1);
+    for (size_t i = 0; i < loopCount; i++) {
+        void* block = allocator.Allocate(size);
+        ASSERT_NE(block, nullptr);
+        allocator.Free(block, size);
+        ASSERT_EQ(allocator.GetSlabCount(), 1);
+    }
+    EXPECT_EQ(allocator.GetEmptySlabCount(), 1);
+}
+
+/**
+ * @tc.name: BatchFree001
+ * @tc.desc: blocks freed inside a BatchFree are returned when it ends
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSSlabAllocatorTest, BatchFree001, TestSize.Level1)
+{
+    RSSlabAllocator allocator;
+    RSSlabAllocator other;
+    constexpr size_t size = 64;
+    void* first = allocator.Allocate(size);
+    void* second = allocator.Allocate(size);
+    void* otherBlock = other.Allocate(size);
+    {
+        RSSlabAllocator::BatchFree batchFree(allocator);
+        allocator.Free(first, size);
+        allocator.Free(second, size);
+        other.Free(otherBlock, size);
+        EXPECT_EQ(allocator.GetLiveBlockCount(), 2);
+        EXPECT_EQ(other.GetLiveBlockCount(), 0);
+    }
+    EXPECT_EQ(allocator.GetLiveBlockCount(), 0);
+}
+
+/**
+ * @tc.name: RenderNodeAllocation001
+ * @tc.desc: render nodes and render params are placed in their slab allocators and released by RSRenderNodeGC
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSSlabAllocatorTest, RenderNodeAllocation001, TestSize.Level1)
+{
+    auto& nodeAllocator = RSRenderNode::GetAllocator();
+    auto& paramsAllocator = RSRenderParams::GetAllocator();
+    size_t nodeCount = nodeAllocator.GetLiveBlockCount();
+    size_t paramsCount = paramsAllocator.GetLiveBlockCount();
+    {
+        std::shared_ptr<RSRenderNode> node(new RSCanvasRenderNode(1), RSRenderNodeGC::NodeDestructor);
+        auto params = std::make_unique<RSRenderParams>(1);
+        EXPECT_EQ(nodeAllocator.GetLiveBlockCount(), nodeCount + 1);
+        EXPECT_EQ(paramsAllocator.GetLiveBlockCount(), paramsCount + 1);
+    }
+    EXPECT_EQ(paramsAllocator.GetLiveBlockCount(), paramsCount);
+    while (!RSRenderNodeGC::Instance().nodeBucket_.empty()) {
+        RSRenderNodeGC::Instance().ReleaseNodeBucket();
+    }
+    EXPECT_EQ(nodeAllocator.GetLiveBlockCount(), nodeCount);
+}
+} // namespace OHOS::Rosen
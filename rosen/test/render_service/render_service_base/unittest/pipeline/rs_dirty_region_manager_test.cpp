@@ -28,6 +28,26 @@ using namespace testing::ext;
 namespace OHOS::Rosen {
 namespace {
     const RectI DEFAULT_RECT = {0, 0, 100, 100};
+    constexpr int32_t SCREEN_WIDTH = 1260;
+    constexpr int32_t SCREEN_HEIGHT = 2720;
+
+    std::shared_ptr<RSDirtyRegionManager> CreateTileDirtyManager()
+    {
+        auto manager = std::make_shared<RSDirtyRegionManager>(true);
+        manager->isTileDirtyEnabled_ = true;
+        manager->dirtyTilesHistory_.resize(manager->HISTORY_QUEUE_MAX_SIZE);
+        manager->SetSurfaceSize(SCREEN_WIDTH, SCREEN_HEIGHT);
+        return manager;
+    }
+
+    int64_t GetArea(const std::vector<RectI>& rects)
+    {
+        int64_t area = 0;
+        for (const auto& rect : rects) {
+            area += static_cast<int64_t>(rect.width_) * rect.height_;
+        }
+        return area;
+    }
 }
 class RSDirtyRegionManagerTest : public testing::Test {
 public:
@@ -683,4 +703,112 @@ HWTEST_F(RSDirtyRegionManagerTest, AlignHistory, TestSize.Level1)
     fun.AlignHistory();
     EXPECT_TRUE(true);
 }
-} // namespace OHOS::Rosen
\ No newline at end of file
+/**
+ * @tc.name: DirtyTileMap001
+ * @tc.desc: test that the rects of a tile map cover exactly its dirty tiles
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSDirtyRegionManagerTest, DirtyTileMap001, TestSize.Level1)
+{
+    RSDirtyTileMap tiles;
+    tiles.SetSize(100, 100, 32);
+    EXPECT_TRUE(tiles.IsEmpty());
+    tiles.MarkRect(RectI(10, 10, 10, 10));
+    tiles.MarkRect(RectI(70, 10, 40, 10));
+    tiles.MarkRect(RectI(70, 40, 40, 10));
+    EXPECT_EQ(tiles.GetDirtyTileCount(), 5);
+    std::vector<RectI> rects = tiles.GetRects();
+    ASSERT_EQ(rects.size(), 2u);
+    EXPECT_EQ(rects[0], RectI(0, 0, 32, 32));
+    // clipped to the grid size
+    EXPECT_EQ(rects[1], RectI(64, 0, 36, 64));
+
+    RSDirtyTileMap other;
+    other.SetSize(100, 100, 32);
+    other.MarkRect(RectI(96, 96, 4, 4));
+    tiles.Or(other);
+    EXPECT_EQ(tiles.GetDirtyTileCount(), 6);
+    tiles.IntersectRect(RectI(64, 0, 36, 32));
+    EXPECT_EQ(tiles.GetDirtyTileCount(), 2);
+    tiles.Clear();
+    EXPECT_TRUE(tiles.GetRects().empty());
+    tiles.MarkAll();
+    rects = tiles.GetRects();
+    ASSERT_EQ(rects.size(), 1u);
+    EXPECT_EQ(rects[0], RectI(0, 0, 100, 100));
+}
+
+/**
+ * @tc.name: UpdateDirtyTiles001
+ * @tc.desc: test that the dirty tiles are merged with the history according to buffer age
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSDirtyRegionManagerTest, UpdateDirtyTiles001, TestSize.Level1)
+{
+    auto manager = CreateTileDirtyManager();
+    const RectI clock(1100, 60, 120, 40);
+    const RectI progress(100, 2600, 600, 8);
+    manager->MergeDirtyRect(clock);
+    manager->SetBufferAge(0);
+    manager->UpdateDirty();
+    // invalid buffer age redraws the whole surface
+    EXPECT_EQ(manager->dirtyTiles_.GetDirtyTileCount(), manager->dirtyTiles_.rows_ * manager->dirtyTiles_.cols_);
+    manager->Clear();
+
+    manager->MergeDirtyRect(progress);
+    manager->SetBufferAge(2);
+    manager->UpdateDirty();
+    EXPECT_EQ(manager->GetDirtyRegion(), clock.JoinRect(progress));
+    std::vector<RectI> rects = manager->GetDirtyRegionRectsFlipWithinSurface();
+    ASSERT_EQ(rects.size(), 2u);
+    EXPECT_LT(GetArea(rects), static_cast<int64_t>(manager->GetDirtyRegion().width_) *
+        manager->GetDirtyRegion().height_);
+    for (const auto& rect : rects) {
+        auto unflipped = manager->GetRectFlipWithinSurface(rect);
+        EXPECT_TRUE(clock.IsInsideOf(unflipped) || progress.IsInsideOf(unflipped));
+    }
+    manager->Clear();
+
+    // rects clipped out of the current frame are not kept as tiles
+    manager->MergeDirtyRect(clock);
+    manager->IntersectDirtyRect(RectI(0, 0, SCREEN_WIDTH, 50));
+    manager->SetBufferAge(1);
+    manager->UpdateDirty();
+    EXPECT_TRUE(manager->GetCurrentFrameDirtyRegion().IsEmpty());
+    EXPECT_TRUE(manager->currentFrameDirtyTiles_.IsEmpty());
+}
+
+/**
+ * @tc.name: UpdateDirtyTiles002
+ * @tc.desc: test that the bound is used when the surface is resized or the tiles are split into too many rects
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSDirtyRegionManagerTest, UpdateDirtyTiles002, TestSize.Level1)
+{
+    auto manager = CreateTileDirtyManager();
+    manager->MergeDirtyRect(RectI(0, 0, 10, 10));
+    manager->SetBufferAge(1);
+    manager->UpdateDirty();
+    manager->Clear();
+
+    manager->SetSurfaceSize(SCREEN_HEIGHT, SCREEN_WIDTH);
+    manager->MergeDirtyRect(RectI(1000, 1000, 10, 10));
+    manager->SetBufferAge(2);
+    manager->UpdateDirty();
+    // the history before resizing is marked as its bound
+    EXPECT_EQ(manager->GetDirtyRegionRectsFlipWithinSurface().size(), 2u);
+    manager->Clear();
+
+    for (int32_t i = 0; i <= static_cast<int32_t>(RSDirtyRegionManager::MAX_DIRTY_TILE_RECTS); i++) {
+        manager->MergeDirtyRect(RectI(i * 64, i * 64, 10, 10)); // 64 keeps the rects in different tiles
+    }
+    manager->SetBufferAge(1);
+    manager->UpdateDirty();
+    std::vector<RectI> rects = manager->GetDirtyRegionRectsFlipWithinSurface();
+    ASSERT_EQ(rects.size(), 1u);
+    EXPECT_EQ(rects[0], manager->GetDirtyRegionFlipWithinSurface());
+}
+} // namespace OHOS::Rosen
@@ -1065,7 +1065,7 @@ HWTEST_F(RSRenderNodeTest, OnSyncTest, TestSize.Level1)
     EXPECT_NE(node->renderDrawable_->uifirstRenderParams_, nullptr);
 
     node->uifirstSkipPartialSync_ = false;
-    node->dirtySlots_.emplace(RSDrawableSlot::BACKGROUND_FILTER);
+    node->dirtySlots_.set(static_cast<size_t>(RSDrawableSlot::BACKGROUND_FILTER));
     auto drawableFilter = std::make_shared<DrawableV2::RSForegroundFilterDrawable>();
     EXPECT_NE(drawableFilter, nullptr);
 
@@ -1076,12 +1076,42 @@ HWTEST_F(RSRenderNodeTest, OnSyncTest, TestSize.Level1)
     std::function<void()> clearTask = []() { printf("ClearSurfaceTask CallBack\n"); };
     node->isOpincRootFlag_ = true;
     node->OnSync();
-    EXPECT_TRUE(node->dirtySlots_.empty());
+    EXPECT_TRUE(node->dirtySlots_.none());
     EXPECT_FALSE(node->drawCmdListNeedSync_);
     EXPECT_FALSE(node->uifirstNeedSync_);
     EXPECT_FALSE(node->needClearSurface_);
 }
 
+/**
+ * @tc.name: SyncRenderParamsTest
+ * @tc.desc: SyncRenderParams copies the staging params only, the rest is left to OnSync
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSRenderNodeTest, SyncRenderParamsTest, TestSize.Level1)
+{
+    std::shared_ptr<RSRenderNode> node = std::make_shared<RSRenderNode>(0);
+    node->renderDrawable_ = nullptr;
+    node->SyncRenderParams();
+
+    std::shared_ptr<RSRenderNode> child = std::make_shared<RSRenderNode>(0);
+    node->renderDrawable_ = std::make_shared<RSRenderNodeDrawableAdapterBoy>(child);
+    node->renderDrawable_->renderParams_ = std::make_unique<RSRenderParams>(0);
+    node->stagingRenderParams_ = std::make_unique<RSRenderParams>(0);
+    node->stagingRenderParams_->SetAlpha(0.5f);
+    node->drawCmdListNeedSync_ = true;
+    EXPECT_TRUE(node->stagingRenderParams_->NeedSync());
+
+    node->SyncRenderParams();
+    EXPECT_FALSE(node->stagingRenderParams_->NeedSync());
+    EXPECT_EQ(node->renderDrawable_->renderParams_->GetAlpha(), 0.5f);
+    EXPECT_TRUE(node->drawCmdListNeedSync_);
+
+    node->OnSync();
+    EXPECT_FALSE(node->drawCmdListNeedSync_);
+    EXPECT_EQ(node->renderDrawable_->renderParams_->GetAlpha(), 0.5f);
+}
+
 /**
  * @tc.name: ValidateLightResourcesTest
  * @tc.desc:
@@ -1110,9 +1140,9 @@ HWTEST_F(RSRenderNodeTest, ValidateLightResourcesTest, TestSize.Level1)
 HWTEST_F(RSRenderNodeTest, UpdatePointLightDirtySlotTest, TestSize.Level1)
 {
     RSRenderNode node(id, context);
-    EXPECT_TRUE(node.dirtySlots_.empty());
+    EXPECT_TRUE(node.dirtySlots_.none());
     node.UpdateDirtySlotsAndPendingNodes(RSDrawableSlot::MASK);
-    EXPECT_FALSE(node.dirtySlots_.empty());
+    EXPECT_TRUE(node.dirtySlots_.test(static_cast<size_t>(RSDrawableSlot::MASK)));
 }
 /**
  * @tc.name: AddToPendingSyncListTest
@@ -1363,7 +1393,9 @@ HWTEST_F(RSRenderNodeTest, AddChildTest004, TestSize.Level1)
     nodeTest->isOnTheTree_ = false;
     nodeTest->isFullChildrenListValid_ = true;
     nodeTest->AddChild(childTest2, -1);
-    EXPECT_FALSE(nodeTest->isFullChildrenListValid_);
+    // appended children are inserted into the full children list instead of generating it again
+    EXPECT_TRUE(nodeTest->isFullChildrenListValid_);
+    EXPECT_FALSE(nodeTest->appendedChildren_.empty());
 
     nodeTest->isFullChildrenListValid_ = true;
     nodeTest->AddChild(childTest2, 1);
@@ -1925,12 +1957,12 @@ HWTEST_F(RSRenderNodeTest, UpdateDrawableVecV2Test019, TestSize.Level1)
     nodeTest->dirtyTypes_.set(static_cast<size_t>(RSModifierType::ROTATION_X), true);
     std::shared_ptr<DrawableTest> drawableTest1 = std::make_shared<DrawableTest>();
     nodeTest->drawableVec_.at(1) = drawableTest1;
-    EXPECT_TRUE(nodeTest->dirtySlots_.empty());
+    EXPECT_TRUE(nodeTest->dirtySlots_.none());
 
     nodeTest->stagingRenderParams_ = std::make_unique<RSRenderParams>(0);
     nodeTest->UpdateDrawableVecV2();
-    auto sum = nodeTest->dirtySlots_.size();
-    EXPECT_NE(nodeTest->dirtySlots_.size(), 0);
+    auto sum = nodeTest->dirtySlots_.count();
+    EXPECT_NE(nodeTest->dirtySlots_.count(), 0);
 
     nodeTest->dirtyTypes_.set(static_cast<size_t>(RSModifierType::PIVOT), true);
     std::shared_ptr<DrawableTest> drawableTest2 = std::make_shared<DrawableTest>();
@@ -1942,7 +1974,7 @@ HWTEST_F(RSRenderNodeTest, UpdateDrawableVecV2Test019, TestSize.Level1)
     RRect rrect;
     nodeTest->renderContent_->renderProperties_.rrect_ = rrect;
     nodeTest->UpdateDrawableVecV2();
-    EXPECT_NE(nodeTest->dirtySlots_.size(), sum);
+    EXPECT_NE(nodeTest->dirtySlots_.count(), sum);
 }
 
 /**
@@ -2589,5 +2621,75 @@ HWTEST_F(RSRenderNodeTest, UpdateDirtyRegionInfoForDFX002, TestSize.Level1)
     }
 }
 
+/**
+ * @tc.name: AppendFullChildrenListTest001
+ * @tc.desc: test that appended children are inserted into the full children list in z-order
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSRenderNodeTest, AppendFullChildrenListTest001, TestSize.Level1)
+{
+    auto node = std::make_shared<RSRenderNode>(0);
+    std::vector<std::shared_ptr<RSRenderNode>> children;
+    const std::vector<float> positionZ = { 0.0f, 2.0f, 1.0f, 2.0f };
+    for (size_t i = 0; i < positionZ.size(); i++) {
+        children.emplace_back(std::make_shared<RSRenderNode>(i + 1));
+        children[i]->GetMutableRenderProperties().SetPositionZ(positionZ[i]);
+    }
+    node->AddChild(children[0]);
+    node->AddChild(children[1]);
+    EXPECT_TRUE(node->isFullChildrenListValid_);
+    EXPECT_EQ(node->appendedChildren_.size(), 2u);
+    node->AppendFullChildrenList();
+    EXPECT_TRUE(node->appendedChildren_.empty());
+    EXPECT_EQ(*node->GetSortedChildren(), std::vector<std::shared_ptr<RSRenderNode>>({ children[0], children[1] }));
+
+    node->AddChild(children[2]);
+    node->AddChild(children[3]);
+    node->AppendFullChildrenList();
+    auto appendedList = *node->GetSortedChildren();
+    EXPECT_EQ(appendedList,
+        std::vector<std::shared_ptr<RSRenderNode>>({ children[0], children[2], children[1], children[3] }));
+    node->GenerateFullChildrenList();
+    EXPECT_EQ(appendedList, *node->GetSortedChildren());
+
+    // anything else than appending generates the list again
+    node->RemoveChild(children[2]);
+    EXPECT_FALSE(node->isFullChildrenListValid_);
+    node->isFullChildrenListValid_ = true;
+    node->AddChild(children[2], 0);
+    EXPECT_FALSE(node->isFullChildrenListValid_);
+    EXPECT_TRUE(node->appendedChildren_.empty());
+}
+
+/**
+ * @tc.name: MoveChildTest006
+ * @tc.desc: test the position of a moved child
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSRenderNodeTest, MoveChildTest006, TestSize.Level1)
+{
+    auto node = std::make_shared<RSRenderNode>(0);
+    std::vector<std::shared_ptr<RSRenderNode>> children;
+    for (NodeId id = 1; id <= 3; id++) {
+        children.emplace_back(std::make_shared<RSRenderNode>(id));
+        node->AddChild(children.back());
+    }
+    auto getChildIds = [&node]() {
+        std::vector<NodeId> ids;
+        for (auto& child : node->children_) {
+            ids.emplace_back(child.lock()->GetId());
+        }
+        return ids;
+    };
+    // index is the position before the child is taken out
+    node->MoveChild(children[0], 2);
+    EXPECT_EQ(getChildIds(), std::vector<NodeId>({ 2, 1, 3 }));
+    node->MoveChild(children[2], 0);
+    EXPECT_EQ(getChildIds(), std::vector<NodeId>({ 3, 2, 1 }));
+    node->MoveChild(children[2], -1);
+    EXPECT_EQ(getChildIds(), std::vector<NodeId>({ 2, 1, 3 }));
+}
 } // namespace Rosen
 } // namespace OHOS
@@ -239,7 +239,7 @@ HWTEST_F(RSRenderNodeTest2, CollectAndUpdateLocalShadowRect, TestSize.Level1)
     RSRenderNode node(id, context);
     node.CollectAndUpdateLocalShadowRect();
     RSDrawableSlot slot = RSDrawableSlot::SHADOW;
-    node.dirtySlots_.insert(slot);
+    node.dirtySlots_.set(static_cast<size_t>(slot));
     node.CollectAndUpdateLocalShadowRect();
     ASSERT_TRUE(true);
 }
@@ -255,7 +255,7 @@ HWTEST_F(RSRenderNodeTest2, CollectAndUpdateLocalOutlineRect, TestSize.Level1)
     RSRenderNode node(id, context);
     node.CollectAndUpdateLocalOutlineRect();
     RSDrawableSlot slot = RSDrawableSlot::OUTLINE;
-    node.dirtySlots_.insert(slot);
+    node.dirtySlots_.set(static_cast<size_t>(slot));
     node.CollectAndUpdateLocalOutlineRect();
     ASSERT_TRUE(true);
 }
@@ -271,7 +271,7 @@ HWTEST_F(RSRenderNodeTest2, CollectAndUpdateLocalPixelStretchRect, TestSize.Leve
     RSRenderNode node(id, context);
     node.CollectAndUpdateLocalPixelStretchRect();
     RSDrawableSlot slot = RSDrawableSlot::PIXEL_STRETCH;
-    node.dirtySlots_.insert(slot);
+    node.dirtySlots_.set(static_cast<size_t>(slot));
     node.CollectAndUpdateLocalPixelStretchRect();
     ASSERT_TRUE(true);
 }
@@ -1505,5 +1505,55 @@ HWTEST_F(RSMarshallingHelperTest, UnmarshallingTest040, TestSize.Level1)
     std::string args = "1";
     EXPECT_FALSE(RSMarshallingHelper::Unmarshalling(parcel, first, args));
 }
+/**
+ * @tc.name: ReadFromParcelMappedTest001
+ * @tc.desc: Verify function ReadFromParcelMapped with data in parcel and data in ashmem
+ * @tc.type:FUNC
+ * @tc.require: issuesI9O78C
+ */
+HWTEST_F(RSMarshallingHelperTest, ReadFromParcelMappedTest001, TestSize.Level1)
+{
+    std::vector<uint8_t> smallData(RSMarshallingHelper::MIN_DATA_SIZE / 2, 1);
+    std::vector<uint8_t> largeData(RSMarshallingHelper::MIN_DATA_SIZE * 2, 2);
+    MessageParcel parcel;
+    EXPECT_TRUE(RSMarshallingHelper::WriteToParcel(parcel, smallData.data(), smallData.size()));
+    EXPECT_TRUE(RSMarshallingHelper::WriteToParcel(parcel, largeData.data(), largeData.size()));
+
+    std::shared_ptr<void> holder;
+    const void* data = RSMarshallingHelper::ReadFromParcelMapped(parcel, smallData.size(), holder);
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(holder, nullptr);
+    EXPECT_EQ(memcmp(data, smallData.data(), smallData.size()), 0);
+
+    data = RSMarshallingHelper::ReadFromParcelMapped(parcel, largeData.size(), holder);
+    ASSERT_NE(data, nullptr);
+    EXPECT_NE(holder, nullptr);
+    EXPECT_EQ(memcmp(data, largeData.data(), largeData.size()), 0);
+}
+
+/**
+ * @tc.name: DrawCmdListMarshallingTest001
+ * @tc.desc: Verify that a DrawCmdList larger than MIN_DATA_SIZE is unmarshalled from ashmem
+ * @tc.type:FUNC
+ * @tc.require: issuesI9O78C
+ */
+HWTEST_F(RSMarshallingHelperTest, DrawCmdListMarshallingTest001, TestSize.Level1)
+{
+    constexpr uint32_t opCount = 1000;
+    auto drawCmdList = std::make_shared<Drawing::DrawCmdList>(10, 10);
+    for (uint32_t i = 0; i < opCount; i++) {
+        drawCmdList->AddDrawOp<Drawing::ClearOpItem::ConstructorHandle>(Drawing::Color::COLOR_BLACK);
+    }
+    ASSERT_GT(drawCmdList->GetData().second, RSMarshallingHelper::MIN_DATA_SIZE);
+
+    MessageParcel parcel;
+    EXPECT_TRUE(RSMarshallingHelper::Marshalling(parcel, drawCmdList));
+    std::shared_ptr<Drawing::DrawCmdList> val;
+    EXPECT_TRUE(RSMarshallingHelper::Unmarshalling(parcel, val));
+    ASSERT_NE(val, nullptr);
+    EXPECT_EQ(val->GetWidth(), 10);
+    EXPECT_EQ(val->GetData().second, drawCmdList->GetData().second);
+    EXPECT_EQ(val->GetOpItemSize(), opCount);
+}
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
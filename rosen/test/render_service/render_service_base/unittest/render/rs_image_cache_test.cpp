@@ -15,6 +15,8 @@
 
 #include "gtest/gtest.h"
 
+#include "image/bitmap.h"
+#include "memory/rs_dfx_string.h"
 #include "render/rs_image_cache.h"
 
 using namespace testing;
@@ -42,7 +44,7 @@ void RSImageCacheTest::TearDown() {}
  */
 HWTEST_F(RSImageCacheTest, InstanceTest, TestSize.Level1)
 {
-    EXPECT_TRUE(RSImageCache::Instance().pixelMapCache_.empty());
+    EXPECT_TRUE(RSImageCache::Instance().GetShard(1).pixelMapCache_.empty());
 }
 
 /**
@@ -55,8 +57,8 @@ HWTEST_F(RSImageCacheTest, CacheDrawingImageTest, TestSize.Level1)
 {
     auto img = std::make_shared<Drawing::Image>();
     RSImageCache::Instance().CacheDrawingImage(1, img);
-    EXPECT_FALSE(RSImageCache::Instance().drawingImageCache_.empty());
-    RSImageCache::Instance().drawingImageCache_.clear();
+    EXPECT_FALSE(RSImageCache::Instance().GetShard(1).drawingImageCache_.empty());
+    RSImageCache::Instance().GetShard(1).drawingImageCache_.clear();
 }
 
 /**
@@ -71,7 +73,7 @@ HWTEST_F(RSImageCacheTest, GetDrawingImageCacheTest, TestSize.Level1)
     auto img = std::make_shared<Drawing::Image>();
     RSImageCache::Instance().CacheDrawingImage(1, img);
     EXPECT_EQ(RSImageCache::Instance().GetDrawingImageCache(0), nullptr);
-    RSImageCache::Instance().drawingImageCache_.clear();
+    RSImageCache::Instance().GetShard(1).drawingImageCache_.clear();
 }
 
 /**
@@ -85,8 +87,8 @@ HWTEST_F(RSImageCacheTest, IncreaseDrawingImageCacheRefCountTest, TestSize.Level
     auto img = std::make_shared<Drawing::Image>();
     RSImageCache::Instance().CacheDrawingImage(1, img);
     RSImageCache::Instance().IncreaseDrawingImageCacheRefCount(0);
-    EXPECT_FALSE(RSImageCache::Instance().drawingImageCache_.empty());
-    RSImageCache::Instance().drawingImageCache_.clear();
+    EXPECT_FALSE(RSImageCache::Instance().GetShard(1).drawingImageCache_.empty());
+    RSImageCache::Instance().GetShard(1).drawingImageCache_.clear();
 }
 
 /**
@@ -100,8 +102,8 @@ HWTEST_F(RSImageCacheTest, ReleaseDrawingImageCacheTest, TestSize.Level1)
     auto img = std::make_shared<Drawing::Image>();
     RSImageCache::Instance().CacheDrawingImage(1, img);
     RSImageCache::Instance().ReleaseDrawingImageCache(0);
-    EXPECT_FALSE(RSImageCache::Instance().drawingImageCache_.empty());
-    RSImageCache::Instance().drawingImageCache_.clear();
+    EXPECT_FALSE(RSImageCache::Instance().GetShard(1).drawingImageCache_.empty());
+    RSImageCache::Instance().GetShard(1).drawingImageCache_.clear();
 }
 
 /**
@@ -116,7 +118,7 @@ HWTEST_F(RSImageCacheTest, GetPixelMapCacheTest, TestSize.Level1)
     auto img = std::make_shared<Drawing::Image>();
     RSImageCache::Instance().CacheDrawingImage(1, img);
     EXPECT_EQ(RSImageCache::Instance().GetPixelMapCache(0), nullptr);
-    RSImageCache::Instance().drawingImageCache_.clear();
+    RSImageCache::Instance().GetShard(1).drawingImageCache_.clear();
 }
 
 /**
@@ -130,8 +132,8 @@ HWTEST_F(RSImageCacheTest, IncreasePixelMapCacheRefCountTest, TestSize.Level1)
     auto img = std::make_shared<Drawing::Image>();
     RSImageCache::Instance().CacheDrawingImage(1, img);
     RSImageCache::Instance().IncreasePixelMapCacheRefCount(0);
-    EXPECT_FALSE(RSImageCache::Instance().drawingImageCache_.empty());
-    RSImageCache::Instance().drawingImageCache_.clear();
+    EXPECT_FALSE(RSImageCache::Instance().GetShard(1).drawingImageCache_.empty());
+    RSImageCache::Instance().GetShard(1).drawingImageCache_.clear();
 }
 
 /**
@@ -147,8 +149,8 @@ HWTEST_F(RSImageCacheTest, ReleasePixelMapCacheTest, TestSize.Level1)
     auto img = std::make_shared<Drawing::Image>();
     RSImageCache::Instance().CacheDrawingImage(1, img);
     RSImageCache::Instance().ReleasePixelMapCache(0);
-    EXPECT_FALSE(RSImageCache::Instance().drawingImageCache_.empty());
-    RSImageCache::Instance().drawingImageCache_.clear();
+    EXPECT_FALSE(RSImageCache::Instance().GetShard(1).drawingImageCache_.empty());
+    RSImageCache::Instance().GetShard(1).drawingImageCache_.clear();
 }
 
 /**
@@ -161,8 +163,8 @@ HWTEST_F(RSImageCacheTest, CacheRenderDrawingImageByPixelMapIdTest, TestSize.Lev
 {
     auto img = std::make_shared<Drawing::Image>();
     RSImageCache::Instance().CacheRenderDrawingImageByPixelMapId(1, img, 0);
-    EXPECT_FALSE(RSImageCache::Instance().pixelMapIdRelatedDrawingImageCache_.empty());
-    RSImageCache::Instance().pixelMapIdRelatedDrawingImageCache_.clear();
+    EXPECT_FALSE(RSImageCache::Instance().GetShard(1).pixelMapIdRelatedDrawingImageCache_.empty());
+    RSImageCache::Instance().GetShard(1).pixelMapIdRelatedDrawingImageCache_.clear();
 }
 
 /**
@@ -177,7 +179,7 @@ HWTEST_F(RSImageCacheTest, GetRenderDrawingImageCacheByPixelMapIdTest, TestSize.
     auto img = std::make_shared<Drawing::Image>();
     RSImageCache::Instance().CacheRenderDrawingImageByPixelMapId(1, img, 0);
     EXPECT_EQ(RSImageCache::Instance().GetRenderDrawingImageCacheByPixelMapId(0, 0), nullptr);
-    RSImageCache::Instance().pixelMapIdRelatedDrawingImageCache_.clear();
+    RSImageCache::Instance().GetShard(1).pixelMapIdRelatedDrawingImageCache_.clear();
 }
 
 /**
@@ -191,7 +193,129 @@ HWTEST_F(RSImageCacheTest, ReleaseDrawingImageCacheByPixelMapIdTest, TestSize.Le
     auto img = std::make_shared<Drawing::Image>();
     RSImageCache::Instance().CacheRenderDrawingImageByPixelMapId(1, img, 0);
     RSImageCache::Instance().ReleaseDrawingImageCacheByPixelMapId(0);
-    EXPECT_FALSE(RSImageCache::Instance().pixelMapIdRelatedDrawingImageCache_.empty());
-    RSImageCache::Instance().pixelMapIdRelatedDrawingImageCache_.clear();
+    EXPECT_FALSE(RSImageCache::Instance().GetShard(1).pixelMapIdRelatedDrawingImageCache_.empty());
+    RSImageCache::Instance().GetShard(1).pixelMapIdRelatedDrawingImageCache_.clear();
+}
+
+namespace {
+std::shared_ptr<Drawing::Image> CreateTestImage(int width, int height)
+{
+    Drawing::Bitmap bmp;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_OPAQUE };
+    bmp.Build(width, height, format);
+    auto img = std::make_shared<Drawing::Image>();
+    img->BuildFromBitmap(bmp);
+    return img;
+}
+} // namespace
+
+/**
+ * @tc.name: ShardTest
+ * @tc.desc: Verify images of different uniqueIds are spread over the shards
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSImageCacheTest, ShardTest, TestSize.Level1)
+{
+    auto& cache = RSImageCache::Instance();
+    constexpr uint64_t pid = 1000;
+    EXPECT_NE(&cache.GetShard((pid << 32) | 1), &cache.GetShard((pid << 32) | 2));
+    EXPECT_EQ(&cache.GetShard((pid << 32) | 1), &cache.GetShard((pid << 32) | 1));
+
+    auto img = CreateTestImage(10, 10);
+    uint64_t uniqueId = (pid << 32) | 3;
+    cache.CacheDrawingImage(uniqueId, img);
+    EXPECT_EQ(cache.GetDrawingImageCache(uniqueId), img);
+    cache.IncreaseDrawingImageCacheRefCount(uniqueId);
+    cache.ReleaseDrawingImageCache(uniqueId);
+    EXPECT_EQ(cache.GetDrawingImageCache(uniqueId), nullptr);
+}
+
+/**
+ * @tc.name: RetainedBudgetTest001
+ * @tc.desc: Verify released images are kept within the budget and reused when sent again
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSImageCacheTest, RetainedBudgetTest001, TestSize.Level1)
+{
+    auto& cache = RSImageCache::Instance();
+    constexpr int imageSize = 16;
+    constexpr size_t imageBytes = imageSize * imageSize * 4; // 4: bytes per pixel
+    // room for two images over all shards
+    cache.SetRetainedBudget(imageBytes * 2);
+    uint64_t evictionCount = cache.evictionCount_;
+
+    // consecutive ids fall into different shards
+    constexpr uint64_t firstId = 5;
+    constexpr uint64_t idStep = 1;
+    for (uint64_t i = 0; i < 3; i++) {
+        uint64_t uniqueId = firstId + i * idStep;
+        cache.CacheDrawingImage(uniqueId, CreateTestImage(imageSize, imageSize));
+        cache.IncreaseDrawingImageCacheRefCount(uniqueId);
+        cache.ReleaseDrawingImageCache(uniqueId);
+    }
+    // the least recently released one is evicted, although its shard holds no other image
+    EXPECT_EQ(cache.GetDrawingImageCache(firstId), nullptr);
+    EXPECT_NE(cache.GetDrawingImageCache(firstId + idStep), nullptr);
+    EXPECT_NE(cache.GetDrawingImageCache(firstId + 2 * idStep), nullptr);
+    EXPECT_EQ(cache.evictionCount_, evictionCount + 1);
+
+    // referenced again, it leaves the retained list
+    cache.IncreaseDrawingImageCacheRefCount(firstId + idStep);
+    EXPECT_EQ(cache.GetShard(firstId + idStep).retainedBytes_, 0);
+    EXPECT_EQ(cache.retainedBytes_, imageBytes);
+
+    DfxString log;
+    cache.DumpStatistics(log);
+    EXPECT_NE(log.GetString().find("eviction"), std::string::npos);
+
+    cache.SetRetainedBudget(0);
+    EXPECT_EQ(cache.retainedBytes_, 0);
+    EXPECT_EQ(cache.GetDrawingImageCache(firstId + 2 * idStep), nullptr);
+    cache.ReleaseDrawingImageCache(firstId + idStep);
+    EXPECT_EQ(cache.GetDrawingImageCache(firstId + idStep), nullptr);
+}
+
+/**
+ * @tc.name: RetainedBudgetTest002
+ * @tc.desc: Verify an image larger than the budget of one shard is kept while it fits the whole budget
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSImageCacheTest, RetainedBudgetTest002, TestSize.Level1)
+{
+    auto& cache = RSImageCache::Instance();
+    constexpr int imageSize = 64;
+    constexpr size_t imageBytes = imageSize * imageSize * 4; // 4: bytes per pixel
+    cache.SetRetainedBudget(imageBytes);
+    ASSERT_GT(imageBytes, imageBytes / RSImageCache::SHARD_COUNT);
+
+    constexpr uint64_t firstId = 21;
+    cache.CacheDrawingImage(firstId, CreateTestImage(imageSize, imageSize));
+    cache.IncreaseDrawingImageCacheRefCount(firstId);
+    cache.ReleaseDrawingImageCache(firstId);
+    EXPECT_NE(cache.GetDrawingImageCache(firstId), nullptr);
+    EXPECT_EQ(cache.retainedBytes_, imageBytes);
+
+    // the next large image of another shard takes the place of the first one
+    constexpr uint64_t secondId = firstId + 1;
+    cache.CacheDrawingImage(secondId, CreateTestImage(imageSize, imageSize));
+    cache.IncreaseDrawingImageCacheRefCount(secondId);
+    cache.ReleaseDrawingImageCache(secondId);
+    EXPECT_EQ(cache.GetDrawingImageCache(firstId), nullptr);
+    EXPECT_NE(cache.GetDrawingImageCache(secondId), nullptr);
+    EXPECT_EQ(cache.retainedBytes_, imageBytes);
+
+    // an image larger than the whole budget is released at once
+    constexpr uint64_t thirdId = secondId + 1;
+    cache.CacheDrawingImage(thirdId, CreateTestImage(imageSize * 2, imageSize));
+    cache.IncreaseDrawingImageCacheRefCount(thirdId);
+    cache.ReleaseDrawingImageCache(thirdId);
+    EXPECT_EQ(cache.GetDrawingImageCache(thirdId), nullptr);
+    EXPECT_NE(cache.GetDrawingImageCache(secondId), nullptr);
+
+    cache.SetRetainedBudget(0);
+    EXPECT_EQ(cache.GetDrawingImageCache(secondId), nullptr);
 }
 } // namespace OHOS::Rosen
\ No newline at end of file
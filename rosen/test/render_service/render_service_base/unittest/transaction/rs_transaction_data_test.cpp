@@ -16,8 +16,10 @@
 #include <gtest/gtest.h>
 
 #include "transaction/rs_transaction_data.h"
+#include "command/rs_base_node_command.h"
 #include "command/rs_command.h"
 #include "command/rs_command_factory.h"
+#include "command/rs_node_command.h"
 #include "platform/common/rs_log.h"
 #include "platform/common/rs_system_properties.h"
 
@@ -344,5 +346,115 @@ HWTEST_F(RSTransactionDataTest, ProcessBySingleFrameComposer, TestSize.Level1)
     RSContext context;
     rsTransactionData.ProcessBySingleFrameComposer(context);
 }
+
+/**
+ * @tc.name: MergePropertyUpdate001
+ * @tc.desc: Test that consecutive property updates of one node are merged into one delta block
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSTransactionDataTest, MergePropertyUpdate001, TestSize.Level1)
+{
+    NodeId nodeId = 1;
+    RSTransactionData rsTransactionData;
+    rsTransactionData.AddCommand(std::make_unique<RSUpdatePropertyFloat>(nodeId, 1.0f, 1, UPDATE_TYPE_OVERWRITE),
+        nodeId, FollowType::NONE);
+    EXPECT_EQ(rsTransactionData.GetCommandCount(), 1);
+    rsTransactionData.AddCommand(
+        std::make_unique<RSUpdatePropertyVector2f>(nodeId, Vector2f(1.0f, 1.0f), 2, UPDATE_TYPE_INCREMENTAL),
+        nodeId, FollowType::NONE);
+    rsTransactionData.AddCommand(std::make_unique<RSUpdatePropertyColor>(nodeId, Color(), 3, UPDATE_TYPE_OVERWRITE),
+        nodeId, FollowType::NONE);
+    ASSERT_EQ(rsTransactionData.GetCommandCount(), 1);
+    auto& command = std::get<2>(rsTransactionData.GetPayload().back());
+    ASSERT_EQ(command->GetSubType(), RSNodeCommandType::UPDATE_MODIFIER_DELTA_BLOCK);
+    const auto& block = std::get<1>(static_cast<RSUpdatePropertyDeltaBlock&>(*command).GetParams());
+    EXPECT_EQ(block.GetSize(), 3);
+    EXPECT_EQ(block.GetColumn<Vector2f>().types[0], UPDATE_TYPE_INCREMENTAL);
+
+    // updates of another node or other types keep their own commands
+    rsTransactionData.AddCommand(std::make_unique<RSUpdatePropertyFloat>(nodeId + 1, 1.0f, 4, UPDATE_TYPE_OVERWRITE),
+        nodeId + 1, FollowType::NONE);
+    rsTransactionData.AddCommand(std::make_unique<RSUpdatePropertyBool>(nodeId + 1, true, 5, UPDATE_TYPE_OVERWRITE),
+        nodeId + 1, FollowType::NONE);
+    rsTransactionData.AddCommand(std::make_unique<RSUpdatePropertyFloat>(nodeId + 1, 1.0f, 6, UPDATE_TYPE_OVERWRITE),
+        nodeId + 1, FollowType::FOLLOW_TO_PARENT);
+    EXPECT_EQ(rsTransactionData.GetCommandCount(), 4);
+}
+
+/**
+ * @tc.name: MergePropertyUpdate002
+ * @tc.desc: Test marshalling and unmarshalling of the merged delta block
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSTransactionDataTest, MergePropertyUpdate002, TestSize.Level1)
+{
+    constexpr uint64_t propertyCount = 16;
+    NodeId nodeId = 1;
+    RSTransactionData rsTransactionData;
+    for (uint64_t i = 0; i < propertyCount; i++) {
+        Vector4f value(static_cast<float>(i));
+        auto command = std::make_unique<RSUpdatePropertyVector4f>(nodeId, value, i, UPDATE_TYPE_OVERWRITE);
+        rsTransactionData.AddCommand(std::move(command), nodeId, FollowType::NONE);
+    }
+    Parcel parcel;
+    ASSERT_TRUE(rsTransactionData.Marshalling(parcel));
+    std::unique_ptr<RSTransactionData> transactionData(RSTransactionData::Unmarshalling(parcel));
+    ASSERT_TRUE(transactionData != nullptr);
+    ASSERT_EQ(transactionData->GetCommandCount(), 1);
+    auto& command = std::get<2>(transactionData->GetPayload().back());
+    ASSERT_EQ(command->GetSubType(), RSNodeCommandType::UPDATE_MODIFIER_DELTA_BLOCK);
+    EXPECT_EQ(command->GetNodeId(), nodeId);
+    const auto& column = std::get<1>(static_cast<RSUpdatePropertyDeltaBlock&>(*command).GetParams())
+        .GetColumn<Vector4f>();
+    ASSERT_EQ(column.Size(), propertyCount);
+    for (uint64_t i = 0; i < propertyCount; i++) {
+        EXPECT_EQ(column.ids[i], i);
+        EXPECT_EQ(column.values[i], Vector4f(static_cast<float>(i)));
+    }
+}
+
+/**
+ * @tc.name: MergePropertyUpdate003
+ * @tc.desc: Test that delta block values are written as components and merged commands are released
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSTransactionDataTest, MergePropertyUpdate003, TestSize.Level1)
+{
+    NodeId nodeId = 1;
+    RSTransactionData rsTransactionData;
+    rsTransactionData.AddCommand(std::make_unique<RSUpdatePropertyFloat>(nodeId, 1.0f, 1, UPDATE_TYPE_OVERWRITE),
+        nodeId, FollowType::NONE);
+    rsTransactionData.AddCommand(std::make_unique<RSUpdatePropertyFloat>(nodeId, 2.0f, 2, UPDATE_TYPE_OVERWRITE),
+        nodeId, FollowType::NONE);
+    std::unique_ptr<RSCommand> command =
+        std::make_unique<RSUpdatePropertyVector2f>(nodeId, Vector2f(3.0f, 4.0f), 3, UPDATE_TYPE_OVERWRITE);
+    ASSERT_TRUE(rsTransactionData.MergePropertyUpdate(command, nodeId, FollowType::NONE));
+    EXPECT_EQ(command, nullptr);
+
+    RSPropertyDeltaBlock block;
+    block.Add(3, Vector2f(3.0f, 4.0f), UPDATE_TYPE_OVERWRITE);
+    Parcel parcel;
+    ASSERT_TRUE(block.Marshalling(parcel));
+    uint32_t count = 0;
+    ASSERT_TRUE(parcel.ReadUint32(count));
+    EXPECT_EQ(count, 0);
+    ASSERT_TRUE(parcel.ReadUint32(count));
+    ASSERT_EQ(count, 1);
+    ASSERT_NE(parcel.ReadBuffer(sizeof(PropertyId)), nullptr);
+    ASSERT_NE(parcel.ReadBuffer(sizeof(PropertyUpdateType)), nullptr);
+    // only x and y are on the wire, no vtable pointer of the sender
+    auto values = reinterpret_cast<const float*>(parcel.ReadBuffer(2 * sizeof(float)));
+    ASSERT_NE(values, nullptr);
+    EXPECT_EQ(values[0], 3.0f);
+    EXPECT_EQ(values[1], 4.0f);
+    ASSERT_TRUE(parcel.ReadUint32(count));
+    EXPECT_EQ(count, 0);
+    ASSERT_TRUE(parcel.ReadUint32(count));
+    EXPECT_EQ(count, 0);
+    EXPECT_EQ(parcel.GetReadableBytes(), 0);
+}
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
@@ -270,6 +270,63 @@ HWTEST_F(MeasurerImplTest, Measure3, TestSize.Level1)
     EXPECT_EQ(g_measurerMockvars.calledHBFontCreate, ret);
 }
 
+/**
+ * @tc.name: Measure4
+ * @tc.desc: Verify that a cached measure result is shared instead of shaped again
+ * @tc.type:FUNC
+ */
+HWTEST_F(MeasurerImplTest, Measure4, TestSize.Level1)
+{
+    MockVars vars;
+    vars.retvalGetGlyphInfo[0].codepoint = 1;
+    InitMiMockVars(std::move(vars), {});
+    MeasurerImpl::ClearCache();
+    MeasurerImpl::SetCacheBudget(MeasurerImpl::DEFAULT_CACHE_BUDGET);
+    auto statistics = MeasurerImpl::GetCacheStatistics();
+    text_ = {4};
+    MeasurerImpl mi(text_, fontCollection_);
+    mi.SetRange(0, 1);
+
+    CharGroups first;
+    CharGroups second;
+    EXPECT_EQ(mi.Measure(first), 0);
+    EXPECT_EQ(mi.Measure(second), 0);
+    EXPECT_EQ(g_measurerMockvars.calledHBFontCreate, 1);
+    EXPECT_TRUE(first.IsSameCharGroups(second));
+    auto current = MeasurerImpl::GetCacheStatistics();
+    EXPECT_EQ(current.hits, statistics.hits + 1);
+    EXPECT_EQ(current.misses, statistics.misses + 1);
+    EXPECT_EQ(current.entries, 1);
+    EXPECT_GT(current.bytes, 0);
+}
+
+/**
+ * @tc.name: Measure5
+ * @tc.desc: Verify that the measure cache keeps within its budget and evicts the least recently used result
+ * @tc.type:FUNC
+ */
+HWTEST_F(MeasurerImplTest, Measure5, TestSize.Level1)
+{
+    MockVars vars;
+    vars.retvalGetGlyphInfo[0].codepoint = 1;
+    InitMiMockVars(std::move(vars), {});
+    MeasurerImpl::ClearCache();
+    MeasurerImpl::SetCacheBudget(0);
+    MeasurerImpl mi(text_, fontCollection_);
+    mi.SetRange(0, 1);
+    EXPECT_EQ(mi.Measure(charGroups_), 0);
+    EXPECT_EQ(MeasurerImpl::GetCacheStatistics().entries, 0);
+
+    MeasurerImpl::SetCacheBudget(MeasurerImpl::DEFAULT_CACHE_BUDGET);
+    EXPECT_EQ(mi.Measure(charGroups_), 0);
+    auto statistics = MeasurerImpl::GetCacheStatistics();
+    EXPECT_EQ(statistics.entries, 1);
+    MeasurerImpl::SetCacheBudget(statistics.bytes * MeasurerImpl::CACHE_SHARD_COUNT - 1);
+    EXPECT_EQ(MeasurerImpl::GetCacheStatistics().entries, 0);
+    EXPECT_EQ(MeasurerImpl::GetCacheStatistics().evictions, statistics.evictions + 1);
+    MeasurerImpl::SetCacheBudget(MeasurerImpl::DEFAULT_CACHE_BUDGET);
+}
+
 /**
  * @tc.name: SeekTypeface1
  * @tc.desc: Verify the SeekTypeface
@@ -204,6 +204,11 @@ public:
         return transferFunc.g;
     }
 
+    TransferFunc GetTransferFunc() const
+    {
+        return transferFunc;
+    }
+
     Vector3 ToLinear(Vector3 color) const;
     Vector3 ToNonLinear(Vector3 color) const;
 
@@ -15,8 +15,88 @@
 
 #include "color_space_convertor.h"
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+
 namespace OHOS {
 namespace ColorManager {
+namespace {
+constexpr size_t MAX_CACHED_LUTS = 16;
+constexpr size_t RGBA_8888_BYTES = 4;
+constexpr float MAX_UINT8 = 255.0f;
+
+// everything Convert() depends on
+std::vector<float> MakeLutKey(const ColorSpace& src, const ColorSpace& dst, uint32_t lutSize)
+{
+    std::vector<float> key = { static_cast<float>(lutSize) };
+    for (const ColorSpace* colorSpace : { &src, &dst }) {
+        for (const auto& row : colorSpace->GetRGBToXYZ()) {
+            key.insert(key.end(), row.begin(), row.end());
+        }
+        TransferFunc p = colorSpace->GetTransferFunc();
+        key.insert(key.end(), { p.g, p.a, p.b, p.c, p.d, p.e, p.f, colorSpace->clampMin, colorSpace->clampMax });
+    }
+    return key;
+}
+
+struct CachedLut {
+    // nullptr if the table is off by more than ColorLut3D::MAX_ERROR, so it is not built again
+    std::shared_ptr<const ColorLut3D> lut;
+    uint64_t lastUse = 0;
+};
+
+size_t GetCachedBytes(const CachedLut& cachedLut)
+{
+    return (cachedLut.lut != nullptr) ? cachedLut.lut->GetByteSize() : 0;
+}
+
+// returns nullptr if the table of the convertor is off by more than ColorLut3D::MAX_ERROR
+std::shared_ptr<const ColorLut3D> GetCachedLut(const ColorSpaceConvertor& convertor, uint32_t lutSize)
+{
+    static std::mutex cacheMutex;
+    static std::map<std::vector<float>, CachedLut> cache;
+    static size_t cachedBytes = 0;
+    static uint64_t useCount = 0;
+    auto key = MakeLutKey(convertor.GetSrcColorSpace(), convertor.GetDstColorSpace(), lutSize);
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto it = cache.find(key);
+        if (it != cache.end()) {
+            it->second.lastUse = ++useCount;
+            return it->second.lut;
+        }
+    }
+    // built without the lock, the first one of convertors building the same table at the same time is kept
+    CachedLut cachedLut;
+    cachedLut.lut = std::make_shared<const ColorLut3D>(convertor, lutSize);
+    if (cachedLut.lut->GetMaxError() > ColorLut3D::MAX_ERROR) {
+        cachedLut.lut = nullptr;
+    }
+    size_t bytes = GetCachedBytes(cachedLut);
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto it = cache.find(key);
+    if (it != cache.end()) {
+        it->second.lastUse = ++useCount;
+        return it->second.lut;
+    }
+    if (bytes > ColorLut3D::MAX_CACHED_BYTES) {
+        return cachedLut.lut;
+    }
+    // convertors keep the tables they use, the cache only drops its own reference
+    while (!cache.empty() && (cache.size() >= MAX_CACHED_LUTS || cachedBytes + bytes > ColorLut3D::MAX_CACHED_BYTES)) {
+        auto oldest = std::min_element(cache.begin(), cache.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.second.lastUse < rhs.second.lastUse; });
+        cachedBytes -= GetCachedBytes(oldest->second);
+        cache.erase(oldest);
+    }
+    cachedLut.lastUse = ++useCount;
+    cachedBytes += bytes;
+    cache.emplace(std::move(key), cachedLut);
+    return cachedLut.lut;
+}
+} // namespace
+
 ColorSpaceConvertor::ColorSpaceConvertor(const ColorSpace &src,
     const ColorSpace &dst, GamutMappingMode mappingMode)
     : srcColorSpace(src), dstColorSpace(dst), mappingMode(mappingMode)
@@ -53,5 +133,147 @@ Vector3 ColorSpaceConvertor::ConvertLinear(const Vector3& v) const
     }
     return dstLinear;
 }
+
+void ColorSpaceConvertor::Convert(const Vector3* src, Vector3* dst, size_t count) const
+{
+    if (lut != nullptr) {
+        for (size_t i = 0; i < count; ++i) {
+            dst[i] = lut->Lookup(src[i]);
+        }
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = Convert(src[i]);
+    }
+}
+
+void ColorSpaceConvertor::ConvertRGBA8888(uint8_t* pixels, size_t count) const
+{
+    for (size_t i = 0; i < count; ++i) {
+        uint8_t* pixel = pixels + i * RGBA_8888_BYTES;
+        Vector3 color = { pixel[0] / MAX_UINT8, pixel[1] / MAX_UINT8, pixel[2] / MAX_UINT8 }; // 2: blue
+        color = (lut != nullptr) ? lut->Lookup(color) : Convert(color);
+        for (size_t c = 0; c < DIMES_3; ++c) {
+            pixel[c] = static_cast<uint8_t>(std::clamp(color[c], 0.0f, 1.0f) * MAX_UINT8 + 0.5f); // 0.5f: round
+        }
+    }
+}
+
+bool ColorSpaceConvertor::EnableLut(uint32_t lutSize)
+{
+    lutSize = std::clamp(lutSize, ColorLut3D::MIN_SIZE, ColorLut3D::MAX_SIZE);
+    if (lut != nullptr && lut->GetSize() == lutSize) {
+        return true;
+    }
+    lut = GetCachedLut(*this, lutSize);
+    return lut != nullptr;
+}
+
+ColorLut3D::ColorLut3D(const ColorSpaceConvertor& convertor, uint32_t lutSize)
+    : size(std::clamp(lutSize, MIN_SIZE, MAX_SIZE)),
+      minValue(convertor.GetSrcColorSpace().clampMin),
+      maxValue(convertor.GetSrcColorSpace().clampMax)
+{
+    float step = (maxValue - minValue) / (size - 1);
+    scale = (step > 0.0f) ? 1.0f / step : 0.0f;
+    table.resize(size * size * size * DIMES_3);
+    auto it = table.begin();
+    for (uint32_t r = 0; r < size; ++r) {
+        for (uint32_t g = 0; g < size; ++g) {
+            for (uint32_t b = 0; b < size; ++b) {
+                Vector3 color = convertor.Convert(Vector3 { minValue + r * step, minValue + g * step,
+                    minValue + b * step });
+                it = std::copy(color.begin(), color.end(), it);
+            }
+        }
+    }
+    // the interpolation error is the largest in the middle of the cells
+    for (uint32_t r = 0; r + 1 < size; ++r) {
+        for (uint32_t g = 0; g + 1 < size; ++g) {
+            for (uint32_t b = 0; b + 1 < size; ++b) {
+                Vector3 center = { minValue + (r + 0.5f) * step, minValue + (g + 0.5f) * step,
+                    minValue + (b + 0.5f) * step };
+                Vector3 exact = convertor.Convert(center);
+                Vector3 interpolated = Lookup(center);
+                for (size_t c = 0; c < DIMES_3; ++c) {
+                    maxError = std::max(maxError, std::fabs(exact[c] - interpolated[c]));
+                }
+            }
+        }
+    }
+}
+
+Vector3 ColorLut3D::Lookup(const Vector3& v) const
+{
+    uint32_t index[DIMES_3];
+    float frac[DIMES_3];
+    for (size_t c = 0; c < DIMES_3; ++c) {
+        // NaN is taken as maxValue
+        float pos = (std::max(minValue, std::min(maxValue, v[c])) - minValue) * scale;
+        index[c] = std::min(static_cast<uint32_t>(pos), size - 2); // 2: the last cell starts at size - 2
+        frac[c] = pos - index[c];
+    }
+    uint32_t r = index[0];
+    uint32_t g = index[1];
+    uint32_t b = index[2]; // 2: blue
+    float fr = frac[0];
+    float fg = frac[1];
+    float fb = frac[2]; // 2: blue
+    // the tetrahedron goes from c000 to c111 through one step along the largest fraction and then along the second
+    const float* first = nullptr;
+    const float* second = nullptr;
+    float largest = 0.0f;
+    float middle = 0.0f;
+    float smallest = 0.0f;
+    if (fr >= fg) {
+        if (fg >= fb) {
+            first = GridPoint(r + 1, g, b);
+            second = GridPoint(r + 1, g + 1, b);
+            largest = fr;
+            middle = fg;
+            smallest = fb;
+        } else if (fr >= fb) {
+            first = GridPoint(r + 1, g, b);
+            second = GridPoint(r + 1, g, b + 1);
+            largest = fr;
+            middle = fb;
+            smallest = fg;
+        } else {
+            first = GridPoint(r, g, b + 1);
+            second = GridPoint(r + 1, g, b + 1);
+            largest = fb;
+            middle = fr;
+            smallest = fg;
+        }
+    } else {
+        if (fr >= fb) {
+            first = GridPoint(r, g + 1, b);
+            second = GridPoint(r + 1, g + 1, b);
+            largest = fg;
+            middle = fr;
+            smallest = fb;
+        } else if (fg >= fb) {
+            first = GridPoint(r, g + 1, b);
+            second = GridPoint(r, g + 1, b + 1);
+            largest = fg;
+            middle = fb;
+            smallest = fr;
+        } else {
+            first = GridPoint(r, g, b + 1);
+            second = GridPoint(r, g + 1, b + 1);
+            largest = fb;
+            middle = fg;
+            smallest = fr;
+        }
+    }
+    const float* c000 = GridPoint(r, g, b);
+    const float* c111 = GridPoint(r + 1, g + 1, b + 1);
+    Vector3 result;
+    for (size_t c = 0; c < DIMES_3; ++c) {
+        result[c] = (1.0f - largest) * c000[c] + (largest - middle) * first[c] + (middle - smallest) * second[c] +
+            smallest * c111[c];
+    }
+    return result;
+}
 }  // namespace ColorManager
 }  // namespace OHOS
\ No newline at end of file
@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 #include <hilog/log.h>
 #include <cmath>
+#include <vector>
 
 #include "color.h"
 #include "color_space.h"
@@ -772,5 +773,130 @@ HWTEST_F(ColorManagerTest, VectorOperator, TestSize.Level1)
     const Vector3 v2 = v1 * m1;
     ASSERT_EQ(v2, v1);
 }
+
+/**
+ * @tc.name: ConvertBatch
+ * @tc.desc: Verify the batch conversion is the same as converting the colors one by one
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ColorManagerTest, ConvertBatch, TestSize.Level1)
+{
+    ColorSpaceConvertor convertor(ColorSpace(SRGB), ColorSpace(DISPLAY_P3), GAMUT_MAP_CONSTANT);
+    std::vector<Vector3> colors = {{0.0f, 0.0f, 0.0f}, {0.1f, 0.2f, 0.3f}, {1.0f, 0.5f, 0.25f}, {2.0f, -1.0f, 1.0f}};
+    std::vector<Vector3> results(colors.size());
+    convertor.Convert(colors.data(), results.data(), colors.size());
+    for (size_t i = 0; i < colors.size(); ++i) {
+        ASSERT_EQ(results[i], convertor.Convert(colors[i]));
+    }
+    // in place
+    convertor.Convert(colors.data(), colors.data(), colors.size());
+    ASSERT_EQ(colors, results);
+}
+
+/**
+ * @tc.name: ConvertWithLut
+ * @tc.desc: Verify the 3D LUT is exact on the grid points, within its max error between them and shared
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ColorManagerTest, ConvertWithLut, TestSize.Level1)
+{
+    ColorSpaceConvertor convertor(ColorSpace(SRGB), ColorSpace(DISPLAY_P3), GAMUT_MAP_CONSTANT);
+    ASSERT_TRUE(convertor.EnableLut());
+    auto lut = convertor.GetLut();
+    ASSERT_NE(lut, nullptr);
+    ASSERT_EQ(lut->GetSize(), ColorSpaceConvertor::DEFAULT_LUT_SIZE);
+    ASSERT_GT(lut->GetMaxError(), 0.0f);
+    ASSERT_LT(lut->GetMaxError(), 0.002f);
+
+    // 0.5 and 0.25 are on the grid of 33 points
+    const Vector3 gridPoint = {0.5f, 0.25f, 1.0f};
+    Vector3 exact = convertor.Convert(gridPoint);
+    Vector3 interpolated = lut->Lookup(gridPoint);
+    for (size_t c = 0; c < MATRIX_SIZE; ++c) {
+        ASSERT_NEAR(interpolated[c], exact[c], 1e-5f);
+    }
+
+    std::vector<Vector3> colors;
+    for (uint32_t i = 0; i < 1000; ++i) { // 1000 colors spread over the color cube
+        colors.push_back({(i % 10) / 9.3f, (i / 10 % 10) / 9.7f, (i / 100) / 9.1f});
+    }
+    std::vector<Vector3> results(colors.size());
+    convertor.Convert(colors.data(), results.data(), colors.size());
+    for (size_t i = 0; i < colors.size(); ++i) {
+        Vector3 expected = convertor.Convert(colors[i]);
+        for (size_t c = 0; c < MATRIX_SIZE; ++c) {
+            ASSERT_NEAR(results[i][c], expected[c], 0.002f);
+        }
+    }
+
+    ColorSpaceConvertor other(ColorSpace(SRGB), ColorSpace(DISPLAY_P3), GAMUT_MAP_CONSTANT);
+    other.EnableLut();
+    ASSERT_EQ(other.GetLut(), lut);
+    other.DisableLut();
+    ASSERT_EQ(other.GetLut(), nullptr);
+}
+
+/**
+ * @tc.name: ConvertWithLut002
+ * @tc.desc: Verify the exact path is kept when the 3D LUT is not accurate enough and the LUT size is bounded
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ColorManagerTest, ConvertWithLut002, TestSize.Level1)
+{
+    // the clipping to sRGB can not be interpolated within half an 8 bit step, even with the largest table
+    ColorSpaceConvertor convertor(ColorSpace(DISPLAY_P3), ColorSpace(SRGB), GAMUT_MAP_CONSTANT);
+    ASSERT_FALSE(convertor.EnableLut());
+    ASSERT_FALSE(convertor.EnableLut(ColorLut3D::MAX_SIZE));
+    ASSERT_EQ(convertor.GetLut(), nullptr);
+    std::vector<Vector3> colors = {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.2f, 0.9f, 0.1f}};
+    std::vector<Vector3> results(colors.size());
+    convertor.Convert(colors.data(), results.data(), colors.size());
+    for (size_t i = 0; i < colors.size(); ++i) {
+        ASSERT_EQ(results[i], convertor.Convert(colors[i]));
+    }
+
+    ColorSpaceConvertor largest(ColorSpace(SRGB), ColorSpace(DISPLAY_P3), GAMUT_MAP_CONSTANT);
+    ASSERT_TRUE(largest.EnableLut(ColorLut3D::MAX_SIZE + 64)); // 64: beyond the largest size
+    ASSERT_EQ(largest.GetLut()->GetSize(), ColorLut3D::MAX_SIZE);
+    ASSERT_LE(largest.GetLut()->GetByteSize(), ColorLut3D::MAX_CACHED_BYTES);
+    ASSERT_LE(largest.GetLut()->GetMaxError(), ColorLut3D::MAX_ERROR);
+}
+
+/**
+ * @tc.name: ConvertRGBA8888
+ * @tc.desc: Verify the RGBA 8888 conversion with and without the 3D LUT
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ColorManagerTest, ConvertRGBA8888, TestSize.Level1)
+{
+    ColorSpaceConvertor convertor(ColorSpace(SRGB), ColorSpace(DISPLAY_P3), GAMUT_MAP_CONSTANT);
+    constexpr size_t pixelCount = 256;
+    std::vector<uint8_t> pixels(pixelCount * 4);
+    for (size_t i = 0; i < pixelCount; ++i) {
+        pixels[i * 4] = static_cast<uint8_t>(i);
+        pixels[i * 4 + 1] = static_cast<uint8_t>(255 - i);
+        pixels[i * 4 + 2] = static_cast<uint8_t>(i * 7);
+        pixels[i * 4 + 3] = static_cast<uint8_t>(i);
+    }
+    std::vector<uint8_t> lutPixels = pixels;
+    convertor.ConvertRGBA8888(pixels.data(), pixelCount);
+    // sRGB (100, 155, 188) is Display P3 (112, 154, 185)
+    ASSERT_EQ(pixels[100 * 4], 112);
+    ASSERT_EQ(pixels[100 * 4 + 1], 154);
+    ASSERT_EQ(pixels[100 * 4 + 2], 185);
+
+    convertor.EnableLut();
+    convertor.ConvertRGBA8888(lutPixels.data(), pixelCount);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        ASSERT_NEAR(lutPixels[i], pixels[i], 1);
+    }
+    for (size_t i = 0; i < pixelCount; ++i) {
+        ASSERT_EQ(lutPixels[i * 4 + 3], i);
+    }
+}
+}
 }
-}
\ No newline at end of file